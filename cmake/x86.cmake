@@ -1,3 +1,5 @@
+option(PPLNN_USE_NUMA "build with libnuma" OFF)
+
 set(PPLNN_USE_X86 ON)
 
 file(GLOB __PPLNN_X86_SRC__ ${CMAKE_CURRENT_SOURCE_DIR}/src/ppl/nn/engines/x86/*.cc)
@@ -18,9 +20,24 @@ unset(__PPLNN_X86_SRC__)
 
 hpcc_populate_dep(ppl.kernel.cpu)
 target_link_libraries(pplnn_x86_static PUBLIC pplnn_basic_static pplkernelx86_static)
+target_include_directories(pplnn_x86_static PRIVATE
+    ${rapidjson_SOURCE_DIR}/include)
 
 target_compile_definitions(pplnn_x86_static PUBLIC PPLNN_USE_X86)
 
+# some kernels, e.g. LayerNorm and GELU, are implemented here with openmp instead of in ppl.kernel.cpu. they share the
+# openmp runtime, and thus the threads set by OmpThreadPool, with kernels in ppl.kernel.cpu.
+if(PPLNN_USE_OPENMP)
+    find_package(OpenMP REQUIRED)
+    target_link_libraries(pplnn_x86_static PUBLIC OpenMP::OpenMP_CXX)
+    target_compile_definitions(pplnn_x86_static PRIVATE PPL_USE_X86_OMP)
+endif()
+
+if (PPLNN_USE_NUMA)
+    target_link_libraries(pplnn_x86_static PUBLIC numa)
+    target_compile_definitions(pplnn_x86_static PUBLIC PPLNN_USE_NUMA)
+endif()
+
 target_link_libraries(pplnn_static INTERFACE pplnn_x86_static)
 
 if(PPLNN_INSTALL)
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_COMMON_HUGE_PAGE_H_
+#define _ST_HPC_PPL_NN_COMMON_HUGE_PAGE_H_
+
+namespace ppl { namespace nn {
+
+/** @brief huge page policies of memory allocated by engines, including constants and buffers of runtimes */
+enum {
+    /** normal pages only */
+    HUGE_PAGE_NONE = 0,
+
+    /** advises the kernel to back large blocks with transparent huge pages via `madvise(MADV_HUGEPAGE)` */
+    HUGE_PAGE_TRANSPARENT = 1,
+
+    /**
+       maps large blocks with hugetlb pages via `MAP_HUGETLB`, which should be reserved in advance, e.g. by
+       `/proc/sys/vm/nr_hugepages`. falls back to transparent huge pages if no hugetlb pages are available.
+    */
+    HUGE_PAGE_HUGETLB = 2,
+};
+
+}} // namespace ppl::nn
+
+#endif
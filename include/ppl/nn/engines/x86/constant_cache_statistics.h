@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_CONSTANT_CACHE_STATISTICS_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_CONSTANT_CACHE_STATISTICS_H_
+
+#include "ppl/nn/common/common.h"
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace ppl { namespace nn { namespace x86 {
+
+/** usage of a constant that is loaded on demand. see `ENGINE_CONF_CONSTANT_CACHE_BYTES`. */
+struct PPLNN_PUBLIC ConstantCacheInfo final {
+    std::string name;
+    uint64_t bytes;
+    /** times that the constant is used by kernels while it is in the cache */
+    uint64_t hits;
+    /** times that the constant is loaded from the model data */
+    uint64_t misses;
+    /** times that the constant is evicted to make room for others */
+    uint64_t evictions;
+};
+
+struct PPLNN_PUBLIC ConstantCacheStatistics final {
+    uint64_t budget_bytes;
+    /** bytes of constants in the cache now */
+    uint64_t used_bytes;
+    /** may be greater than `budget_bytes` if constants used by running kernels do not fit in the budget */
+    uint64_t peak_used_bytes;
+    std::vector<ConstantCacheInfo> constant_info;
+};
+
+}}} // namespace ppl::nn::x86
+
+#endif
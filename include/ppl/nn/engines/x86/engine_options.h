@@ -21,6 +21,7 @@
 #include "ppl/nn/common/common.h"
 #include "ppl/nn/engines/x86/options.h"
 #include <stdint.h>
+#include <vector>
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -28,6 +29,31 @@ struct PPLNN_PUBLIC EngineOptions final {
     uint32_t mm_policy = MM_COMPACT;
     bool disable_avx512 = false;
     bool disable_avx_fma3 = false;
+
+    /**
+       number of threads used by kernels of runtimes created by this engine. 0 means using the global setting, see
+       `SetGlobalOmpNumThreads()`.
+       @note `thread_num` and `cpu_ids` are defaults of all runtimes created by this engine. use
+       `DEV_CONF_SET_THREADS` to change them for a runtime. threads and cpus are split evenly among threads of a
+       parallel scheduler that run kernels at the same time.
+    */
+    uint32_t thread_num = 0;
+
+    /**
+       cpus that threads of runtimes are bound to. the i-th thread is bound to `cpu_ids[i % cpu_ids.size()]`.
+       `thread_num` defaults to `cpu_ids.size()` if it is 0. empty means no binding.
+    */
+    std::vector<int32_t> cpu_ids;
+
+    /**
+       numa node that constants, buffers of runtimes and threads of runtimes are bound to. threads are bound to
+       all cpus of this node if `cpu_ids` is empty. -1 means not binding. it is ignored if the system has only one
+       numa node or pplnn is built without `PPLNN_USE_NUMA`.
+    */
+    int32_t numa_node_id = -1;
+
+    /** whether constants and buffers of runtimes are backed by huge pages. see `ppl/nn/common/huge_page.h`. */
+    uint32_t huge_page_policy = HUGE_PAGE_NONE;
 };
 
 }}} // namespace ppl::nn::x86
@@ -18,6 +18,8 @@
 #ifndef _ST_HPC_PPL_NN_ENGINES_X86_OPTIONS_H_
 #define _ST_HPC_PPL_NN_ENGINES_X86_OPTIONS_H_
 
+#include "ppl/nn/common/huge_page.h"
+
 namespace ppl { namespace nn { namespace x86 {
 
 /** @brief options for X86Engine::Configure() */
@@ -52,6 +54,110 @@ enum {
     */
     ENGINE_CONF_DEBUG_DATA_DIR = 2,
 
+    /**
+       @brief uint32_t, set reshape cache on(1)/off(0), default is off. kernels reuse output shapes of the
+       previous run instead of calling Reshape() if shapes and data of their inputs that are no larger than 256 bytes
+       are not changed. ops whose output shapes depend on data of large inputs, e.g. NonZero, are always reshaped.
+
+       @note example:
+       @code{.cpp}
+       x86_engine->Configure(ENGINE_CONF_RESHAPE_CACHE, uint32_t);
+       @endcode
+    */
+    ENGINE_CONF_RESHAPE_CACHE = 3,
+
+    /**
+       @brief uint32_t, set algorithm tuning on(1)/off(0), default is off. candidate algorithms of kernels, e.g. conv,
+       are measured on this machine and the fastest one is selected. results are reused via
+       `ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER` and `ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER`.
+
+       @note example:
+       @code{.cpp}
+       x86_engine->Configure(ENGINE_CONF_ALGO_TUNING, uint32_t);
+       @endcode
+    */
+    ENGINE_CONF_ALGO_TUNING = 4,
+
+    /**
+       @param json_buffer pointer to a json buffer exported by `ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER`
+       @param buffer_size length of the buffer
+
+       @note example:
+       @code{.cpp}
+       x86_engine->Configure(ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER, json_buffer, buffer_size);
+       @endcode
+    */
+    ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER = 5,
+
+    /**
+       @brief sets the callback function and arg for exporting selected algorithms after processing a graph.
+
+       @param callback a C-style callback function `void (*)(const char* data, uint64_t bytes, void* arg)`
+       @param arg a pointer that is passed to `callback`
+
+       @note example:
+       @code{.cpp}
+       static void SaveAlgoInfo(const char* data, uint64_t bytes, void* arg) {
+           auto content = (string*)arg;
+           content->assign(data, bytes);
+       }
+       string content;
+       x86_engine->Configure(ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER, SaveAlgoInfo, &content);
+       @endcode
+    */
+    ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER = 6,
+
+    /**
+       @brief uint64_t*, bytes of constants that are backed by huge pages. see `EngineOptions::huge_page_policy`.
+
+       @note example:
+       @code{.cpp}
+       uint64_t bytes = 0;
+       x86_engine->Configure(ENGINE_CONF_GET_HUGE_PAGE_BYTES, &bytes);
+       @endcode
+    */
+    ENGINE_CONF_GET_HUGE_PAGE_BYTES = 7,
+
+    /**
+       @brief uint64_t, budget of constants that are loaded on demand, default is 0, which means all constants are
+       loaded when graphs are processed. if it is not 0, constants that are larger than 64KB, not converted by
+       kernels and mapped read-only from files, e.g. external data files of onnx models, are copied from the
+       mappings when they are used by kernels, and least recently used ones are evicted if bytes of loaded constants
+       exceed the budget. other constants are already in memory and are loaded as usual. constants used by running
+       kernels are never evicted, so the budget may be exceeded if they do not fit in it.
+
+       @note MUST be set before building runtimes. models built with it cannot be exported as pmx models.
+       example:
+       @code{.cpp}
+       x86_engine->Configure(ENGINE_CONF_CONSTANT_CACHE_BYTES, uint64_t);
+       @endcode
+    */
+    ENGINE_CONF_CONSTANT_CACHE_BYTES = 8,
+
+    /**
+       @brief ConstantCacheStatistics*, usage of constants that are loaded on demand.
+       see `ENGINE_CONF_CONSTANT_CACHE_BYTES`.
+
+       @note example:
+       @code{.cpp}
+       ConstantCacheStatistics stat;
+       x86_engine->Configure(ENGINE_CONF_GET_CONSTANT_CACHE_STATISTICS, &stat);
+       @endcode
+    */
+    ENGINE_CONF_GET_CONSTANT_CACHE_STATISTICS = 9,
+
+    /**
+       @brief uint64_t, nodes whose inputs are all constants are evaluated once when graphs are processed, and their
+       outputs are replaced with new constants if none of them is larger than this value. default is 16MB. 0 means
+       constant folding is disabled.
+
+       @note MUST be set before building runtimes. example:
+       @code{.cpp}
+       x86_engine->Configure(ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES, uint64_t);
+       @endcode
+    */
+    ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES = 10,
+
     /** max value */
     ENGINE_CONF_MAX,
 };
@@ -66,10 +172,78 @@ enum {
 
     /** plain implementation */
     MM_PLAIN = 2,
+
+    /**
+       reuses a memory plan made from the previous run. buffers of intermediate tensors, inputs and outputs are
+       placed in an arena with fixed offsets if input shapes are not changed, so that no allocator is called in steady
+       state. falls back to MM_COMPACT when shapes change.
+    */
+    MM_STATIC_PLAN = 3,
 };
 
+/** @brief huge page policies of memory allocated by x86 engines. see `ppl/nn/common/huge_page.h`. */
+using ppl::nn::HUGE_PAGE_NONE;
+using ppl::nn::HUGE_PAGE_TRANSPARENT;
+using ppl::nn::HUGE_PAGE_HUGETLB;
+
 /** @brief options for x86::DeviceContext::Configure() */
 enum {
+    /**
+       @brief uint64_t*, bytes of buffers of a runtime that are backed by huge pages
+
+       @note example:
+       @code{.cpp}
+       uint64_t bytes = 0;
+       x86_dev_ctx->Configure(DEV_CONF_GET_HUGE_PAGE_BYTES, &bytes);
+       @endcode
+    */
+    DEV_CONF_GET_HUGE_PAGE_BYTES = 0,
+
+    /**
+       @brief gives memory that is not used by any tensor back to the system, e.g. after a run with unusually large
+       input shapes. the first `keep_bytes` bytes are kept for following runs. 0 means trimming to the buffers that
+       are in use.
+
+       @param keep_bytes uint64_t
+       @param released_bytes uint64_t*, bytes released. can be nullptr.
+
+       @note MUST NOT be called during a run. example:
+       @code{.cpp}
+       uint64_t released_bytes = 0;
+       x86_dev_ctx->Configure(DEV_CONF_TRIM_MEMORY, (uint64_t)0, &released_bytes);
+       @endcode
+    */
+    DEV_CONF_TRIM_MEMORY = 1,
+
+    /**
+       @brief uint32_t, trims memory automatically after this number of consecutive runs that use less memory than
+       the peak, keeping what these runs need. 0 means off, which is the default.
+
+       @note example:
+       @code{.cpp}
+       x86_dev_ctx->Configure(DEV_CONF_SET_AUTO_TRIM_RUNS, (uint32_t)16);
+       @endcode
+    */
+    DEV_CONF_SET_AUTO_TRIM_RUNS = 2,
+
+    /**
+       @brief sets threads used by kernels of a runtime, overriding `EngineOptions::thread_num` and
+       `EngineOptions::cpu_ids` for this runtime only.
+
+       @param thread_num uint32_t, defaults to `cpu_num` if it is 0. both being 0 means using the number of threads
+       of the thread that runs the runtime without binding.
+       @param cpu_ids const int32_t*, cpus that threads are bound to. the i-th thread is bound to
+       `cpu_ids[i % cpu_num]`.
+       @param cpu_num uint32_t
+
+       @note MUST NOT be called during a run. example:
+       @code{.cpp}
+       const int32_t cpu_ids[] = {0, 1, 2, 3};
+       x86_dev_ctx->Configure(DEV_CONF_SET_THREADS, (uint32_t)4, cpu_ids, (uint32_t)4);
+       @endcode
+    */
+    DEV_CONF_SET_THREADS = 3,
+
     DEV_CONF_MAX,
 };
 
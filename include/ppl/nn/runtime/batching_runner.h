@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_H_
+#define _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/nn/common/common.h"
+#include <stdint.h>
+#include <vector>
+
+namespace ppl { namespace nn {
+
+struct PPLNN_PUBLIC BatchingRunnerOptions final {
+    /** max number of samples in a batch. requests are not split, so a request larger than it runs alone. */
+    uint32_t max_batch_size = 8;
+
+    /** max time that the first request of a batch waits for other requests */
+    uint32_t max_delay_microseconds = 1000;
+};
+
+struct PPLNN_PUBLIC BatchingRunnerStatistics final {
+    uint64_t request_count;
+    uint64_t batch_count;
+    /** sum of samples of all batches. `sample_count / batch_count` is the average batch size. */
+    uint64_t sample_count;
+    uint32_t max_samples_in_batch;
+
+    /** time from a request being queued to its batch being run */
+    uint64_t total_wait_microseconds;
+    uint64_t max_wait_microseconds;
+};
+
+/**
+   an input of a request. `data` is in NDARRAY format with the data type of the corresponding input tensor of the
+   runtime. `dims[0]` is the number of samples, which MUST be the same for all inputs of a request.
+*/
+struct PPLNN_PUBLIC BatchingInput final {
+    const void* data = nullptr;
+    std::vector<int64_t> dims;
+};
+
+/** an output of a request, in NDARRAY format with the data type of the corresponding output tensor. */
+struct PPLNN_PUBLIC BatchingOutput final {
+    std::vector<int64_t> dims;
+    std::vector<char> data;
+};
+
+/**
+   @class BatchingRunner
+   @brief queues requests from multiple threads, concatenates inputs of requests along dim 0 and runs them with
+   one `Runtime::Run()`. outputs are split along dim 0 and given back to each request.
+   @note requests can be put into the same batch only if their inputs have the same dims except dim 0. all
+   outputs of the model MUST be batch-major, i.e. dim 0 of outputs equals to the number of samples.
+*/
+class PPLNN_PUBLIC BatchingRunner {
+public:
+    virtual ~BatchingRunner() {}
+
+    /**
+       @brief runs a request and waits for its outputs. thread-safe.
+       @param inputs MUST be the same number as inputs of the model, in the same order as `Runtime::GetInputTensor()`
+       @param outputs in the same order as `Runtime::GetOutputTensor()`
+    */
+    virtual ppl::common::RetCode Run(const std::vector<BatchingInput>& inputs,
+                                     std::vector<BatchingOutput>* outputs) = 0;
+
+    virtual ppl::common::RetCode GetStatistics(BatchingRunnerStatistics*) const = 0;
+};
+
+}} // namespace ppl::nn
+
+#endif
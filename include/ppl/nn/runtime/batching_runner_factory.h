@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_FACTORY_H_
+#define _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_FACTORY_H_
+
+#include "ppl/nn/runtime/batching_runner.h"
+#include "ppl/nn/runtime/runtime_pool.h"
+
+namespace ppl { namespace nn {
+
+class PPLNN_PUBLIC BatchingRunnerFactory final {
+public:
+    /**
+       @brief each runtime of `pool` is used by a worker thread, which runs a batch at a time.
+       @note the runner takes the ownership of `pool`, even if it fails.
+    */
+    static BatchingRunner* Create(RuntimePool* pool, const BatchingRunnerOptions& options);
+};
+
+}} // namespace ppl::nn
+
+#endif
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_MEMORY_STATISTICS_H_
+#define _ST_HPC_PPL_NN_RUNTIME_MEMORY_STATISTICS_H_
+
+#include "ppl/nn/common/common.h"
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace ppl { namespace nn {
+
+/** memory used by a device of a runtime. fields that are not supported by the device are 0. */
+struct PPLNN_PUBLIC DeviceMemoryStatistics final {
+    /** name of the engine context that uses this device */
+    std::string name;
+    /** bytes held by the allocator, including the free ones. memory given back by trimming is excluded. */
+    uint64_t buffered_bytes;
+    /** bytes of buffers in use now, e.g. outputs */
+    uint64_t used_bytes;
+    /** peak of `used_bytes` since the runtime is created, including tensors and scratch buffers */
+    uint64_t peak_used_bytes;
+    /** the largest scratch buffer requested by kernels */
+    uint64_t max_tmp_buffer_bytes;
+    /**
+       the largest contiguous free block in `buffered_bytes`. fragmentation can be evaluated by
+       `1 - largest_free_block_bytes / (buffered_bytes - used_bytes)` if the runtime is not trimmed, because free
+       blocks may include ranges given back by trimming.
+    */
+    uint64_t largest_free_block_bytes;
+};
+
+/** size and lifetime of a tensor produced by a kernel in the last run */
+struct PPLNN_PUBLIC EdgeMemoryInfo final {
+    std::string name;
+    uint64_t bytes;
+    /** index of the producer in the execution order */
+    uint32_t producer_step;
+    /** index of the last consumer in the execution order, or UINT32_MAX if it is not freed during runs */
+    uint32_t last_consumer_step;
+};
+
+struct PPLNN_PUBLIC MemoryStatistics final {
+    /** constants used by this runtime. they may be shared with other runtimes created by the same builder. */
+    uint64_t constant_bytes;
+    std::vector<DeviceMemoryStatistics> device_stat;
+    /** ordered by `producer_step` */
+    std::vector<EdgeMemoryInfo> edge_info;
+};
+
+}} // namespace ppl::nn
+
+#endif
@@ -41,9 +41,34 @@ enum {
        runtime->Configure(RUNTIME_CONF_SET_SCHEDULER, sched); // now `runtime` takes the ownership of `sched`
        // no need to delete sched
        @endcode
+       returns RC_UNSUPPORTED if `sched` runs kernels concurrently (see `Scheduler::IsConcurrent()`) and any device
+       used by this runtime cannot allocate memory from multiple threads.
     */
     RUNTIME_CONF_SET_SCHEDULER,
 
+    /**
+       @brief args: uint32_t, number of threads used to run independent kernels concurrently. 0 means using all cores.
+       @note kernels that have no dependencies between each other may be run at the same time. returns
+       RC_UNSUPPORTED if any device used by this runtime cannot allocate memory from multiple threads.
+    */
+    RUNTIME_CONF_SET_PARALLEL_SCHEDULER,
+
+    /**
+       @brief args: uint64_t*, bytes released. can be nullptr.
+       @note gives memory of all devices that is not used by any tensor back to the system. MUST NOT be called during
+       a run. use `DeviceContext::Configure()` for engine specific options, e.g. keeping some memory or trimming
+       automatically.
+    */
+    RUNTIME_CONF_TRIM_MEMORY,
+
+    /**
+       @brief args: const uint32_t* cpu_ids, uint32_t cpu_num
+       @note threads used by kernels of this runtime, e.g. OpenMP threads of x86 kernels, run on `cpu_ids`, one thread
+       for each cpu. devices whose kernels do not run on cpu threads are not affected. returns RC_UNSUPPORTED if no
+       device of this runtime supports it. MUST NOT be called during a run.
+    */
+    RUNTIME_CONF_BIND_CPUS,
+
     RUNTIME_CONF_MAX,
 };
 
@@ -29,12 +29,40 @@ struct PPLNN_PUBLIC KernelProfilingInfo final {
     std::string name;
     std::string domain;
     std::string type;
+    /** total time of all executions */
     uint64_t exec_microseconds;
     uint32_t exec_count;
+
+    /** distribution of time of each execution. percentiles are approximate with a relative error less than 1/8. */
+    uint64_t min_exec_microseconds;
+    uint64_t max_exec_microseconds;
+    uint64_t p50_exec_microseconds;
+    uint64_t p99_exec_microseconds;
+
+    /**
+       estimated floating point operations of all executions, derived from shapes of inputs and outputs.
+       0 means unknown or not applicable, e.g. ops that only move data.
+    */
+    uint64_t total_flops;
+    /** bytes of inputs and outputs of all executions */
+    uint64_t total_bytes;
+};
+
+/** a kernel execution in the timeline */
+struct PPLNN_PUBLIC KernelTraceEvent final {
+    /** index of `ProfilingStatistics::prof_info` */
+    uint32_t kernel_idx;
+    /** index of the thread running this kernel. always 0 unless a parallel scheduler is used. */
+    uint32_t thread_idx;
+    /** relative to the time when profiling is enabled */
+    uint64_t begin_microseconds;
+    uint64_t exec_microseconds;
 };
 
 struct PPLNN_PUBLIC ProfilingStatistics final {
     std::vector<KernelProfilingInfo> prof_info;
+    /** executions in time order. only the first 1,000,000 executions after profiling is enabled are recorded. */
+    std::vector<KernelTraceEvent> trace_events;
 };
 
 }} // namespace ppl::nn
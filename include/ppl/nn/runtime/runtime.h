@@ -24,6 +24,7 @@
 #include "ppl/nn/runtime/tensor.h"
 #include "ppl/nn/runtime/partition_runner.h"
 #include "ppl/nn/runtime/profiling_statistics.h"
+#include "ppl/nn/runtime/memory_statistics.h"
 
 namespace ppl { namespace nn {
 
@@ -103,6 +104,14 @@ public:
        @note alailable if `PPLNN_ENABLE_KERNEL_PROFILING` is enabled.
     */
     virtual ppl::common::RetCode GetProfilingStatistics(ProfilingStatistics*) const = 0;
+
+    /**
+       @brief get memory usage of constants, devices and tensors of the last run.
+       @return RC_UNSUPPORTED if it is not implemented.
+    */
+    virtual ppl::common::RetCode GetMemoryStatistics(MemoryStatistics*) const {
+        return ppl::common::RC_UNSUPPORTED;
+    }
 };
 
 }} // namespace ppl::nn
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_H_
+#define _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_H_
+
+#include "ppl/nn/runtime/runtime.h"
+#include <vector>
+
+namespace ppl { namespace nn {
+
+struct PPLNN_PUBLIC RuntimePoolOptions final {
+    /** number of runtimes in the pool */
+    uint32_t runtime_num = 1;
+
+    /**
+       threads used by kernels of the i-th runtime, e.g. OpenMP threads of x86 runtimes, run on `cpu_sets[i]`, one
+       thread for each cpu, and a thread that acquires the i-th runtime is bound to `cpu_sets[i]` until the runtime
+       is released. nothing is bound if `cpu_sets` is empty. see `RUNTIME_CONF_BIND_CPUS`.
+    */
+    std::vector<std::vector<uint32_t>> cpu_sets;
+};
+
+struct PPLNN_PUBLIC RuntimePoolStatistics final {
+    uint32_t runtime_num;
+    uint32_t idle_runtime_num;
+
+    /** number of threads waiting for an idle runtime */
+    uint32_t queue_depth;
+    uint32_t max_queue_depth;
+
+    uint64_t acquire_count;
+    uint64_t total_wait_microseconds;
+    uint64_t max_wait_microseconds;
+};
+
+/**
+   @class RuntimePool
+   @brief a fixed set of runtimes created by the same builder, handed out to request threads.
+   @note runtimes share constants of the builder. a runtime MUST be released by the thread acquiring it.
+*/
+class PPLNN_PUBLIC RuntimePool {
+public:
+    virtual ~RuntimePool() {}
+
+    virtual uint32_t GetRuntimeCount() const = 0;
+
+    /** @brief waits until a runtime is idle. returns nullptr on failure. */
+    virtual Runtime* Acquire() = 0;
+
+    /** @brief returns nullptr immediately if there is no idle runtime. */
+    virtual Runtime* TryAcquire() = 0;
+
+    /**
+       @brief gives back a runtime returned by `Acquire()` or `TryAcquire()`.
+       @return RC_INVALID_VALUE if `runtime` is not acquired or has already been released.
+    */
+    virtual ppl::common::RetCode Release(Runtime*) = 0;
+
+    virtual ppl::common::RetCode GetStatistics(RuntimePoolStatistics*) const = 0;
+};
+
+}} // namespace ppl::nn
+
+#endif
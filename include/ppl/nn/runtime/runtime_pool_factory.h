@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_FACTORY_H_
+#define _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_FACTORY_H_
+
+#include "ppl/nn/runtime/runtime_pool.h"
+
+namespace ppl { namespace nn {
+
+class PPLNN_PUBLIC RuntimePoolFactory final {
+public:
+    /**
+       @param runtimes `options.runtime_num` runtimes created by the same builder.
+       @note the pool takes the ownership of `runtimes`, even if it fails.
+    */
+    static RuntimePool* Create(Runtime** runtimes, const RuntimePoolOptions& options);
+
+    /**
+       @brief creates `options.runtime_num` runtimes by `builder->CreateRuntime()`.
+       @note works with both onnx::RuntimeBuilder and pmx::RuntimeBuilder.
+    */
+    template <typename BuilderType>
+    static RuntimePool* Create(const BuilderType* builder, const RuntimePoolOptions& options) {
+        std::vector<Runtime*> runtimes(options.runtime_num, nullptr);
+        for (uint32_t i = 0; i < options.runtime_num; ++i) {
+            runtimes[i] = builder->CreateRuntime();
+            if (!runtimes[i]) {
+                for (uint32_t j = 0; j < i; ++j) {
+                    delete runtimes[j];
+                }
+                return nullptr;
+            }
+        }
+        return Create(runtimes.data(), options);
+    }
+};
+
+}} // namespace ppl::nn
+
+#endif
@@ -94,6 +94,21 @@ public:
 
     /** @brief get the underlying buffer ptr */
     virtual void* GetBufferPtr() const = 0;
+
+    /**
+       @brief uses `buf`, a host memory of `bytes` bytes owned by the caller, as the buffer of this tensor without
+       copying. data in `buf` is in NDARRAY format with the data type of this tensor.
+       @return RC_UNSUPPORTED if `buf` cannot be used directly, e.g. the tensor is not in NDARRAY format, `buf` is too
+       small or not aligned, or the underlying device cannot access host memory. callers should fall back to
+       `ConvertFromHost()`/`ConvertToHost()` in this case.
+       @note `buf` MUST be valid until it is unbound by `FreeBuffer()`, `SetBufferPtr()`, another call of this function
+       or destroying the tensor. if an output needs more than `bytes` bytes or a format other than NDARRAY in some run,
+       it is unbound and the result is written to an internal buffer. check whether `GetBufferPtr()` is still `buf`
+       after running.
+    */
+    virtual ppl::common::RetCode BindHostBuffer(void* buf, uint64_t bytes) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
 };
 
 }} // namespace ppl::nn
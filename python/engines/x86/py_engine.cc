@@ -21,6 +21,7 @@
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 #include "ppl/nn/common/logger.h"
+#include "ppl/common/mmap.h"
 #include <map>
 using namespace std;
 using namespace ppl::common;
@@ -28,20 +29,75 @@ using namespace ppl::nn::x86;
 
 namespace ppl { namespace nn { namespace python { namespace x86 {
 
-static RetCode GenericSetOptionUint32(Engine* engine, uint32_t option, const pybind11::args& args) {
-    return engine->Configure(option, args[0].cast<uint32_t>());
+static RetCode GenericSetOptionUint32(PyX86Engine& engine, uint32_t option, const pybind11::args& args) {
+    return engine.ptr->Configure(option, args[0].cast<uint32_t>());
 }
 
-static RetCode GenericSetOptionString(Engine* engine, uint32_t option, const pybind11::args& args) {
-    return engine->Configure(option, args[0].cast<string>().c_str());
+static RetCode GenericSetOptionUint64(PyX86Engine& engine, uint32_t option, const pybind11::args& args) {
+    return engine.ptr->Configure(option, args[0].cast<uint64_t>());
 }
 
-typedef RetCode (*ConfigFunc)(Engine*, uint32_t option, const pybind11::args& args);
+static RetCode GenericSetOptionString(PyX86Engine& engine, uint32_t option, const pybind11::args& args) {
+    return engine.ptr->Configure(option, args[0].cast<string>().c_str());
+}
+
+static void X86SaveAlgoInfo(const char* data, uint64_t bytes, void* arg) {
+    auto fname = (const char*)arg;
+    auto fp = fopen(fname, "w");
+    if (!fp) {
+        LOG(ERROR) << "open [" << fname << "] for exporting algo info failed.";
+        return;
+    }
+
+    auto ret = fwrite(data, bytes, 1, fp);
+    if (ret != 1) {
+        LOG(ERROR) << "write algo info to [" << fname << "] failed.";
+    }
+
+    fclose(fp);
+}
+
+static RetCode ImportAlgorithmsFromBuffer(PyX86Engine& engine, uint32_t option, const pybind11::args& args) {
+    if (args.size() != 1) {
+        LOG(ERROR) << "expected for 1 parameter but got [" << args.size() << "].";
+        return RC_INVALID_VALUE;
+    }
+
+    auto fname = args[0].cast<string>();
+    Mmap fm;
+    auto rc = fm.Init(fname.c_str(), Mmap::READ);
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "mapping algorithms file[" << fname << "] failed.";
+        return rc;
+    }
+
+    return engine.ptr->Configure(ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER, fm.GetData(), fm.GetSize());
+}
+
+static RetCode SetExportAlgorithmsHandler(PyX86Engine& engine, uint32_t option, const pybind11::args& args) {
+    if (args.size() != 1) {
+        LOG(ERROR) << "expected for 1 parameter but got [" << args.size() << "].";
+        return RC_INVALID_VALUE;
+    }
+
+    // save file name in PyX86Engine
+    engine.export_algo_file = args[0].cast<string>();
+    return engine.ptr->Configure(ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER, X86SaveAlgoInfo,
+                                 engine.export_algo_file.c_str());
+}
+
+typedef RetCode (*ConfigFunc)(PyX86Engine&, uint32_t option, const pybind11::args& args);
 
 static const map<uint32_t, ConfigFunc> g_opt2func = {
     {ENGINE_CONF_GRAPH_FUSION, GenericSetOptionUint32},
     {ENGINE_CONF_TENSOR_DEBUG, GenericSetOptionUint32},
     {ENGINE_CONF_DEBUG_DATA_DIR, GenericSetOptionString},
+    {ENGINE_CONF_RESHAPE_CACHE, GenericSetOptionUint32},
+    {ENGINE_CONF_ALGO_TUNING, GenericSetOptionUint32},
+    {ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER, ImportAlgorithmsFromBuffer},
+    {ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER, SetExportAlgorithmsHandler},
+    {ENGINE_CONF_CONSTANT_CACHE_BYTES, GenericSetOptionUint64},
+    {ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES, GenericSetOptionUint64},
 };
 
 void RegisterEngine(pybind11::module* m) {
@@ -51,18 +107,24 @@ void RegisterEngine(pybind11::module* m) {
                  return (engine.ptr.get());
              })
         .def("Configure",
-             [](const PyX86Engine& engine, uint32_t option, const pybind11::args& args) -> RetCode {
+             [](PyX86Engine& engine, uint32_t option, const pybind11::args& args) -> RetCode {
                  auto it = g_opt2func.find(option);
                  if (it == g_opt2func.end()) {
                      LOG(ERROR) << "unsupported option: " << option;
                      return RC_UNSUPPORTED;
                  }
-                 return it->second(engine.ptr.get(), option, args);
+                 return it->second(engine, option, args);
              });
 
     m->attr("ENGINE_CONF_GRAPH_FUSION") = (uint32_t)ENGINE_CONF_GRAPH_FUSION;
     m->attr("ENGINE_CONF_TENSOR_DEBUG") = (uint32_t)ENGINE_CONF_TENSOR_DEBUG;
     m->attr("ENGINE_CONF_DEBUG_DATA_DIR") = (uint32_t)ENGINE_CONF_DEBUG_DATA_DIR;
+    m->attr("ENGINE_CONF_RESHAPE_CACHE") = (uint32_t)ENGINE_CONF_RESHAPE_CACHE;
+    m->attr("ENGINE_CONF_ALGO_TUNING") = (uint32_t)ENGINE_CONF_ALGO_TUNING;
+    m->attr("ENGINE_CONF_IMPORT_ALGORITHMS") = (uint32_t)ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER;
+    m->attr("ENGINE_CONF_EXPORT_ALGORITHMS") = (uint32_t)ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER;
+    m->attr("ENGINE_CONF_CONSTANT_CACHE_BYTES") = (uint32_t)ENGINE_CONF_CONSTANT_CACHE_BYTES;
+    m->attr("ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES") = (uint32_t)ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES;
 }
 
 }}}} // namespace ppl::nn::python::x86
@@ -19,11 +19,13 @@
 #define _ST_HPC_PPL_NN_PYTHON_X86_PY_ENGINE_H_
 
 #include "../py_engine.h"
+#include <string>
 
 namespace ppl { namespace nn { namespace python { namespace x86 {
 
 struct PyX86Engine final : public PyEngine {
     PyX86Engine(Engine* p) : PyEngine(p) {}
+    std::string export_algo_file;
 };
 
 }}}} // namespace ppl::nn::python::x86
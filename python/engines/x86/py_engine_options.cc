@@ -17,6 +17,7 @@
 
 #include "ppl/nn/engines/x86/engine_options.h"
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 using namespace ppl::nn::x86;
 
 namespace ppl { namespace nn { namespace python { namespace x86 {
@@ -26,11 +27,20 @@ void RegisterEngineOptions(pybind11::module* m) {
         .def(pybind11::init<>())
         .def_readwrite("mm_policy", &EngineOptions::mm_policy)
         .def_readwrite("disable_avx512", &EngineOptions::disable_avx512)
-        .def_readwrite("disable_avx_fma3", &EngineOptions::disable_avx_fma3);
+        .def_readwrite("disable_avx_fma3", &EngineOptions::disable_avx_fma3)
+        .def_readwrite("thread_num", &EngineOptions::thread_num)
+        .def_readwrite("cpu_ids", &EngineOptions::cpu_ids)
+        .def_readwrite("numa_node_id", &EngineOptions::numa_node_id)
+        .def_readwrite("huge_page_policy", &EngineOptions::huge_page_policy);
 
     m->attr("MM_COMPACT") = (uint32_t)MM_COMPACT;
     m->attr("MM_MRU") = (uint32_t)MM_MRU;
     m->attr("MM_PLAIN") = (uint32_t)MM_PLAIN;
+    m->attr("MM_STATIC_PLAN") = (uint32_t)MM_STATIC_PLAN;
+
+    m->attr("HUGE_PAGE_NONE") = (uint32_t)HUGE_PAGE_NONE;
+    m->attr("HUGE_PAGE_TRANSPARENT") = (uint32_t)HUGE_PAGE_TRANSPARENT;
+    m->attr("HUGE_PAGE_HUGETLB") = (uint32_t)HUGE_PAGE_HUGETLB;
 }
 
 }}}} // namespace ppl::nn::python::x86
@@ -17,6 +17,7 @@
 
 #include "../../engines/py_engine.h"
 #include "../../runtime/py_runtime.h"
+#include "../../runtime/py_runtime_pool.h"
 #include "py_runtime_builder.h"
 #include "py_runtime_builder_resources.h"
 #include "ppl/nn/utils/file_data_stream.h"
@@ -71,6 +72,10 @@ void RegisterRuntimeBuilder(pybind11::module* m) {
              [](PyRuntimeBuilder& builder) -> PyRuntime {
                  return PyRuntime(builder.engines, builder.ptr->CreateRuntime());
              })
+        .def("CreateRuntimePool",
+             [](PyRuntimeBuilder& builder, const RuntimePoolOptions& options) -> PyRuntimePool {
+                 return PyRuntimePool(builder.engines, RuntimePoolFactory::Create(builder.ptr.get(), options));
+             })
         .def("Serialize",
              [](const PyRuntimeBuilder& builder, const char* output_file, const char* fmt,
                 const PyModelOptionsBase& opt_base) -> RetCode {
@@ -17,6 +17,7 @@
 
 #include "../../engines/py_engine.h"
 #include "../../runtime/py_runtime.h"
+#include "../../runtime/py_runtime_pool.h"
 #include "py_runtime_builder.h"
 #include "py_runtime_builder_resources.h"
 #include "py_load_model_options.h"
@@ -67,6 +68,10 @@ void RegisterRuntimeBuilder(pybind11::module* m) {
              [](PyRuntimeBuilder& builder) -> PyRuntime {
                  return PyRuntime(builder.engines, builder.ptr->CreateRuntime());
              })
+        .def("CreateRuntimePool",
+             [](PyRuntimeBuilder& builder, const RuntimePoolOptions& options) -> PyRuntimePool {
+                 return PyRuntimePool(builder.engines, RuntimePoolFactory::Create(builder.ptr.get(), options));
+             })
         .def("Serialize",
              [](const PyRuntimeBuilder& builder, const char* output_file, const char* fmt,
                 const PySaveModelOptions& py_opt) -> RetCode {
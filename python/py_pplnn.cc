@@ -54,6 +54,7 @@ void RegisterNdArray(pybind11::module*);
 void RegisterEngine(pybind11::module*);
 void RegisterDeviceContext(pybind11::module*);
 void RegisterRuntime(pybind11::module*);
+void RegisterRuntimePool(pybind11::module*);
 void RegisterVersion(pybind11::module*);
 void RegisterModelOptionsBase(pybind11::module*);
 void LoadResources(pybind11::module*);
@@ -66,6 +67,7 @@ PYBIND11_MODULE(nn, m) {
     RegisterEngine(&m);
     RegisterDeviceContext(&m);
     RegisterRuntime(&m);
+    RegisterRuntimePool(&m);
     RegisterVersion(&m);
     RegisterModelOptionsBase(&m);
 
@@ -37,10 +37,12 @@ void RegisterRuntime(pybind11::module* m) {
              [](const PyRuntime& runtime, uint32_t idx) -> PyTensor {
                  return PyTensor(runtime.ptr->GetInputTensor(idx));
              })
-        .def("Run",
-             [](const PyRuntime& runtime) -> RetCode {
-                 return runtime.ptr->Run();
-             })
+        .def(
+            "Run",
+            [](const PyRuntime& runtime) -> RetCode {
+                return runtime.ptr->Run();
+            },
+            pybind11::call_guard<pybind11::gil_scoped_release>())
         .def("GetOutputCount",
              [](const PyRuntime& runtime) -> uint32_t {
                  return runtime.ptr->GetOutputCount();
@@ -26,16 +26,21 @@
 namespace ppl { namespace nn { namespace python {
 
 struct PyRuntime final {
-    PyRuntime(const std::vector<std::shared_ptr<Engine>>& e, Runtime* r) : ptr(r), engines(e) {}
+    PyRuntime(const std::vector<std::shared_ptr<Engine>>& e, Runtime* r, bool owned = true)
+        : ptr(r), engines(e), is_owner(owned) {}
     PyRuntime(PyRuntime&&) = default;
     PyRuntime& operator=(PyRuntime&&) = default;
     ~PyRuntime() {
+        if (!is_owner) {
+            ptr.release();
+        }
         ptr.reset();
         engines.clear();
     }
 
     std::unique_ptr<Runtime> ptr;
     std::vector<std::shared_ptr<Engine>> engines; // retain engines
+    bool is_owner; // false if `ptr` belongs to a RuntimePool
 };
 
 }}} // namespace ppl::nn::python
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "py_runtime.h"
+#include "py_runtime_pool.h"
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace python {
+
+void RegisterRuntimePool(pybind11::module* m) {
+    pybind11::class_<RuntimePoolOptions>(*m, "RuntimePoolOptions")
+        .def(pybind11::init<>())
+        .def_readwrite("runtime_num", &RuntimePoolOptions::runtime_num)
+        .def_readwrite("cpu_sets", &RuntimePoolOptions::cpu_sets);
+
+    pybind11::class_<RuntimePoolStatistics>(*m, "RuntimePoolStatistics")
+        .def_readonly("runtime_num", &RuntimePoolStatistics::runtime_num)
+        .def_readonly("idle_runtime_num", &RuntimePoolStatistics::idle_runtime_num)
+        .def_readonly("queue_depth", &RuntimePoolStatistics::queue_depth)
+        .def_readonly("max_queue_depth", &RuntimePoolStatistics::max_queue_depth)
+        .def_readonly("acquire_count", &RuntimePoolStatistics::acquire_count)
+        .def_readonly("total_wait_microseconds", &RuntimePoolStatistics::total_wait_microseconds)
+        .def_readonly("max_wait_microseconds", &RuntimePoolStatistics::max_wait_microseconds);
+
+    pybind11::class_<PyRuntimePool>(*m, "RuntimePool")
+        .def("__bool__",
+             [](const PyRuntimePool& pool) -> bool {
+                 return (pool.ptr.get());
+             })
+        .def("GetRuntimeCount",
+             [](const PyRuntimePool& pool) -> uint32_t {
+                 return pool.ptr->GetRuntimeCount();
+             })
+        .def("Acquire",
+             [](PyRuntimePool& pool) -> PyRuntime {
+                 Runtime* runtime;
+                 {
+                     pybind11::gil_scoped_release no_gil;
+                     runtime = pool.ptr->Acquire();
+                 }
+                 return PyRuntime(pool.engines, runtime, false);
+             })
+        .def("TryAcquire",
+             [](PyRuntimePool& pool) -> PyRuntime {
+                 return PyRuntime(pool.engines, pool.ptr->TryAcquire(), false);
+             })
+        .def("Release",
+             [](PyRuntimePool& pool, PyRuntime& runtime) -> RetCode {
+                 auto rc = pool.ptr->Release(runtime.ptr.get());
+                 if (rc == RC_SUCCESS) {
+                     runtime.ptr.release();
+                 }
+                 return rc;
+             })
+        .def("GetStatistics", [](const PyRuntimePool& pool) -> pybind11::object {
+            RuntimePoolStatistics stat;
+            auto rc = pool.ptr->GetStatistics(&stat);
+            if (rc != RC_SUCCESS) {
+                return pybind11::none();
+            }
+            return pybind11::cast(stat);
+        });
+}
+
+}}} // namespace ppl::nn::python
@@ -130,6 +130,10 @@ void RegisterTensor(pybind11::module* m) {
              [](PyTensor& tensor, uint64_t ptr) -> void {
                  tensor.ptr->SetBufferPtr((void*)ptr);
              })
+        .def("BindHostBuffer",
+             [](PyTensor& tensor, uint64_t ptr, uint64_t bytes) -> RetCode {
+                 return tensor.ptr->BindHostBuffer((void*)ptr, bytes);
+             })
         .def("GetDeviceContext",
              [](const PyTensor& tensor) -> PyDeviceContext {
                  return PyDeviceContext(tensor.ptr->GetDeviceContext());
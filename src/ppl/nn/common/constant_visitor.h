@@ -30,6 +30,14 @@ public:
     virtual ppl::common::RetCode ForEach(const std::function<ppl::common::RetCode(edgeid_t, uint64_t bytes)>&) const = 0;
     virtual ppl::common::RetCode ForEach(const std::function<ppl::common::RetCode(const ir::Edge*, const void*, uint64_t,
                                                                                   const TensorShape&)>&) const = 0;
+
+    /**
+       @brief tells whether data passed to callbacks stays valid and unchanged until all runtimes sharing these
+       constants are released. if so, devices that can read host memory may refer to the data instead of copying it.
+    */
+    virtual bool IsDataPersistent() const {
+        return false;
+    }
 };
 
 }} // namespace ppl::nn
@@ -24,6 +24,7 @@
 #include "ppl/nn/common/buffer_desc.h"
 #include "ppl/nn/common/device_context.h"
 #include "ppl/nn/common/types.h"
+#include "ppl/nn/runtime/memory_statistics.h"
 
 namespace ppl { namespace nn {
 
@@ -50,6 +51,45 @@ public:
     /** @brief free `buffer` allocated by Realloc() */
     virtual void Free(BufferDesc* buffer) = 0;
 
+    /**
+       @brief gives cached memory that is not in use back to the system so that about `keep_bytes` bytes remain.
+       @return bytes released
+       @note MUST NOT be called during a run.
+    */
+    virtual uint64_t TrimMemory(uint64_t keep_bytes) {
+        return 0;
+    }
+
+    /** @brief fills memory usage of this device except `name` */
+    virtual ppl::common::RetCode GetMemoryStatistics(DeviceMemoryStatistics*) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    /**
+       @brief tells whether Realloc()/Free() and tmp buffer allocations of this device can be called from different
+       threads at the same time. kernels of a runtime are run concurrently only if all devices are concurrent-safe.
+    */
+    virtual bool IsConcurrentSafe() const {
+        return false;
+    }
+
+    /**
+       @brief runs threads used by kernels on this device on `cpu_ids`, one thread for each cpu. returns
+       RC_UNSUPPORTED if kernels do not run on cpu threads managed by this device.
+       @note MUST NOT be called during a run.
+    */
+    virtual ppl::common::RetCode BindCpus(const uint32_t* cpu_ids, uint32_t cpu_num) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    /**
+       @brief tells whether the host memory `addr` can be read/written by this device directly, which means that it can
+       be used as a buffer of tensors without copying.
+    */
+    virtual bool CanUseHostBuffer(const void* addr) const {
+        return false;
+    }
+
     /**
        @brief copy `bytes` bytes from `src` to `dst`
        @param dst pointer to data area on this device
@@ -184,23 +184,31 @@ RetCode LoadConstants(const ir::Graph& graph, Device* device, map<edgeid_t, Runt
     return RC_SUCCESS;
 }
 
-RetCode LoadConstants(const ConstantVisitor& visitor, Device* dev, map<edgeid_t, BufferInfo>* eid2info) {
-    return visitor.ForEach(
-        [eid2info, dev](const ir::Edge* edge, const void* data, uint64_t size, const TensorShape& shape) -> RetCode {
-            BufferInfo info;
+RetCode LoadConstants(const ConstantVisitor& visitor, Device* dev, map<edgeid_t, BufferInfo>* eid2info,
+                      bool allow_zero_copy) {
+    const bool zero_copy = (allow_zero_copy && visitor.IsDataPersistent());
+    return visitor.ForEach([eid2info, dev, zero_copy](const ir::Edge* edge, const void* data, uint64_t size,
+                                                      const TensorShape& shape) -> RetCode {
+        BufferInfo info;
+        if (zero_copy && dev->CanUseHostBuffer(data) && size >= shape.CalcBytesIncludingPadding()) {
+            // data is read only. kernels never write to constants.
+            info.SetDevice(dev);
+            info.SetBuffer(BufferDesc(const_cast<void*>(data)), dev, false);
+        } else {
             auto status = utils::GenericLoadConstant(data, size, shape, dev, &info);
             if (status != RC_SUCCESS) {
                 LOG(ERROR) << "load constant failed: " << GetRetCodeStr(status);
                 return status;
             }
+        }
 
-            auto ret_pair = eid2info->emplace(edge->GetId(), std::move(info));
-            if (!ret_pair.second) {
-                LOG(ERROR) << "constant[" << edge->GetName() << "] already exists.";
-                return RC_EXISTS;
-            }
-            return RC_SUCCESS;
-        });
+        auto ret_pair = eid2info->emplace(edge->GetId(), std::move(info));
+        if (!ret_pair.second) {
+            LOG(ERROR) << "constant[" << edge->GetName() << "] already exists.";
+            return RC_EXISTS;
+        }
+        return RC_SUCCESS;
+    });
 }
 
 }}} // namespace ppl::nn::utils
@@ -40,7 +40,12 @@ static inline ppl::common::RetCode CopyTensorBuffer(const TensorImpl& src, Tenso
 ppl::common::RetCode LoadConstants(const ir::Graph&, Device*, std::map<edgeid_t, RuntimeConstantInfo>*,
                                    const std::set<edgeid_t>* = nullptr);
 
-ppl::common::RetCode LoadConstants(const ConstantVisitor&, Device*, std::map<edgeid_t, BufferInfo>*);
+/**
+   @brief loads constants provided by `ConstantVisitor`. if `allow_zero_copy` is true, constants refer to persistent
+   data of the visitor directly when `Device::CanUseHostBuffer()` accepts it.
+*/
+ppl::common::RetCode LoadConstants(const ConstantVisitor&, Device*, std::map<edgeid_t, BufferInfo>*,
+                                   bool allow_zero_copy = true);
 
 ppl::common::RetCode GenericLoadConstant(const void* data, uint64_t size, const TensorShape& shape, Device* device,
                                          RuntimeConstantInfo* info, bool omit_data = false);
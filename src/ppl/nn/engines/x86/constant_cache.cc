@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/engines/x86/constant_cache.h"
+#include "ppl/nn/common/logger.h"
+#include <algorithm>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+constexpr uint64_t ConstantCache::MIN_CONSTANT_BYTES;
+
+ConstantCache::~ConstantCache() {
+    if (!entries_.empty()) {
+        LOG(WARNING) << "[" << entries_.size() << "] constants are still in use when the cache is destroyed.";
+    }
+}
+
+void ConstantCache::SetBudget(uint64_t bytes) {
+    lock_guard<mutex> __guard__(mutex_);
+    budget_bytes_ = bytes;
+    EvictFor(0);
+}
+
+shared_ptr<ConstantCache::Entry> ConstantCache::Register(const string& name, const void* data,
+                                                         const TensorShape& shape, const shared_ptr<void>& holder) {
+    auto entry = new Entry();
+    entry->cache = this;
+    entry->name = name;
+    entry->data = data;
+    entry->shape = shape;
+    entry->holder = holder;
+
+    {
+        lock_guard<mutex> __guard__(mutex_);
+        entry->pos = entries_.insert(entries_.end(), entry);
+    }
+
+    return shared_ptr<Entry>(entry, [](Entry* e) -> void {
+        e->cache->Unregister(e);
+        delete e;
+    });
+}
+
+void ConstantCache::Unregister(Entry* entry) {
+    lock_guard<mutex> __guard__(mutex_);
+    if (entry->buffer.addr) {
+        Evict(entry);
+    }
+    entries_.erase(entry->pos);
+}
+
+void ConstantCache::Evict(Entry* entry) {
+    used_bytes_ -= entry->shape.CalcBytesIncludingPadding();
+    lru_list_.erase(entry->lru_pos);
+    device_->Free(&entry->buffer);
+    entry->buffer.addr = nullptr;
+}
+
+void ConstantCache::EvictFor(uint64_t bytes) {
+    auto it = lru_list_.end();
+    while (used_bytes_ + bytes > budget_bytes_ && it != lru_list_.begin()) {
+        --it;
+        auto entry = *it;
+        if (entry->ref_count == 0) {
+            ++it; // `entry->lru_pos` is erased by Evict()
+            Evict(entry);
+            ++entry->evictions;
+        }
+    }
+}
+
+RetCode ConstantCache::Acquire(Entry* entry, BufferDesc* buffer) {
+    lock_guard<mutex> __guard__(mutex_);
+
+    if (entry->buffer.addr) {
+        ++entry->hits;
+        lru_list_.splice(lru_list_.begin(), lru_list_, entry->lru_pos);
+    } else {
+        const uint64_t bytes = entry->shape.CalcBytesIncludingPadding();
+        EvictFor(bytes);
+
+        auto status = device_->Realloc(entry->shape, &entry->buffer);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "alloc [" << bytes << "] bytes for constant[" << entry->name
+                       << "] failed: " << GetRetCodeStr(status);
+            return status;
+        }
+
+        status = device_->CopyFromHost(&entry->buffer, entry->data, entry->shape);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "copy constant[" << entry->name << "] failed: " << GetRetCodeStr(status);
+            device_->Free(&entry->buffer);
+            entry->buffer.addr = nullptr;
+            return status;
+        }
+
+        ++entry->misses;
+        used_bytes_ += bytes;
+        peak_used_bytes_ = std::max(peak_used_bytes_, used_bytes_);
+        entry->lru_pos = lru_list_.insert(lru_list_.begin(), entry);
+    }
+
+    ++entry->ref_count;
+    *buffer = entry->buffer;
+    return RC_SUCCESS;
+}
+
+void ConstantCache::Release(Entry* entry) {
+    lock_guard<mutex> __guard__(mutex_);
+    --entry->ref_count;
+    // constants used by running kernels may exceed the budget
+    EvictFor(0);
+}
+
+void ConstantCache::GetStatistics(ConstantCacheStatistics* stat) const {
+    lock_guard<mutex> __guard__(mutex_);
+
+    stat->budget_bytes = budget_bytes_;
+    stat->used_bytes = used_bytes_;
+    stat->peak_used_bytes = peak_used_bytes_;
+
+    stat->constant_info.clear();
+    stat->constant_info.reserve(entries_.size());
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        auto entry = *it;
+        ConstantCacheInfo info;
+        info.name = entry->name;
+        info.bytes = entry->shape.CalcBytesIncludingPadding();
+        info.hits = entry->hits;
+        info.misses = entry->misses;
+        info.evictions = entry->evictions;
+        stat->constant_info.emplace_back(std::move(info));
+    }
+}
+
+}}} // namespace ppl::nn::x86
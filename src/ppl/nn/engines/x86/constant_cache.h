@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_CONSTANT_CACHE_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_CONSTANT_CACHE_H_
+
+#include "ppl/nn/common/device.h"
+#include "ppl/nn/common/tensor_shape.h"
+#include "ppl/nn/engines/x86/constant_cache_statistics.h"
+#include <list>
+#include <mutex>
+#include <memory>
+
+namespace ppl { namespace nn { namespace x86 {
+
+/**
+   @brief constants that are copied from model data, e.g. mapped external data files, when they are used by kernels.
+   least recently used ones are evicted if bytes of constants in the cache exceed the budget.
+*/
+class ConstantCache final {
+public:
+    /** constants smaller than this are always loaded when graphs are processed */
+    static constexpr uint64_t MIN_CONSTANT_BYTES = 64 * 1024;
+
+    struct Entry final {
+        ConstantCache* cache;
+        std::string name;
+        const void* data;
+        TensorShape shape;
+        /** keeps `data` alive */
+        std::shared_ptr<void> holder;
+
+        BufferDesc buffer;
+        /** number of running kernels that use `buffer` */
+        uint32_t ref_count = 0;
+        /** valid if `buffer` is allocated */
+        std::list<Entry*>::iterator lru_pos;
+        std::list<Entry*>::iterator pos;
+
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+public:
+    ConstantCache(Device* device) : device_(device) {}
+    ~ConstantCache();
+
+    Device* GetDevice() const {
+        return device_;
+    }
+
+    /** @brief 0 means constants are loaded when graphs are processed */
+    void SetBudget(uint64_t bytes);
+    uint64_t GetBudget() const {
+        return budget_bytes_;
+    }
+
+    /** @brief the returned entry is removed from the cache when it is released */
+    std::shared_ptr<Entry> Register(const std::string& name, const void* data, const TensorShape& shape,
+                                    const std::shared_ptr<void>& holder);
+
+    /** @brief loads `entry` if it is not in the cache. `buffer` MUST NOT be used after calling Release(). */
+    ppl::common::RetCode Acquire(Entry* entry, BufferDesc* buffer);
+    void Release(Entry* entry);
+
+    void GetStatistics(ConstantCacheStatistics*) const;
+
+private:
+    void Unregister(Entry*);
+    /** @brief evicts unused entries until `bytes` more bytes fit in the budget. `mutex_` MUST be held. */
+    void EvictFor(uint64_t bytes);
+    void Evict(Entry*);
+
+private:
+    Device* device_;
+    uint64_t budget_bytes_ = 0;
+    uint64_t used_bytes_ = 0;
+    uint64_t peak_used_bytes_ = 0;
+
+    /** loaded entries. the most recently used one is at the front. */
+    std::list<Entry*> lru_list_;
+    /** all registered entries */
+    std::list<Entry*> entries_;
+    mutable std::mutex mutex_;
+
+private:
+    ConstantCache(const ConstantCache&) = delete;
+    ConstantCache& operator=(const ConstantCache&) = delete;
+};
+
+}}} // namespace ppl::nn::x86
+
+#endif
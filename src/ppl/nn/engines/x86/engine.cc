@@ -28,12 +28,19 @@
 #include "ppl/kernel/x86/common/simd_tools.h"
 #include "ppl/kernel/x86/common/general_include.h"
 
+#include "rapidjson/document.h"
+#include "rapidjson/error/error.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-X86Engine::X86Engine() : EngineImpl("x86"), device_(X86_DEFAULT_ALIGNMENT, ppl::common::GetCpuISA()) {
+X86Engine::X86Engine()
+    : EngineImpl("x86"), device_(X86_DEFAULT_ALIGNMENT, ppl::common::GetCpuISA()), constant_cache_(&device_) {
     if (OptKernelCreatorManager::GetInstance()->GetSize() == 0) {
         LOG(WARNING) << "Empty op implementation set. Did you forget to call `ppl::nn::x86::RegisterBuiltinOpImpls()` "
                         "before creating x86 engines?";
@@ -62,12 +69,29 @@ RetCode X86Engine::Init(const EngineOptions& options) {
         isa &= ~ppl::common::ISA_X86_AVX;
     }
     device_.SetISA(isa);
+
+    if (options_.huge_page_policy > HUGE_PAGE_HUGETLB) {
+        LOG(ERROR) << "invalid huge page policy [" << options_.huge_page_policy << "]";
+        return RC_INVALID_VALUE;
+    }
+    device_.SetHugePagePolicy(options_.huge_page_policy);
+
+    // constants are allocated by `device_`
+    if (options_.numa_node_id >= 0) {
+        if (IsNumaNodeAvailable(options_.numa_node_id)) {
+            device_.SetNumaNode(options_.numa_node_id);
+            LOG(INFO) << "x86 engine is bound to numa node [" << options_.numa_node_id << "].";
+        } else {
+            options_.numa_node_id = -1;
+        }
+    }
+
     return RC_SUCCESS;
 }
 
 EngineContext* X86Engine::CreateEngineContext() {
     auto ctx = new X86EngineContext();
-    auto rc = ctx->Init(device_.GetISA(), options_.mm_policy);
+    auto rc = ctx->Init(device_.GetISA(), options_);
     if (rc != RC_SUCCESS) {
         LOG(ERROR) << "init x86 engine context failed: " << GetRetCodeStr(rc);
         delete ctx;
@@ -81,7 +105,8 @@ bool X86Engine::Supports(const ir::Node* node) const {
     return (OptKernelCreatorManager::GetInstance()->Find(type.domain, type.name, type.version) != nullptr);
 }
 
-RetCode X86Engine::DoOptimize(const utils::SharedResource& resource, ir::Graph* graph, RuntimePartitionInfo* info) {
+RetCode X86Engine::DoOptimize(const utils::SharedResource& resource, ir::Graph* graph, RuntimePartitionInfo* info,
+                              const set<edgeid_t>* lazy_constants) {
     OptGraph opt_graph;
     auto status = opt_graph.Init(resource, graph, info);
     if (status != RC_SUCCESS) {
@@ -89,7 +114,7 @@ RetCode X86Engine::DoOptimize(const utils::SharedResource& resource, ir::Graph*
         return status;
     }
 
-    status = opt_graph.DoOptimize(resource, config_, &device_);
+    status = opt_graph.DoOptimize(resource, config_, &device_, &algo_selects_, lazy_constants);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "OptGraph DoOptimize failed: " << GetRetCodeStr(status);
         return status;
@@ -142,6 +167,151 @@ ppl::common::RetCode X86Engine::CalDataOmittedConstants(const ir::Graph& graph,
     return ppl::common::RC_SUCCESS;
 }
 
+/**
+   @brief selects constants that are loaded on demand. only read-only mappings, e.g. external data files of onnx
+   models, are selected, because other constants are already in memory and caching them only adds copies.
+*/
+void X86Engine::SelectLazyConstants(const ir::Graph& graph, set<edgeid_t>* lazy_constants) const {
+    auto topo = graph.topo.get();
+    auto graph_data = graph.data.get();
+
+    // outputs may be read by users directly
+    set<edgeid_t> graph_outputs;
+    for (uint32_t i = 0; i < topo->GetOutputCount(); ++i) {
+        graph_outputs.insert(topo->GetOutput(i));
+    }
+
+    for (uint32_t i = 0; i < topo->GetConstantCount(); ++i) {
+        auto eid = topo->GetConstant(i);
+        if (graph_outputs.find(eid) != graph_outputs.end()) {
+            continue;
+        }
+
+        // missing ones are reported by utils::LoadConstants()
+        auto constant_ref = graph_data->constants.find(eid);
+        auto shape_ref = graph_data->shapes.find(eid);
+        if (constant_ref == graph_data->constants.end() || shape_ref == graph_data->shapes.end()) {
+            continue;
+        }
+
+        auto& data = constant_ref->second.data;
+        if (data.GetPermission() & Mmap::WRITE) {
+            continue;
+        }
+
+        TensorShape shape;
+        utils::IrShape2TensorShape(shape_ref->second, &shape);
+        if (shape.CalcBytesIncludingPadding() < ConstantCache::MIN_CONSTANT_BYTES ||
+            data.GetSize() < shape.CalcBytesExcludingPadding()) {
+            continue;
+        }
+
+        lazy_constants->insert(eid);
+    }
+}
+
+RetCode X86Engine::RegisterLazyConstants(const set<edgeid_t>& lazy_constants, ir::Graph* graph,
+                                         RuntimePartitionInfo* info, set<edgeid_t>* data_omitted_constants) {
+    auto topo = graph->topo.get();
+    auto graph_data = graph->data.get();
+
+    map<edgeid_t, shared_ptr<ConstantCache::Entry>> eid2entry;
+    for (auto eid : lazy_constants) {
+        // converted by kernels, or removed by optimizations
+        if (data_omitted_constants->find(eid) != data_omitted_constants->end() || !topo->GetEdge(eid)) {
+            continue;
+        }
+        auto constant_ref = graph_data->constants.find(eid);
+        auto shape_ref = graph_data->shapes.find(eid);
+        if (constant_ref == graph_data->constants.end() || shape_ref == graph_data->shapes.end()) {
+            continue;
+        }
+
+        TensorShape shape;
+        utils::IrShape2TensorShape(shape_ref->second, &shape);
+
+        // the mapping is moved to the entry so that no other copy of the data is kept
+        auto holder = make_shared<Mmap>(std::move(constant_ref->second.data));
+        auto entry = constant_cache_.Register(topo->GetEdge(eid)->GetName(), holder->GetData(), shape, holder);
+        eid2entry.insert(make_pair(eid, entry));
+        data_omitted_constants->insert(eid);
+    }
+
+    if (eid2entry.empty()) {
+        return RC_SUCCESS;
+    }
+
+    for (auto it = info->kernels.begin(); it != info->kernels.end(); ++it) {
+        auto kernel = (X86OptKernel*)it->second.get();
+        auto node = kernel->GetNode();
+        for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+            auto entry_ref = eid2entry.find(node->GetInput(i));
+            if (entry_ref != eid2entry.end()) {
+                kernel->SetLazyConstant(i, entry_ref->second);
+            }
+        }
+    }
+
+    LOG(INFO) << "[" << eid2entry.size() << "] constants of graph[" << topo->GetName() << "] are loaded on demand.";
+    return RC_SUCCESS;
+}
+
+static void DumpAlgorithmsInfo(const map<string, uint32_t>& algos, rapidjson::StringBuffer* buffer) {
+    rapidjson::Document d;
+    rapidjson::Document::AllocatorType& allocator = d.GetAllocator();
+
+    d.SetObject();
+
+    for (auto s = algos.begin(); s != algos.end(); ++s) {
+        rapidjson::Value object(rapidjson::kObjectType);
+        object.AddMember("algo", s->second, allocator);
+        rapidjson::Value key_info(s->first.data(), s->first.size(), allocator);
+        d.AddMember(key_info, object, allocator);
+    }
+
+    rapidjson::Writer<rapidjson::StringBuffer> writer(*buffer);
+    d.Accept(writer);
+}
+
+static void ExportAlgorithmsInfo(const map<string, uint32_t>& algos, void (*func)(const char*, uint64_t, void*),
+                                 void* arg) {
+    rapidjson::StringBuffer buffer;
+    DumpAlgorithmsInfo(algos, &buffer);
+    func(buffer.GetString(), buffer.GetSize(), arg);
+}
+
+static RetCode ParseAlgorithmsInfo(const char* json_buffer, uint64_t buffer_size, map<string, uint32_t>* algos) {
+    rapidjson::Document d;
+    rapidjson::ParseResult ok = d.Parse(json_buffer, buffer_size);
+    if (!ok) {
+        LOG(ERROR) << "parse algo buffer failed: [" << rapidjson::GetParseError_En(ok.Code()) << "], offset["
+                   << ok.Offset() << "]";
+        return RC_INVALID_VALUE;
+    }
+
+    if (!d.IsObject()) {
+        LOG(ERROR) << "algo buffer content is not an object.";
+        return RC_INVALID_VALUE;
+    }
+
+    for (auto it = d.MemberBegin(); it != d.MemberEnd(); ++it) {
+        const string key(it->name.GetString(), it->name.GetStringLength());
+        if (!it->value.IsObject()) {
+            LOG(ERROR) << "value of object[" << key << "] is not an object.";
+            return RC_INVALID_VALUE;
+        }
+
+        auto ref = it->value.FindMember("algo");
+        if (ref == it->value.MemberEnd() || !ref->value.IsUint()) {
+            LOG(ERROR) << "cannot find algo of object[" << key << "]";
+            return RC_INVALID_VALUE;
+        }
+        (*algos)[key] = ref->value.GetUint();
+    }
+
+    return RC_SUCCESS;
+}
+
 RetCode X86Engine::ProcessGraph(const utils::SharedResource& resource, ir::Graph* graph, RuntimePartitionInfo* info) {
     auto status = NNOptimizerManager::GetInstance()->Process(graph);
     if (status != RC_SUCCESS) {
@@ -149,12 +319,21 @@ RetCode X86Engine::ProcessGraph(const utils::SharedResource& resource, ir::Graph
         return status;
     }
 
-    status = DoOptimize(resource, graph, info);
+    std::set<edgeid_t> lazy_constants;
+    if (config_.constant_cache_bytes > 0) {
+        SelectLazyConstants(*graph, &lazy_constants);
+    }
+
+    status = DoOptimize(resource, graph, info, &lazy_constants);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "DoOptimize failed: " << GetRetCodeStr(status);
         return status;
     }
 
+    if (export_algo_func_) {
+        ExportAlgorithmsInfo(algo_selects_, export_algo_func_, export_algo_arg_);
+    }
+
     std::set<edgeid_t> data_omitted_constants;
     status = CalDataOmittedConstants(*graph, *info, &data_omitted_constants);
     if (status != RC_SUCCESS) {
@@ -162,6 +341,14 @@ RetCode X86Engine::ProcessGraph(const utils::SharedResource& resource, ir::Graph
         return status;
     }
 
+    if (!lazy_constants.empty()) {
+        status = RegisterLazyConstants(lazy_constants, graph, info, &data_omitted_constants);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "RegisterLazyConstants failed: " << GetRetCodeStr(status);
+            return status;
+        }
+    }
+
     status = utils::LoadConstants(*graph, &device_, &info->constants, &data_omitted_constants);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "LoadConstants failed: " << GetRetCodeStr(status);
@@ -177,7 +364,9 @@ EngineImpl* X86Engine::Create() {
 
 #ifdef PPLNN_ENABLE_PMX_MODEL
 RetCode X86Engine::LoadConstants(const ConstantVisitor& visitor, map<edgeid_t, BufferInfo>* eid2info) {
-    return utils::LoadConstants(visitor, &device_, eid2info);
+    // mapped model files are neither bound to numa nodes nor backed by huge pages
+    const bool allow_zero_copy = (device_.GetNumaNode() < 0 && device_.GetHugePagePolicy() == HUGE_PAGE_NONE);
+    return utils::LoadConstants(visitor, &device_, eid2info, allow_zero_copy);
 }
 
 OptKernel* X86Engine::CreateOptKernel(const ir::Node* node) const {
@@ -194,9 +383,25 @@ OptKernel* X86Engine::CreateOptKernel(const ir::Node* node) const {
         LOG(ERROR) << "create kernel[" << node->GetName() << "] failed: oom.";
         return nullptr;
     }
+    opt_kernel->SetEngineConfig(&config_);
+    opt_kernel->SetDevice(&device_);
 
     return opt_kernel;
 }
+
+RetCode X86Engine::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    if (algo_selects_.empty()) {
+        return RC_SUCCESS;
+    }
+
+    rapidjson::StringBuffer buffer;
+    DumpAlgorithmsInfo(algo_selects_, &buffer);
+    return ds->Write(buffer.GetString(), buffer.GetSize());
+}
+
+RetCode X86Engine::DeserializeData(const void* base, uint64_t size) {
+    return ParseAlgorithmsInfo((const char*)base, size, &algo_selects_);
+}
 #endif
 
 /* -------------------------------------------------------------------------- */
@@ -217,10 +422,71 @@ RetCode X86Engine::SetDebugDataDir(X86Engine* engine, va_list args) {
     return RC_SUCCESS;
 }
 
+RetCode X86Engine::SetReshapeCache(X86Engine* engine, va_list args) {
+    engine->config_.enable_reshape_cache = va_arg(args, uint32_t) ? true : false;
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::SetAlgoTuning(X86Engine* engine, va_list args) {
+    engine->config_.enable_algo_tuning = va_arg(args, uint32_t) ? true : false;
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::ImportAlgorithmsFromBuffer(X86Engine* engine, va_list args) {
+    auto json_buffer = va_arg(args, const char*);
+    auto buffer_size = va_arg(args, uint64_t);
+
+    auto status = ParseAlgorithmsInfo(json_buffer, buffer_size, &engine->algo_selects_);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    LOG(DEBUG) << "Algo info size is " << engine->algo_selects_.size();
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::SetExportAlgorithmsHandler(X86Engine* engine, va_list args) {
+    typedef void (*callback_func_t)(const char*, uint64_t, void*);
+    engine->export_algo_func_ = va_arg(args, callback_func_t);
+    engine->export_algo_arg_ = va_arg(args, void*);
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::GetHugePageBytes(X86Engine* engine, va_list args) {
+    auto bytes = va_arg(args, uint64_t*);
+    *bytes = engine->device_.GetHugePageBytes();
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::SetConstantCacheBytes(X86Engine* engine, va_list args) {
+    engine->config_.constant_cache_bytes = va_arg(args, uint64_t);
+    engine->constant_cache_.SetBudget(engine->config_.constant_cache_bytes);
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::GetConstantCacheStatistics(X86Engine* engine, va_list args) {
+    auto stat = va_arg(args, ConstantCacheStatistics*);
+    engine->constant_cache_.GetStatistics(stat);
+    return RC_SUCCESS;
+}
+
+RetCode X86Engine::SetMaxFoldedConstantBytes(X86Engine* engine, va_list args) {
+    engine->config_.max_folded_constant_bytes = va_arg(args, uint64_t);
+    return RC_SUCCESS;
+}
+
 X86Engine::ConfHandlerFunc X86Engine::conf_handlers_[] = {
     X86Engine::SetGraphFusion,
     X86Engine::SetTenosrDebug,
     X86Engine::SetDebugDataDir,
+    X86Engine::SetReshapeCache,
+    X86Engine::SetAlgoTuning,
+    X86Engine::ImportAlgorithmsFromBuffer,
+    X86Engine::SetExportAlgorithmsHandler,
+    X86Engine::GetHugePageBytes,
+    X86Engine::SetConstantCacheBytes,
+    X86Engine::GetConstantCacheStatistics,
+    X86Engine::SetMaxFoldedConstantBytes,
 };
 
 RetCode X86Engine::Configure(uint32_t option, ...) {
@@ -22,6 +22,7 @@
 #include "ppl/nn/engines/x86/x86_device.h"
 #include "ppl/nn/engines/x86/engine_options.h"
 #include "ppl/nn/engines/x86/engine_config.h"
+#include "ppl/nn/engines/x86/constant_cache.h"
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -38,18 +39,18 @@ public:
 #ifdef PPLNN_ENABLE_PMX_MODEL
     ppl::common::RetCode LoadConstants(const ConstantVisitor&, std::map<edgeid_t, BufferInfo>*) override;
     OptKernel* CreateOptKernel(const ir::Node*) const override;
-    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override {
-        return ppl::common::RC_UNSUPPORTED;
-    }
-    ppl::common::RetCode DeserializeData(const void*, uint64_t) override {
-        return ppl::common::RC_UNSUPPORTED;
-    }
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const void*, uint64_t) override;
 #endif
 
 private:
-    ppl::common::RetCode DoOptimize(const utils::SharedResource&, ir::Graph*, RuntimePartitionInfo*);
+    ppl::common::RetCode DoOptimize(const utils::SharedResource&, ir::Graph*, RuntimePartitionInfo*,
+                                    const std::set<edgeid_t>* lazy_constants);
     ppl::common::RetCode CalDataOmittedConstants(const ir::Graph&, const RuntimePartitionInfo&,
                                                  std::set<edgeid_t>*) const;
+    void SelectLazyConstants(const ir::Graph&, std::set<edgeid_t>*) const;
+    ppl::common::RetCode RegisterLazyConstants(const std::set<edgeid_t>& lazy_constants, ir::Graph*,
+                                               RuntimePartitionInfo*, std::set<edgeid_t>* data_omitted_constants);
 
 private:
     /*
@@ -59,6 +60,14 @@ private:
     static ppl::common::RetCode SetGraphFusion(X86Engine*, va_list);
     static ppl::common::RetCode SetTenosrDebug(X86Engine*, va_list);
     static ppl::common::RetCode SetDebugDataDir(X86Engine*, va_list);
+    static ppl::common::RetCode SetReshapeCache(X86Engine*, va_list);
+    static ppl::common::RetCode SetAlgoTuning(X86Engine*, va_list);
+    static ppl::common::RetCode ImportAlgorithmsFromBuffer(X86Engine*, va_list);
+    static ppl::common::RetCode SetExportAlgorithmsHandler(X86Engine*, va_list);
+    static ppl::common::RetCode GetHugePageBytes(X86Engine*, va_list);
+    static ppl::common::RetCode SetConstantCacheBytes(X86Engine*, va_list);
+    static ppl::common::RetCode GetConstantCacheStatistics(X86Engine*, va_list);
+    static ppl::common::RetCode SetMaxFoldedConstantBytes(X86Engine*, va_list);
 
     typedef ppl::common::RetCode (*ConfHandlerFunc)(X86Engine*, va_list);
     static ConfHandlerFunc conf_handlers_[ENGINE_CONF_MAX];
@@ -67,6 +76,12 @@ private:
     X86Device device_;
     EngineOptions options_;
     EngineConfig config_;
+    ConstantCache constant_cache_;
+
+    /** key of a kernel's param and shapes => selected algorithm */
+    std::map<std::string, uint32_t> algo_selects_;
+    void (*export_algo_func_)(const char*, uint64_t, void*) = nullptr;
+    void* export_algo_arg_ = nullptr;
 };
 
 }}} // namespace ppl::nn::x86
@@ -19,12 +19,20 @@
 #define _ST_HPC_PPL_NN_ENGINES_X86_ENGINE_CONFIG_H_
 
 #include <string>
+#include <stdint.h>
 
 namespace ppl { namespace nn { namespace x86 {
 
 struct EngineConfig final {
     bool enable_graph_fusion = true;
     bool enable_tensor_debug = false;
+    bool enable_reshape_cache = false;
+    bool enable_algo_tuning = false;
+    /** 0 means all constants are loaded when graphs are processed */
+    uint64_t constant_cache_bytes = 0;
+    /** nodes whose inputs are all constants are evaluated when graphs are processed if bytes of every output do not
+        exceed this value. 0 means constant folding is disabled. */
+    uint64_t max_folded_constant_bytes = 16 * 1024 * 1024;
     std::string debug_data_dir = ".";
 };
 
@@ -22,12 +22,16 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode X86EngineContext::Init(isa_t isa, uint32_t mm_policy) {
-    if (mm_policy == MM_PLAIN) {
+RetCode X86EngineContext::Init(isa_t isa, const EngineOptions& options) {
+    if (options.mm_policy == MM_PLAIN) {
         device_ = make_shared<X86Device>(X86_DEFAULT_ALIGNMENT, isa);
+        device_->SetNumaNode(options.numa_node_id);
+        device_->SetHugePagePolicy(options.huge_page_policy);
     } else {
         auto dev = make_shared<RuntimeX86Device>(X86_DEFAULT_ALIGNMENT, isa);
-        auto rc = dev->Init(mm_policy);
+        dev->SetNumaNode(options.numa_node_id);
+        dev->SetHugePagePolicy(options.huge_page_policy);
+        auto rc = dev->Init(options.mm_policy);
         if (rc != RC_SUCCESS) {
             LOG(ERROR) << "init RuntimeX86Device failed: " << GetRetCodeStr(rc);
             return rc;
@@ -35,6 +39,24 @@ RetCode X86EngineContext::Init(isa_t isa, uint32_t mm_policy) {
         device_ = dev;
     }
 
+    auto cpu_ids = options.cpu_ids;
+    if (options.numa_node_id >= 0 && cpu_ids.empty()) {
+        auto rc = GetNumaNodeCpus(options.numa_node_id, &cpu_ids);
+        if (rc != RC_SUCCESS) {
+            LOG(ERROR) << "get cpus of numa node [" << options.numa_node_id << "] failed: " << GetRetCodeStr(rc);
+            return rc;
+        }
+    }
+
+    // each context has its own pool so that threads can be set for each runtime
+    thread_pool_.reset(new OmpThreadPool());
+    auto rc = thread_pool_->Init(options.thread_num, cpu_ids);
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "init OmpThreadPool failed: " << GetRetCodeStr(rc);
+        return rc;
+    }
+    device_->SetThreadPool(thread_pool_.get());
+
     return RC_SUCCESS;
 }
 
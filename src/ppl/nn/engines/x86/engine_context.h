@@ -19,6 +19,8 @@
 #define _ST_HPC_PPL_NN_ENGINES_X86_ENGINE_CONTEXT_H_
 
 #include "ppl/nn/engines/x86/runtime_x86_device.h"
+#include "ppl/nn/engines/x86/omp_thread_pool.h"
+#include "ppl/nn/engines/x86/engine_options.h"
 #include "ppl/nn/engines/engine_context.h"
 
 namespace ppl { namespace nn { namespace x86 {
@@ -29,7 +31,7 @@ class X86EngineContext final : public EngineContext {
 public:
     X86EngineContext() {}
 
-    ppl::common::RetCode Init(ppl::common::isa_t isa, uint32_t mm_policy);
+    ppl::common::RetCode Init(ppl::common::isa_t isa, const EngineOptions& options);
 
     Device* GetDevice() const override {
         return device_.get();
@@ -40,6 +42,7 @@ public:
     }
 
 private:
+    std::unique_ptr<OmpThreadPool> thread_pool_;
     std::shared_ptr<X86Device> device_;
 
 private:
@@ -17,27 +17,196 @@
 
 #include <fstream>
 #include <cctype>
+#include <cstring>
 
 #include "ppl/nn/engines/x86/kernel.h"
+#include "ppl/common/destructor.h"
 using namespace ppl::common;
 
 #ifdef PPLNN_ENABLE_KERNEL_PROFILING
-#include "ppl/common/destructor.h"
 #include <chrono>
 #endif
 
 namespace ppl { namespace nn { namespace x86 {
 
+constexpr uint64_t X86Kernel::MAX_SIGNATURE_DATA_BYTES;
+
+static bool IsSameShape(const TensorShape& a, const TensorShape& b) {
+    if (a.GetDataType() != b.GetDataType() || a.GetDataFormat() != b.GetDataFormat() ||
+        a.IsScalar() != b.IsScalar() || a.GetDimCount() != b.GetDimCount()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < a.GetDimCount(); ++i) {
+        if (a.GetDim(i) != b.GetDim(i)) {
+            return false;
+        }
+    }
+    return (a.CalcBytesIncludingPadding() == b.CalcBytesIncludingPadding());
+}
+
+/** output shapes of these ops depend on data of inputs that may be too large to be a part of the signature */
+static bool HasDataDependentOutputShape(const ir::Node::Type& type) {
+    if (!type.domain.empty()) {
+        return false;
+    }
+    return (type.name == "NonZero" || type.name == "NonMaxSuppression" || type.name == "If" || type.name == "Loop");
+}
+
+bool X86Kernel::IsReshapeCacheHit(const KernelExecContext& ctx) const {
+    if (ctx.GetInputCount() != cached_inputs_.size()) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < ctx.GetInputCount(); ++i) {
+        auto& sig = cached_inputs_[i];
+        auto tensor = ctx.GetInput<TensorImpl>(i);
+        if (!tensor) {
+            if (!sig.is_null) {
+                return false;
+            }
+            continue;
+        }
+
+        if (sig.is_null || !IsSameShape(*tensor->GetShape(), sig.shape)) {
+            return false;
+        }
+
+        if (!sig.data.empty()) {
+            auto data = tensor->GetBufferPtr<const char>();
+            if (!data || memcmp(data, sig.data.data(), sig.data.size()) != 0) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void X86Kernel::UpdateReshapeCache(const KernelExecContext& ctx) {
+    if (HasDataDependentOutputShape(GetNode()->GetType())) {
+        is_reshape_cache_valid_ = false;
+        return;
+    }
+
+    cached_inputs_.resize(ctx.GetInputCount());
+    for (uint32_t i = 0; i < ctx.GetInputCount(); ++i) {
+        auto& sig = cached_inputs_[i];
+        auto tensor = ctx.GetInput<TensorImpl>(i);
+        sig.data.clear();
+        if (!tensor) {
+            sig.is_null = true;
+            continue;
+        }
+
+        sig.is_null = false;
+        sig.shape = *tensor->GetShape();
+
+        auto bytes = sig.shape.CalcBytesIncludingPadding();
+        auto data = tensor->GetBufferPtr<const char>();
+        if (data && bytes > 0 && bytes <= MAX_SIGNATURE_DATA_BYTES) {
+            sig.data.assign(data, data + bytes);
+        }
+    }
+
+    cached_output_shapes_.resize(ctx.GetOutputCount());
+    for (uint32_t i = 0; i < ctx.GetOutputCount(); ++i) {
+        cached_output_shapes_[i] = *ctx.GetOutput<TensorImpl>(i)->GetShape();
+    }
+
+    is_reshape_cache_valid_ = true;
+}
+
 RetCode X86Kernel::BeforeExecute(KernelExecContext* ctx) {
+    // output shapes are the same as the previous run if shapes and small data of inputs are not changed
+    if (engine_config_->enable_reshape_cache && is_reshape_cache_valid_ && IsReshapeCacheHit(*ctx)) {
+        for (uint32_t i = 0; i < ctx->GetOutputCount(); ++i) {
+            *ctx->GetOutput<TensorImpl>(i)->GetShape() = cached_output_shapes_[i];
+        }
+        return RC_SUCCESS;
+    }
+
     auto status = Reshape(ctx);
     if (status != RC_SUCCESS) {
+        is_reshape_cache_valid_ = false;
         LOG(ERROR) << "reshape kernel[" << GetName() << "] failed: " << GetRetCodeStr(status);
         return status;
     }
 
+    if (engine_config_->enable_reshape_cache) {
+        UpdateReshapeCache(*ctx);
+    }
+
     return RC_SUCCESS;
 }
 
+bool X86Kernel::TryReuseInputBuffer(KernelExecContext* ctx, uint32_t idx, TensorImpl* output) {
+    auto input = ctx->GetInput<TensorImpl>(idx);
+    if (!input || !ctx->IsLastConsumerOfInput(idx) || input->GetType() != TENSORTYPE_NORMAL ||
+        !input->IsBufferOwner() || !input->GetBufferPtr() || input->GetDevice() != GetX86Device() ||
+        output->IsHostBufferBound()) {
+        return false;
+    }
+
+    // the buffer is still read via other inputs if the same tensor is used more than once
+    auto node = GetNode();
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        if (i != idx && node->GetInput(i) == node->GetInput(idx)) {
+            return false;
+        }
+    }
+
+    auto in_shape = input->GetShape();
+    auto out_shape = output->GetShape();
+    if (in_shape->GetDataFormat() != out_shape->GetDataFormat() ||
+        GetSizeOfDataType(in_shape->GetDataType()) != GetSizeOfDataType(out_shape->GetDataType()) ||
+        in_shape->IsScalar() != out_shape->IsScalar() || in_shape->GetDimCount() != out_shape->GetDimCount() ||
+        in_shape->CalcBytesIncludingPadding() != out_shape->CalcBytesIncludingPadding()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < in_shape->GetDimCount(); ++i) {
+        if (in_shape->GetDim(i) != out_shape->GetDim(i)) {
+            return false;
+        }
+    }
+
+    output->TransferBufferFrom(input);
+    return true;
+}
+
+RetCode X86Kernel::AcquireLazyConstants(KernelExecContext* ctx) {
+    auto& lazy_constants = common_param_->lazy_constants;
+    for (uint32_t i = 0; i < lazy_constants.size(); ++i) {
+        auto entry = lazy_constants[i].get();
+        if (!entry) {
+            continue;
+        }
+
+        BufferDesc buffer;
+        auto status = entry->cache->Acquire(entry, &buffer);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "load constant[" << entry->name << "] failed: " << GetRetCodeStr(status);
+            ReleaseLazyConstants(i);
+            return status;
+        }
+
+        // the tensor is not reset after Release() because it may be used by other kernels running in parallel.
+        // they all set it before execution.
+        ctx->GetInput<TensorImpl>(i)->SetBuffer(buffer, entry->cache->GetDevice());
+    }
+
+    return RC_SUCCESS;
+}
+
+void X86Kernel::ReleaseLazyConstants(uint32_t input_count) {
+    auto& lazy_constants = common_param_->lazy_constants;
+    for (uint32_t i = 0; i < input_count; ++i) {
+        auto entry = lazy_constants[i].get();
+        if (entry) {
+            entry->cache->Release(entry);
+        }
+    }
+}
+
 bool X86Kernel::CanDoExecute(const KernelExecContext& ctx) const {
     for (uint32_t i = 0; i < ctx.GetInputCount(); ++i) {
         auto tensor = ctx.GetInput<TensorImpl>(i);
@@ -127,7 +296,27 @@ RetCode X86Kernel::Execute(KernelExecContext* ctx) {
     });
 #endif
 
-    auto status = BeforeExecute(ctx);
+    auto thread_pool = GetX86Device()->GetThreadPool();
+    if (thread_pool) {
+        thread_pool->Activate(ctx->GetWorkerIndex(), ctx->GetWorkerNum());
+    }
+
+    RetCode status;
+    const bool has_lazy_constants = (common_param_ && !common_param_->lazy_constants.empty());
+    if (has_lazy_constants) {
+        status = AcquireLazyConstants(ctx);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "AcquireLazyConstants() of kernel[" << GetName() << "] failed: " << GetRetCodeStr(status);
+            return status;
+        }
+    }
+    Destructor __lazy_constants_guard__([has_lazy_constants, this]() -> void {
+        if (has_lazy_constants) {
+            ReleaseLazyConstants(common_param_->lazy_constants.size());
+        }
+    });
+
+    status = BeforeExecute(ctx);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "BeforeExecute() of kernel[" << GetName() << "] failed: " << GetRetCodeStr(status);
         return status;
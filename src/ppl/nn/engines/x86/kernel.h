@@ -67,6 +67,14 @@ protected:
         return 0;
     }
 
+    /**
+       @brief lets `output` take over the buffer of input `idx` if this kernel is the last consumer of that input and
+       they have the same dims, data format and element size. kernels that read each element before writing the same
+       position, e.g. element-wise ones, can run in place this way.
+       @return true if the buffer is taken over, and data of that input MUST be read via `output`.
+    */
+    bool TryReuseInputBuffer(KernelExecContext* ctx, uint32_t idx, TensorImpl* output);
+
     bool MayUseISA(uint32_t flag) const {
         return !!(GetX86Device()->GetISA() & flag);
     }
@@ -94,13 +102,34 @@ private:
 #endif
 
 private:
+    /** inputs that may be read by `reshape_func_` are small, e.g. shape of Reshape or k of TopK */
+    static constexpr uint64_t MAX_SIGNATURE_DATA_BYTES = 256;
+
+    struct InputSignature final {
+        bool is_null;
+        TensorShape shape;
+        /** data of small inputs */
+        std::vector<char> data;
+    };
+
     ppl::common::RetCode BeforeExecute(KernelExecContext*);
+    /** @brief loads inputs that are in `X86CommonParam::lazy_constants` and sets them to `ctx` */
+    ppl::common::RetCode AcquireLazyConstants(KernelExecContext* ctx);
+    void ReleaseLazyConstants(uint32_t input_count);
     ppl::common::RetCode DumpOutputTensors(KernelExecContext*);
+    bool IsReshapeCacheHit(const KernelExecContext&) const;
+    void UpdateReshapeCache(const KernelExecContext&);
 
 private:
     const X86CommonParam* common_param_;
     const EngineConfig* engine_config_;
     std::function<ppl::common::RetCode(InputOutputInfo*)> reshape_func_;
+
+    // ----- reshape cache ----- //
+
+    bool is_reshape_cache_valid_ = false;
+    std::vector<InputSignature> cached_inputs_;
+    std::vector<TensorShape> cached_output_shapes_;
 };
 
 }}} // namespace ppl::nn::x86
@@ -31,7 +31,12 @@ ppl::common::RetCode AbsKernel::DoExecute(KernelExecContext* ctx) {
 
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    auto lX = X;
+    if (TryReuseInputBuffer(ctx, 0, Y)) {
+        lX = Y;
+    } else {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    }
     PPLNN_X86_DEBUG_TRACE("Output [Y]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(Y);
 
@@ -39,7 +44,7 @@ ppl::common::RetCode AbsKernel::DoExecute(KernelExecContext* ctx) {
 
     if (data_type == ppl::common::DATATYPE_FLOAT32) {
         return ppl::kernel::x86::abs_fp32(
-            GetISA(), X->GetShape(), X->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
+            GetISA(), X->GetShape(), lX->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
     } else {
         LOG(ERROR) << "unsupported datatype: " << ppl::common::GetDataTypeStr(data_type) << ".";
     }
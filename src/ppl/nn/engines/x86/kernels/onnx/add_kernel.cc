@@ -17,7 +17,6 @@
 
 #include "ppl/nn/engines/x86/kernels/onnx/add_kernel.h"
 #include "ppl/nn/common/logger.h"
-#include "ppl/nn/engines/x86/utils.h"
 
 #include "ppl/kernel/x86/fp32/arithmetic.h"
 #include "ppl/kernel/x86/int64/arithmetic.h"
@@ -48,11 +47,9 @@ ppl::common::RetCode AddKernel::DoExecute(KernelExecContext* ctx) {
 
     auto lA = A;
     auto lB = B;
-    if (ctx->IsLastConsumerOfInput(0) && A->GetType() == TENSORTYPE_NORMAL && TensorShapeEqual(*A->GetShape(), *C->GetShape())) {
-        C->TransferBufferFrom(A);
+    if (TryReuseInputBuffer(ctx, 0, C)) {
         lA = C;
-    } else if (ctx->IsLastConsumerOfInput(1) && B->GetType() == TENSORTYPE_NORMAL && TensorShapeEqual(*B->GetShape(), *C->GetShape())) {
-        C->TransferBufferFrom(B);
+    } else if (TryReuseInputBuffer(ctx, 1, C)) {
         lB = C;
     } else {
         PPLNN_X86_REALLOC_TENSOR_BUFFER(C);
@@ -33,11 +33,7 @@ ppl::common::RetCode CastKernel::DoExecute(KernelExecContext* ctx) {
     PPLNN_X86_DEBUG_TRACE("to: %d\n", param_->to);
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    if (ppl::common::GetSizeOfDataType(input->GetShape()->GetDataType()) == ppl::common::GetSizeOfDataType(output->GetShape()->GetDataType())
-        && ctx->IsLastConsumerOfInput(0)
-        && input->GetType() == TENSORTYPE_NORMAL) {
-        // inplace
-        output->TransferBufferFrom(input);
+    if (TryReuseInputBuffer(ctx, 0, output)) {
         PPLNN_X86_DEBUG_TRACE("Output [output]:\n");
         PPL_X86_TENSOR_PRINT_DEBUG_MSG(output);
         if (input->GetShape()->GetDataType() == output->GetShape()->GetDataType()) {
@@ -31,7 +31,12 @@ ppl::common::RetCode CeilKernel::DoExecute(KernelExecContext* ctx) {
 
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    auto linput = input;
+    if (TryReuseInputBuffer(ctx, 0, output)) {
+        linput = output;
+    } else {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    }
     PPLNN_X86_DEBUG_TRACE("Output [output]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(output);
 
@@ -39,13 +44,13 @@ ppl::common::RetCode CeilKernel::DoExecute(KernelExecContext* ctx) {
 
     if (data_type == ppl::common::DATATYPE_FLOAT32) {
         if (MayUseISA(ppl::common::ISA_X86_FMA)) {
-            return ppl::kernel::x86::ceil_fp32_avx(input->GetShape(), input->GetBufferPtr<float>(),
+            return ppl::kernel::x86::ceil_fp32_avx(input->GetShape(), linput->GetBufferPtr<float>(),
                                                    output->GetBufferPtr<float>());
         } else if (MayUseISA(ppl::common::ISA_X86_SSE)) {
-            return ppl::kernel::x86::ceil_fp32_sse(input->GetShape(), input->GetBufferPtr<float>(),
+            return ppl::kernel::x86::ceil_fp32_sse(input->GetShape(), linput->GetBufferPtr<float>(),
                                                    output->GetBufferPtr<float>());
         } else {
-            return ppl::kernel::x86::ceil_fp32(input->GetShape(), input->GetBufferPtr<float>(),
+            return ppl::kernel::x86::ceil_fp32(input->GetShape(), linput->GetBufferPtr<float>(),
                                                output->GetBufferPtr<float>());
         }
     } else {
@@ -64,15 +64,20 @@ ppl::common::RetCode ClipKernel::DoExecute(KernelExecContext* ctx) {
     PPLNN_X86_DEBUG_TRACE("max_val: %f\n", max_val);
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    auto linput = input;
+    if (TryReuseInputBuffer(ctx, 0, output)) {
+        linput = output;
+    } else {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    }
     PPLNN_X86_DEBUG_TRACE("Output [output]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(output);
 
     if (MayUseISA(ppl::common::ISA_X86_AVX)) {
-        return ppl::kernel::x86::clip_fp32_avx(input->GetShape(), input->GetBufferPtr<float>(), min_val, max_val,
+        return ppl::kernel::x86::clip_fp32_avx(input->GetShape(), linput->GetBufferPtr<float>(), min_val, max_val,
                                                output->GetBufferPtr<float>());
     } else if (MayUseISA(ppl::common::ISA_X86_SSE)) {
-        return ppl::kernel::x86::clip_fp32_sse(input->GetShape(), input->GetBufferPtr<float>(), min_val, max_val,
+        return ppl::kernel::x86::clip_fp32_sse(input->GetShape(), linput->GetBufferPtr<float>(), min_val, max_val,
                                                output->GetBufferPtr<float>());
     } else {
         LOG(ERROR) << "get unsupported isa " << GetISA();
@@ -16,8 +16,10 @@
 // under the License.
 
 #include "ppl/nn/engines/x86/kernels/onnx/gemm_kernel.h"
+#include "ppl/nn/engines/x86/kernels/pmx/gelu_kernel.h"
 #include "ppl/common/destructor.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
+#include <algorithm>
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -47,6 +49,7 @@ ppl::common::RetCode GemmKernel::DoExecute(KernelExecContext* ctx) {
     PPLNN_X86_DEBUG_TRACE("alpha: %f\n", param_->alpha);
     PPLNN_X86_DEBUG_TRACE("beta: %f\n", param_->beta);
     PPLNN_X86_DEBUG_TRACE("post: %d\n", param_->post);
+    PPLNN_X86_DEBUG_TRACE("fuse_gelu: %d, approximate: %d\n", param_->fuse_gelu, param_->gelu_approximate);
     PPLNN_X86_DEBUG_TRACE("packed_b: %p\n", param_->packed_b);
     PPLNN_X86_DEBUG_TRACE("M, N, K: %ld, %ld, %ld\n", M ,N, K);
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", isa);
@@ -103,11 +106,35 @@ ppl::common::RetCode GemmKernel::DoExecute(KernelExecContext* ctx) {
         }
     }
 
-    return ppl::kernel::x86::gemm_fp32(
-        isa, A_data, B_data, bias_data, sum_data,
-        typeA, typeB, typebias, typesum, M, N, K,
-        lda, ldb, ldy, ldsum, param_->alpha, 0.0f,
-        param_->beta, param_->beta, param_->post, Y_data);
+    if (!param_->fuse_gelu) {
+        return ppl::kernel::x86::gemm_fp32(
+            isa, A_data, B_data, bias_data, sum_data,
+            typeA, typeB, typebias, typesum, M, N, K,
+            lda, ldb, ldy, ldsum, param_->alpha, 0.0f,
+            param_->beta, param_->beta, param_->post, Y_data);
+    }
+
+    // gelu is not one of gemm_fp32's post-ops. Y is computed in blocks of rows and gelu is applied to each block
+    // while it is still in cache.
+    const int64_t block_m = GeluEpilogueBlockM(N);
+    for (int64_t m = 0; m < M; m += block_m) {
+        const int64_t m_eff = std::min(block_m, M - m);
+        auto block_A = param_->trans_a ? A_data + m : A_data + m * lda;
+        auto block_sum = sum_data ? sum_data + m * ldsum : nullptr;
+        auto block_bias = (bias_data && typebias == ppl::kernel::x86::gemm_v_type::COL_VEC) ? bias_data + m
+                                                                                            : bias_data;
+        auto block_Y = Y_data + m * ldy;
+        auto status = ppl::kernel::x86::gemm_fp32(
+            isa, block_A, B_data, block_bias, block_sum,
+            typeA, typeB, typebias, typesum, m_eff, N, K,
+            lda, ldb, ldy, ldsum, param_->alpha, 0.0f,
+            param_->beta, param_->beta, param_->post, block_Y);
+        if (status != ppl::common::RC_SUCCESS) {
+            return status;
+        }
+        GeluFp32(block_Y, m_eff * ldy, param_->gelu_approximate, block_Y);
+    }
+    return ppl::common::RC_SUCCESS;
 }
 
 }}} // namespace ppl::nn::x86
@@ -33,8 +33,7 @@ ppl::common::RetCode HardSwishKernel::DoExecute(KernelExecContext* ctx) {
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", isa);
 
     auto lx = x;
-    if (ctx->IsLastConsumerOfInput(0) && x->GetType() == TENSORTYPE_NORMAL) {
-        y->TransferBufferFrom(x);
+    if (TryReuseInputBuffer(ctx, 0, y)) {
         lx = y;
     } else {
         PPLNN_X86_REALLOC_TENSOR_BUFFER(y);
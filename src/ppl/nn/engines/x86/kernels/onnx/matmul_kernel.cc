@@ -16,14 +16,17 @@
 // under the License.
 
 #include "ppl/nn/engines/x86/kernels/onnx/matmul_kernel.h"
+#include "ppl/nn/engines/x86/kernels/pmx/gelu_kernel.h"
 #include "ppl/common/destructor.h"
 #include "ppl/kernel/x86/fp32/matmul.h"
+#include <algorithm>
 
 namespace ppl { namespace nn { namespace x86 {
 
 ppl::common::RetCode MatMulKernel::DoExecute(KernelExecContext* ctx) {
     PPLNN_X86_REQUIRED_INPUT(A, 0);
     PPLNN_X86_REQUIRED_INPUT(B, 1);
+    PPLNN_X86_OPTIONAL_INPUT(bias, 2);
     PPLNN_X86_REQUIRED_OUTPUT(Y, 0);
 
     PPLNN_X86_DEBUG_TRACE("Op: %s\n", GetName().c_str());
@@ -31,7 +34,13 @@ ppl::common::RetCode MatMulKernel::DoExecute(KernelExecContext* ctx) {
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(A);
     PPLNN_X86_DEBUG_TRACE("Input [B]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(B);
+    if (bias) {
+        PPLNN_X86_DEBUG_TRACE("Input [bias]:\n");
+        PPL_X86_TENSOR_PRINT_DEBUG_MSG(bias);
+    }
 
+    PPLNN_X86_DEBUG_TRACE("post: %d\n", param_->post);
+    PPLNN_X86_DEBUG_TRACE("fuse_gelu: %d, approximate: %d\n", param_->fuse_gelu, param_->gelu_approximate);
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
     PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
@@ -41,8 +50,48 @@ ppl::common::RetCode MatMulKernel::DoExecute(KernelExecContext* ctx) {
     const auto data_type = A->GetShape()->GetDataType();
     const auto data_format = A->GetShape()->GetDataFormat();
 
-    if (data_type == ppl::common::DATATYPE_FLOAT32 && data_format == ppl::common::DATAFORMAT_NDARRAY) {
-        return kernel::x86::matmul_ndarray_fp32(
+    ppl::common::RetCode status;
+    if (data_type == ppl::common::DATATYPE_FLOAT32 && data_format == ppl::common::DATAFORMAT_NDARRAY &&
+        (bias || param_->post != ppl::kernel::x86::gemm_post::NONE || (param_->fuse_gelu && param_->packed_b))) {
+        // fused bias and activation need packed B, which is a 2D matrix. batches of A are computed as one matrix.
+        if (!param_->packed_b) {
+            LOG(ERROR) << "fused bias or activation of matmul[" << GetName() << "] needs packed matrix-B.";
+            return ppl::common::RC_INVALID_VALUE;
+        }
+
+        const int64_t N = B->GetShape()->GetDim(B->GetShape()->GetDimCount() - 1);
+        const int64_t K = A->GetShape()->GetDim(A->GetShape()->GetDimCount() - 1);
+        const int64_t M = Y->GetShape()->CalcElementsExcludingPadding() / N;
+
+        const float* bias_data = nullptr;
+        ppl::kernel::x86::gemm_v_type_t typebias = ppl::kernel::x86::gemm_v_type::EMPTY;
+        if (bias) {
+            bias_data = bias->GetBufferPtr<const float>();
+            typebias = bias->GetShape()->CalcElementsExcludingPadding() == 1 ? ppl::kernel::x86::gemm_v_type::SCALAR
+                                                                             : ppl::kernel::x86::gemm_v_type::ROW_VEC;
+        }
+
+        // gelu is not one of gemm_fp32's post-ops. Y is computed in blocks of rows and gelu is applied to each block
+        // while it is still in cache.
+        const int64_t block_m = param_->fuse_gelu ? GeluEpilogueBlockM(N) : M;
+        for (int64_t m = 0; m < M; m += block_m) {
+            const int64_t m_eff = std::min(block_m, M - m);
+            auto block_Y = Y->GetBufferPtr<float>() + m * N;
+            status = ppl::kernel::x86::gemm_fp32(
+                GetISA(), A->GetBufferPtr<const float>() + m * K, param_->packed_b, bias_data, nullptr,
+                ppl::kernel::x86::gemm_m_type::NOTRANS, ppl::kernel::x86::gemm_m_type::PACKED, typebias,
+                ppl::kernel::x86::gemm_m_type::EMPTY, m_eff, N, K, K, N, N, 0, 1.0f, 0.0f, 1.0f, 0.0f, param_->post,
+                block_Y);
+            if (status != ppl::common::RC_SUCCESS) {
+                return status;
+            }
+            if (param_->fuse_gelu) {
+                GeluFp32(block_Y, m_eff * N, param_->gelu_approximate, block_Y);
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    } else if (data_type == ppl::common::DATATYPE_FLOAT32 && data_format == ppl::common::DATAFORMAT_NDARRAY) {
+        status = kernel::x86::matmul_ndarray_fp32(
             GetISA(), A->GetShape(), B->GetShape(), Y->GetShape(),
             A->GetBufferPtr<float>(),
             param_->packed_b ? param_->packed_b : B->GetBufferPtr<float>(),
@@ -50,9 +99,15 @@ ppl::common::RetCode MatMulKernel::DoExecute(KernelExecContext* ctx) {
             Y->GetBufferPtr<float>());
     } else {
         LOG(ERROR) << "only support fp32 ndarray now.";
+        return ppl::common::RC_UNSUPPORTED;
     }
 
-    return ppl::common::RC_UNSUPPORTED;
+    // without packed B gelu cannot be applied per block. it runs over the whole output right after matmul.
+    if (status == ppl::common::RC_SUCCESS && param_->fuse_gelu) {
+        GeluFp32(Y->GetBufferPtr<const float>(), Y->GetShape()->CalcElementsExcludingPadding(),
+                 param_->gelu_approximate, Y->GetBufferPtr<float>());
+    }
+    return status;
 }
 
 }}} // namespace ppl::nn::x86
@@ -32,7 +32,12 @@ ppl::common::RetCode NegKernel::DoExecute(KernelExecContext* ctx) {
 
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    auto lX = X;
+    if (TryReuseInputBuffer(ctx, 0, Y)) {
+        lX = Y;
+    } else {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    }
     PPLNN_X86_DEBUG_TRACE("Output [Y]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(Y);
 
@@ -40,10 +45,10 @@ ppl::common::RetCode NegKernel::DoExecute(KernelExecContext* ctx) {
 
     if (data_type == ppl::common::DATATYPE_FLOAT32) {
         return ppl::kernel::x86::neg_fp32(
-            GetISA(), X->GetShape(), X->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
+            GetISA(), X->GetShape(), lX->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
     } if (data_type == ppl::common::DATATYPE_INT64) {
         return ppl::kernel::x86::neg_int64(
-            GetISA(), X->GetShape(), X->GetBufferPtr<int64_t>(), Y->GetBufferPtr<int64_t>());
+            GetISA(), X->GetShape(), lX->GetBufferPtr<int64_t>(), Y->GetBufferPtr<int64_t>());
     } else {
         LOG(ERROR) << "unsupported datatype: " << ppl::common::GetDataTypeStr(data_type) << ".";
     }
@@ -32,7 +32,12 @@ RetCode ReluKernel::DoExecute(KernelExecContext* ctx) {
 
     PPLNN_X86_DEBUG_TRACE("isa: %u\n", GetISA());
 
-    PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    auto lX = X;
+    if (TryReuseInputBuffer(ctx, 0, Y)) {
+        lX = Y;
+    } else {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(Y);
+    }
     PPLNN_X86_DEBUG_TRACE("Output [Y]:\n");
     PPL_X86_TENSOR_PRINT_DEBUG_MSG(Y);
 
@@ -40,9 +45,9 @@ RetCode ReluKernel::DoExecute(KernelExecContext* ctx) {
 
     if (data_type == ppl::common::DATATYPE_FLOAT32) {
         if (MayUseISA(ppl::common::ISA_X86_AVX)) {
-            return ppl::kernel::x86::relu_fp32_avx(X->GetShape(), X->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
+            return ppl::kernel::x86::relu_fp32_avx(X->GetShape(), lX->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
         } else if (MayUseISA(ppl::common::ISA_X86_SSE)) {
-            return ppl::kernel::x86::relu_fp32_sse(X->GetShape(), X->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
+            return ppl::kernel::x86::relu_fp32_sse(X->GetShape(), lX->GetBufferPtr<float>(), Y->GetBufferPtr<float>());
         } else {
             LOG(ERROR) << "get unsupported isa " << GetISA();
         }
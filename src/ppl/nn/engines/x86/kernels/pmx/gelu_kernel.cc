@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/kernels/pmx/gelu_kernel.h"
+#include "ppl/nn/common/logger.h"
+#include <algorithm>
+
+namespace ppl { namespace nn { namespace x86 {
+
+// rational approximations of erf and tanh without calls to libm, so that loops using them can be vectorized.
+// erf(x) and tanh(x) are +/-1 in fp32 outside the clamped ranges.
+
+static inline float FastErf(float x) {
+    x = std::min(std::max(x, -4.0f), 4.0f);
+    const float x2 = x * x;
+
+    float p = x2 * -2.72614225801306e-10f + 2.77068142495902e-08f;
+    p = x2 * p + -2.10102402082508e-06f;
+    p = x2 * p + -5.69250639462346e-05f;
+    p = x2 * p + -7.34990630326855e-04f;
+    p = x2 * p + -2.95459980854025e-03f;
+    p = x2 * p + -1.60960333262415e-02f;
+    p = x * p;
+
+    float q = x2 * -1.45660718464996e-05f + -2.13374055278905e-04f;
+    q = x2 * q + -1.68282697438203e-03f;
+    q = x2 * q + -7.37332916720468e-03f;
+    q = x2 * q + -1.42647390514189e-02f;
+
+    return p / q;
+}
+
+static inline float FastTanh(float x) {
+    x = std::min(std::max(x, -7.90531110763549805f), 7.90531110763549805f);
+    const float x2 = x * x;
+
+    float p = x2 * -2.76076847742355e-16f + 2.00018790482477e-13f;
+    p = x2 * p + -8.60467152213735e-11f;
+    p = x2 * p + 5.12229709037114e-08f;
+    p = x2 * p + 1.48572235717979e-05f;
+    p = x2 * p + 6.37261928875436e-04f;
+    p = x2 * p + 4.89352455891786e-03f;
+    p = x * p;
+
+    float q = x2 * 1.19825839466702e-06f + 1.18534705686654e-04f;
+    q = x2 * q + 2.26843463243900e-03f;
+    q = x2 * q + 4.89352518554385e-03f;
+
+    return p / q;
+}
+
+// smaller inputs, e.g. blocks of a small gemm epilogue, run on the calling thread to avoid forking threads for them
+static const int64_t g_gelu_parallel_min_elements = 16384;
+
+void GeluFp32(const float* x, int64_t n, bool approximate, float* y) {
+    if (approximate) {
+        const float sqrt_2_over_pi = 0.7978845608028654f;
+#ifdef PPL_USE_X86_OMP
+#pragma omp parallel for schedule(static) if (n >= g_gelu_parallel_min_elements)
+#endif
+        for (int64_t i = 0; i < n; ++i) {
+            const float v = x[i];
+            y[i] = 0.5f * v * (1.0f + FastTanh(sqrt_2_over_pi * (v + 0.044715f * v * v * v)));
+        }
+    } else {
+        const float rsqrt_2 = 0.7071067811865476f;
+#ifdef PPL_USE_X86_OMP
+#pragma omp parallel for schedule(static) if (n >= g_gelu_parallel_min_elements)
+#endif
+        for (int64_t i = 0; i < n; ++i) {
+            const float v = x[i];
+            y[i] = 0.5f * v * (1.0f + FastErf(v * rsqrt_2));
+        }
+    }
+}
+
+int64_t GeluEpilogueBlockM(int64_t n) {
+    // about 1MB of output per block, rounded up to a multiple of 16 rows to keep the gemm blocking intact
+    const int64_t block_bytes = 1024 * 1024;
+    const int64_t block_m = block_bytes / (n * sizeof(float));
+    return std::max<int64_t>(16, (block_m + 15) / 16 * 16);
+}
+
+ppl::common::RetCode GeluKernel::DoExecute(KernelExecContext* ctx) {
+    PPLNN_X86_REQUIRED_INPUT(input, 0);
+    PPLNN_X86_REQUIRED_OUTPUT(output, 0);
+
+    PPLNN_X86_DEBUG_TRACE("Op: %s\n", GetName().c_str());
+
+    PPLNN_X86_DEBUG_TRACE("Input [input]:\n");
+    PPL_X86_TENSOR_PRINT_DEBUG_MSG(input);
+
+    PPLNN_X86_DEBUG_TRACE("approximate: %d\n", param_->approximate);
+
+    PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    PPLNN_X86_DEBUG_TRACE("Output [output]:\n");
+    PPL_X86_TENSOR_PRINT_DEBUG_MSG(output);
+
+    const ppl::common::datatype_t data_type = input->GetShape()->GetDataType();
+
+    if (data_type == ppl::common::DATATYPE_FLOAT32) {
+        GeluFp32(input->GetBufferPtr<const float>(), input->GetShape()->CalcElementsIncludingPadding(),
+                 param_->approximate, output->GetBufferPtr<float>());
+        return ppl::common::RC_SUCCESS;
+    } else {
+        LOG(ERROR) << "unsupported data type " << ppl::common::GetDataTypeStr(data_type) << ".";
+    }
+
+    return ppl::common::RC_UNSUPPORTED;
+}
+
+}}} // namespace ppl::nn::x86
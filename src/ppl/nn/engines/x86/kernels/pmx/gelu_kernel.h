@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_KERNELS_PMX_GELU_KERNEL_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_KERNELS_PMX_GELU_KERNEL_H_
+
+#include "ppl/nn/engines/x86/kernel.h"
+#include "ppl/nn/params/pmx/gelu_param.h"
+
+namespace ppl { namespace nn { namespace x86 {
+
+class GeluKernel : public X86Kernel {
+public:
+    GeluKernel(const ir::Node* node) : X86Kernel(node) {}
+
+    void SetParam(const ppl::nn::pmx::GELUParam* p) {
+        param_ = p;
+    }
+
+private:
+    ppl::common::RetCode DoExecute(KernelExecContext*) override;
+
+private:
+    const ppl::nn::pmx::GELUParam* param_ = nullptr;
+};
+
+/**
+   @brief y = 0.5 * x * (1 + erf(x / sqrt(2))), or 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) if
+   `approximate` is true. `y` can be the same as `x`.
+*/
+void GeluFp32(const float* x, int64_t n, bool approximate, float* y);
+
+/**
+   @brief number of rows of an fp32 [m, `n`] gemm output to compute per call when GELU is applied as an epilogue, so
+   that each block is still in cache when GELU rewrites it.
+*/
+int64_t GeluEpilogueBlockM(int64_t n);
+
+}}} // namespace ppl::nn::x86
+
+#endif
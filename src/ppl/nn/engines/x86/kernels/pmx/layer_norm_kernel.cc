@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/kernels/pmx/layer_norm_kernel.h"
+#include "ppl/nn/common/logger.h"
+#include <cmath>
+
+namespace ppl { namespace nn { namespace x86 {
+
+// each lane runs Welford's algorithm on a strided subsequence of a row so that the inner loop can be vectorized.
+static const int64_t g_welford_lanes = 16;
+
+static void WelfordMeanVar(const float* x, int64_t n, float* mean, float* var) {
+    float lane_mean[g_welford_lanes] = {0.0f};
+    float lane_m2[g_welford_lanes] = {0.0f};
+
+    const int64_t n_body = n / g_welford_lanes * g_welford_lanes;
+    int64_t lane_count = 0;
+    for (int64_t i = 0; i < n_body; i += g_welford_lanes) {
+        ++lane_count;
+        const float rcp = 1.0f / lane_count;
+        for (int64_t l = 0; l < g_welford_lanes; ++l) {
+            const float delta = x[i + l] - lane_mean[l];
+            lane_mean[l] += delta * rcp;
+            lane_m2[l] += delta * (x[i + l] - lane_mean[l]);
+        }
+    }
+
+    // merges lanes with Chan's formula
+    float m = 0.0f, m2 = 0.0f;
+    int64_t count = 0;
+    for (int64_t l = 0; l < g_welford_lanes && lane_count > 0; ++l) {
+        const int64_t new_count = count + lane_count;
+        const float delta = lane_mean[l] - m;
+        m += delta * ((float)lane_count / new_count);
+        m2 += lane_m2[l] + delta * delta * ((float)count * lane_count / new_count);
+        count = new_count;
+    }
+
+    for (int64_t i = n_body; i < n; ++i) {
+        ++count;
+        const float delta = x[i] - m;
+        m += delta / count;
+        m2 += delta * (x[i] - m);
+    }
+
+    *mean = m;
+    *var = (n > 0 ? m2 / n : 0.0f);
+}
+
+void LayerNormNdarrayFp32(const float* src, const float* scale, const float* shift, int64_t outer, int64_t inner,
+                          float eps, float* dst, float* mean, float* inv_std_dev) {
+#ifdef PPL_USE_X86_OMP
+#pragma omp parallel for
+#endif
+    for (int64_t i = 0; i < outer; ++i) {
+        const float* x = src + i * inner;
+        float* y = dst + i * inner;
+
+        float row_mean, row_var;
+        WelfordMeanVar(x, inner, &row_mean, &row_var);
+        const float rstd = 1.0f / sqrtf(row_var + eps);
+        if (mean) {
+            mean[i] = row_mean;
+        }
+        if (inv_std_dev) {
+            inv_std_dev[i] = rstd;
+        }
+
+        if (scale && shift) {
+            for (int64_t j = 0; j < inner; ++j) {
+                y[j] = (x[j] - row_mean) * rstd * scale[j] + shift[j];
+            }
+        } else if (scale) {
+            for (int64_t j = 0; j < inner; ++j) {
+                y[j] = (x[j] - row_mean) * rstd * scale[j];
+            }
+        } else {
+            for (int64_t j = 0; j < inner; ++j) {
+                y[j] = (x[j] - row_mean) * rstd;
+            }
+        }
+    }
+}
+
+ppl::common::RetCode LayerNormKernel::DoExecute(KernelExecContext* ctx) {
+    PPLNN_X86_REQUIRED_INPUT(input, 0);
+    PPLNN_X86_OPTIONAL_INPUT(scale, 1);
+    PPLNN_X86_OPTIONAL_INPUT(shift, 2);
+    PPLNN_X86_REQUIRED_OUTPUT(output, 0);
+    PPLNN_X86_OPTIONAL_OUTPUT(mean, 1);
+    PPLNN_X86_OPTIONAL_OUTPUT(inv_std_dev, 2);
+
+    PPLNN_X86_DEBUG_TRACE("Op: %s\n", GetName().c_str());
+
+    PPLNN_X86_DEBUG_TRACE("Input [input]:\n");
+    PPL_X86_TENSOR_PRINT_DEBUG_MSG(input);
+    if (scale) {
+        PPLNN_X86_DEBUG_TRACE("Input [scale]:\n");
+        PPL_X86_TENSOR_PRINT_DEBUG_MSG(scale);
+    }
+    if (shift) {
+        PPLNN_X86_DEBUG_TRACE("Input [shift]:\n");
+        PPL_X86_TENSOR_PRINT_DEBUG_MSG(shift);
+    }
+
+    PPLNN_X86_DEBUG_TRACE("elementwise_affine: %d\n", param_->elementwise_affine);
+    PPLNN_X86_DEBUG_TRACE("axis: %d\n", param_->axis);
+    PPLNN_X86_DEBUG_TRACE("eps: %f\n", param_->eps);
+
+    PPLNN_X86_REALLOC_TENSOR_BUFFER(output);
+    PPLNN_X86_DEBUG_TRACE("Output [output]:\n");
+    PPL_X86_TENSOR_PRINT_DEBUG_MSG(output);
+    if (mean) {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(mean);
+        PPLNN_X86_DEBUG_TRACE("Output [mean]:\n");
+        PPL_X86_TENSOR_PRINT_DEBUG_MSG(mean);
+    }
+    if (inv_std_dev) {
+        PPLNN_X86_REALLOC_TENSOR_BUFFER(inv_std_dev);
+        PPLNN_X86_DEBUG_TRACE("Output [inv_std_dev]:\n");
+        PPL_X86_TENSOR_PRINT_DEBUG_MSG(inv_std_dev);
+    }
+
+    auto input_shape = input->GetShape();
+    const int32_t dim_count = input_shape->GetDimCount();
+    const int32_t axis = param_->axis < 0 ? param_->axis + dim_count : param_->axis;
+
+    int64_t outer = 1;
+    int64_t inner = 1;
+    for (int32_t i = 0; i < axis; ++i) {
+        outer *= input_shape->GetDim(i);
+    }
+    for (int32_t i = axis; i < dim_count; ++i) {
+        inner *= input_shape->GetDim(i);
+    }
+
+    const ppl::common::datatype_t data_type = input_shape->GetDataType();
+    const ppl::common::dataformat_t data_format = input_shape->GetDataFormat();
+    if (data_type != ppl::common::DATATYPE_FLOAT32) {
+        LOG(ERROR) << "unsupported data type " << ppl::common::GetDataTypeStr(data_type) << ".";
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (data_format != ppl::common::DATAFORMAT_NDARRAY) {
+        LOG(ERROR) << "unsupported data format " << ppl::common::GetDataFormatStr(data_format) << ".";
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const float* scale_ptr = nullptr;
+    const float* shift_ptr = nullptr;
+    if (param_->elementwise_affine) {
+        if (!scale) {
+            LOG(ERROR) << "scale is required when elementwise_affine is true.";
+            return ppl::common::RC_NOT_FOUND;
+        }
+        scale_ptr = scale->GetBufferPtr<const float>();
+        if (shift) {
+            shift_ptr = shift->GetBufferPtr<const float>();
+        }
+    }
+
+    LayerNormNdarrayFp32(input->GetBufferPtr<const float>(), scale_ptr, shift_ptr, outer, inner, param_->eps,
+                         output->GetBufferPtr<float>(), mean ? mean->GetBufferPtr<float>() : nullptr,
+                         inv_std_dev ? inv_std_dev->GetBufferPtr<float>() : nullptr);
+    return ppl::common::RC_SUCCESS;
+}
+
+}}} // namespace ppl::nn::x86
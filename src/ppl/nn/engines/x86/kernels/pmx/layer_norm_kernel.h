@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_KERNELS_PMX_LAYER_NORM_KERNEL_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_KERNELS_PMX_LAYER_NORM_KERNEL_H_
+
+#include "ppl/nn/engines/x86/kernel.h"
+#include "ppl/nn/params/pmx/layer_norm_param.h"
+
+namespace ppl { namespace nn { namespace x86 {
+
+class LayerNormKernel : public X86Kernel {
+public:
+    LayerNormKernel(const ir::Node* node) : X86Kernel(node) {}
+
+    void SetParam(const ppl::nn::pmx::LayerNormParam* p) {
+        param_ = p;
+    }
+
+private:
+    ppl::common::RetCode DoExecute(KernelExecContext*) override;
+
+private:
+    const ppl::nn::pmx::LayerNormParam* param_ = nullptr;
+};
+
+/**
+   @brief normalizes each of the `outer` rows of `src`, which has `inner` contiguous elements. mean and variance of a
+   row are computed in one pass using Welford's algorithm.
+   @param scale optional, `inner` elements
+   @param shift optional, `inner` elements
+   @param mean optional output, `outer` elements
+   @param inv_std_dev optional output, `outer` elements
+*/
+void LayerNormNdarrayFp32(const float* src, const float* scale, const float* shift, int64_t outer, int64_t inner,
+                          float eps, float* dst, float* mean, float* inv_std_dev);
+
+}}} // namespace ppl::nn::x86
+
+#endif
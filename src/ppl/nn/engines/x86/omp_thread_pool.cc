@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/omp_thread_pool.h"
+#include "ppl/nn/common/logger.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
+#include <algorithm>
+#include <atomic>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+static uint64_t GenPoolId() {
+    static atomic<uint64_t> g_next_id(1);
+    return g_next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+struct ActivatedInfo final {
+    /** id of the pool activated in this thread. 0 means none. */
+    uint64_t pool_id = 0;
+    uint32_t version = 0;
+    uint32_t worker_idx = 0;
+    uint32_t worker_num = 0;
+    /** number of threads of this thread before any pool is activated. 0 means unknown. */
+    int32_t saved_thread_num = 0;
+};
+
+static thread_local ActivatedInfo g_activated;
+
+OmpThreadPool::OmpThreadPool() : id_(GenPoolId()) {}
+
+RetCode OmpThreadPool::Init(uint32_t thread_num, const vector<int32_t>& cpu_ids) {
+    for (auto cpu = cpu_ids.begin(); cpu != cpu_ids.end(); ++cpu) {
+        if (*cpu < 0) {
+            LOG(ERROR) << "invalid cpu id [" << *cpu << "].";
+            return RC_INVALID_VALUE;
+        }
+    }
+
+    if (thread_num == 0) {
+        thread_num = cpu_ids.size();
+    }
+
+    thread_num_ = thread_num;
+    cpu_ids_ = cpu_ids;
+    ++version_;
+    return RC_SUCCESS;
+}
+
+void OmpThreadPool::Activate(uint32_t worker_idx, uint32_t worker_num) const {
+    if (worker_num == 0) {
+        worker_num = 1;
+    }
+
+    auto info = &g_activated;
+    if (info->pool_id == id_ && info->version == version_ && info->worker_idx == worker_idx &&
+        info->worker_num == worker_num) {
+        return;
+    }
+
+    if (info->saved_thread_num == 0) {
+        info->saved_thread_num = ppl::kernel::x86::get_omp_max_threads();
+    }
+
+    // threads of the calling thread are used as is if nothing is set and it is the only one running kernels
+    int32_t thread_num = (thread_num_ > 0) ? thread_num_ : info->saved_thread_num;
+    const int32_t* cpu_ids = cpu_ids_.data();
+    uint32_t cpu_num = cpu_ids_.size();
+    if (worker_num > 1) {
+        thread_num = std::max<int32_t>(1, thread_num / worker_num);
+        if (cpu_num >= worker_num) {
+            const uint32_t begin = (uint64_t)cpu_num * worker_idx / worker_num;
+            const uint32_t end = (uint64_t)cpu_num * (worker_idx + 1) / worker_num;
+            cpu_ids += begin;
+            cpu_num = end - begin;
+        }
+    }
+
+    ppl::kernel::x86::set_omp_num_threads(thread_num);
+    if (cpu_num > 0) {
+        ppl::kernel::x86::set_omp_core_binding(cpu_ids, cpu_num, thread_num);
+    }
+
+    info->pool_id = id_;
+    info->version = version_;
+    info->worker_idx = worker_idx;
+    info->worker_num = worker_num;
+}
+
+}}} // namespace ppl::nn::x86
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_OMP_THREAD_POOL_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_OMP_THREAD_POOL_H_
+
+#include "ppl/common/retcode.h"
+#include <stdint.h>
+#include <vector>
+
+namespace ppl { namespace nn { namespace x86 {
+
+/**
+   @class OmpThreadPool
+   @brief number of threads and cpu binding used by kernels of an engine context.
+   @note openmp keeps a separate team of threads for each thread that starts parallel regions, and the number of
+   threads is a per-thread setting. a pool is activated in the thread that runs kernels, so that settings of
+   different runtimes do not interfere with each other. settings default to those of the engine and can be changed
+   for each runtime.
+*/
+class OmpThreadPool final {
+public:
+    OmpThreadPool();
+
+    /**
+       @brief `thread_num` defaults to `cpu_ids.size()` if it is 0. both being empty means using the number of threads
+       of the calling thread without binding.
+       @note MUST NOT be called during a run.
+    */
+    ppl::common::RetCode Init(uint32_t thread_num, const std::vector<int32_t>& cpu_ids);
+
+    /**
+       @brief makes parallel regions started by the calling thread run on threads of this pool.
+       @param worker_idx index of the calling thread among `worker_num` threads that run kernels at the same time.
+       each of them takes an even share of threads and cpus so that they do not oversubscribe cpus.
+    */
+    void Activate(uint32_t worker_idx = 0, uint32_t worker_num = 1) const;
+
+    uint32_t GetThreadNum() const {
+        return thread_num_;
+    }
+    const std::vector<int32_t>& GetCpuIds() const {
+        return cpu_ids_;
+    }
+
+private:
+    /** used to tell whether this pool is activated in the calling thread */
+    const uint64_t id_;
+    /** changed by `Init()` so that threads activated with old settings are activated again */
+    uint32_t version_ = 0;
+    uint32_t thread_num_ = 0;
+    std::vector<int32_t> cpu_ids_;
+
+private:
+    OmpThreadPool(const OmpThreadPool&) = delete;
+    OmpThreadPool& operator=(const OmpThreadPool&) = delete;
+};
+
+}}} // namespace ppl::nn::x86
+
+#endif
@@ -40,6 +40,29 @@ RetCode MMCVGridSampleOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MMCVGridSampleOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateMMCVGridSampleParam(private_data, param_->align_corners,
+                                                         param_->interpolation_mode, param_->padding_mode);
+    return SerializeParamData(pmx::x86::ParamType_MMCVGridSampleParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode MMCVGridSampleOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_MMCVGridSampleParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_MMCVGridSampleParam();
+    auto param = make_shared<ppl::nn::mmcv::MMCVGridSampleParam>();
+    param->align_corners = fb_param->align_corners();
+    param->interpolation_mode = fb_param->interpolation_mode();
+    param->padding_mode = fb_param->padding_mode();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* MMCVGridSampleOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MMCVGridSampleKernel>(param_.get());
 }
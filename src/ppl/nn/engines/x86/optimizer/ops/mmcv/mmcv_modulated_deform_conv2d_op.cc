@@ -40,6 +40,41 @@ RetCode MMCVModulatedDeformConv2dOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MMCVModulatedDeformConv2dOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_stride = private_data.CreateVector(param_->stride, 2);
+    auto fb_padding = private_data.CreateVector(param_->padding, 2);
+    auto fb_dilation = private_data.CreateVector(param_->dilation, 2);
+    auto fb_param = pmx::x86::CreateMMCVModulatedDeformConv2dParam(private_data, fb_stride, fb_padding, fb_dilation,
+                                                                    param_->groups, param_->deform_groups);
+    return SerializeParamData(pmx::x86::ParamType_MMCVModulatedDeformConv2dParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode MMCVModulatedDeformConv2dOp::DeserializeData(const pmx::DeserializationContext&, const void* base,
+                                                     uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_MMCVModulatedDeformConv2dParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_MMCVModulatedDeformConv2dParam();
+    auto param = make_shared<ppl::nn::mmcv::MMCVModulatedDeformConv2dParam>();
+    if (fb_param->stride()->size() != 2 || fb_param->padding()->size() != 2 || fb_param->dilation()->size() != 2) {
+        LOG(ERROR) << "stride, padding and dilation of op[" << GetNode()->GetName() << "] must have 2 elements.";
+        return RC_INVALID_VALUE;
+    }
+    for (uint32_t i = 0; i < 2; ++i) {
+        param->stride[i] = fb_param->stride()->Get(i);
+        param->padding[i] = fb_param->padding()->Get(i);
+        param->dilation[i] = fb_param->dilation()->Get(i);
+    }
+    param->groups = fb_param->groups();
+    param->deform_groups = fb_param->deform_groups();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* MMCVModulatedDeformConv2dOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MMCVModulatedDeformConv2dKernel>(param_.get());
 }
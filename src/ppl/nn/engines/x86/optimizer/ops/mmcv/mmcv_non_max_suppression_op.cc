@@ -42,6 +42,27 @@ RetCode MMCVNonMaxSuppressionOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MMCVNonMaxSuppressionOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateMMCVNMSParam(private_data, param_->iou_threshold, param_->offset);
+    return SerializeParamData(pmx::x86::ParamType_MMCVNMSParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode MMCVNonMaxSuppressionOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_MMCVNMSParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_MMCVNMSParam();
+    auto param = make_shared<ppl::nn::mmcv::MMCVNMSParam>();
+    param->iou_threshold = fb_param->iou_threshold();
+    param->offset = fb_param->offset();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* MMCVNonMaxSuppressionOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MMCVNonMaxSuppressionKernel>(param_.get());
 }
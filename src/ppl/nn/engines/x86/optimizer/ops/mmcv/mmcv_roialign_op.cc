@@ -65,6 +65,33 @@ RetCode MMCVROIAlignOp::SelectFormat(const InputOutputInfo& info, vector<datafor
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MMCVROIAlignOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateMMCVRoiAlignParamDirect(
+        private_data, param_->aligned, param_->aligned_height, param_->aligned_width, param_->pool_mode.c_str(),
+        param_->sampling_ratio, param_->spatial_scale);
+    return SerializeParamData(pmx::x86::ParamType_MMCVRoiAlignParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode MMCVROIAlignOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_MMCVRoiAlignParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_MMCVRoiAlignParam();
+    auto param = make_shared<ppl::nn::mmcv::MMCVRoiAlignParam>();
+    param->aligned = fb_param->aligned();
+    param->aligned_height = fb_param->aligned_height();
+    param->aligned_width = fb_param->aligned_width();
+    param->pool_mode = fb_param->pool_mode()->str();
+    param->sampling_ratio = fb_param->sampling_ratio();
+    param->spatial_scale = fb_param->spatial_scale();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* MMCVROIAlignOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MMCVROIAlignKernel>(param_.get());
 }
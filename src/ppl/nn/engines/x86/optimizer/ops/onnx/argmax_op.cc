@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/argmax_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_argmax.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/argmax.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -42,6 +47,30 @@ RetCode ArgmaxOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ArgmaxOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeArgMaxParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ArgMaxParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ArgmaxOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ArgMaxParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::ArgMaxParam>();
+    pmx::onnx::DeserializeArgMaxParam(*fb_op_param->value_as_ArgMaxParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ArgmaxOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ArgMaxKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/batch_normalization_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_batch_normalization.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/batch_normalization.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -49,6 +54,44 @@ RetCode BatchNormalizationOp::SelectFormat(const InputOutputInfo& info, vector<d
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode BatchNormalizationOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_fusion_data = pmx::x86::CreateFusionDataDirect(private_data, fuse_relu_, &common_param_.output_formats);
+    auto fb_op_data =
+        pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_FusionData, fb_fusion_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeBatchNormalizationParam(*param_, &builder);
+    return WriteOpParam(pmx::onnx::OpParamType_BatchNormalizationParam, fb_param.Union(), private_data, &builder,
+                        ds);
+}
+
+RetCode BatchNormalizationOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_BatchNormalizationParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    auto fb_fusion_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_FusionData();
+    if (!fb_fusion_data) {
+        LOG(ERROR) << "private data of op[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::BatchNormalizationParam>();
+    pmx::onnx::DeserializeBatchNormalizationParam(*fb_op_param->value_as_BatchNormalizationParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    fuse_relu_ = (fb_fusion_data->fuse_relu() != 0);
+    pmx::utils::Fbvec2Stdvec(fb_fusion_data->dformat(), &common_param_.output_formats);
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* BatchNormalizationOp::CreateKernelImpl() const {
     auto kernel = CreateKernelImplWithParam<BatchNormalizationKernel>(param_.get());
     if (kernel) {
@@ -23,9 +23,12 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode ClipOp::DoInit(const OptKernelOptions& options) {
+ClipOp::ClipOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = GenericInferDims;
     infer_type_func_ = GenericInferType;
+}
+
+RetCode ClipOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
@@ -36,6 +39,21 @@ RetCode ClipOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>*
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ClipOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    return SerializeOutputData(pmx::onnx::OpParamType_NONE, 0, &builder, ds);
+}
+
+RetCode ClipOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NONE);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ClipOp::CreateKernelImpl() const {
     return CreateKernelImplWithoutParam<ClipKernel>();
 }
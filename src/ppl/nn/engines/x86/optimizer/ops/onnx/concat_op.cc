@@ -19,11 +19,24 @@
 #include "ppl/nn/engines/x86/kernels/onnx/concat_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_concat.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/concat.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+ConcatOp::ConcatOp(const ir::Node* node) : X86OptKernel(node) {
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeConcat(info, param_.get());
+    };
+
+    infer_type_func_ = GenericInferType;
+}
+
 RetCode ConcatOp::DoInit(const OptKernelOptions& options) {
     auto status = GenericLoadParam(options, &param_);
     if (status != RC_SUCCESS) {
@@ -31,12 +44,6 @@ RetCode ConcatOp::DoInit(const OptKernelOptions& options) {
         return status;
     }
 
-    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
-        return onnx::ReshapeConcat(info, param_.get());
-    };
-
-    infer_type_func_ = GenericInferType;
-
     return RC_SUCCESS;
 }
 
@@ -60,6 +67,24 @@ RetCode ConcatOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ConcatOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeConcatParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ConcatParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ConcatOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ConcatParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    param_ = make_shared<ppl::nn::onnx::ConcatParam>();
+    pmx::onnx::DeserializeConcatParam(*fb_op_param->value_as_ConcatParam(), param_.get());
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ConcatOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ConcatKernel>(param_.get());
 }
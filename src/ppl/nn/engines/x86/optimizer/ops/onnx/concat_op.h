@@ -25,13 +25,18 @@ namespace ppl { namespace nn { namespace x86 {
 
 class ConcatOp final : public X86OptKernel {
 public:
-    ConcatOp(const ir::Node* node) : X86OptKernel(node) {}
+    ConcatOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
     ppl::common::RetCode SelectFormat(const InputOutputInfo& info,
                                       std::vector<ppl::common::dataformat_t>* selected_input_formats,
                                       std::vector<ppl::common::dataformat_t>* selected_output_formats) override;
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+#endif
+
 private:
     std::shared_ptr<ppl::nn::onnx::ConcatParam> param_;
 };
@@ -19,6 +19,7 @@
 #include "ppl/nn/engines/x86/kernels/onnx/constant_of_shape_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_constant_of_shape.h"
 #include "ppl/nn/common/logger.h"
+#include <string.h>
 using namespace std;
 using namespace ppl::common;
 
@@ -43,6 +44,35 @@ RetCode ConstantOfShapeOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ConstantOfShapeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_dims = private_data.CreateVector(param_->dims);
+    auto fb_data = private_data.CreateVector((const uint8_t*)param_->data.GetData(), param_->data.GetSize());
+    auto fb_param = pmx::x86::CreateConstantOfShapeParam(private_data, param_->data_type, fb_dims, fb_data);
+    return SerializeParamData(pmx::x86::ParamType_ConstantOfShapeParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode ConstantOfShapeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_ConstantOfShapeParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_ConstantOfShapeParam();
+    auto param = make_shared<ppl::nn::onnx::ConstantOfShapeParam>();
+    param->data_type = fb_param->data_type();
+    pmx::utils::Fbvec2Stdvec(fb_param->dims(), &param->dims);
+    auto status = param->data.Init(fb_param->data()->size());
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "allocate value of op[" << GetNode()->GetName() << "] failed: " << GetRetCodeStr(status);
+        return status;
+    }
+    memcpy(param->data.GetData(), fb_param->data()->data(), fb_param->data()->size());
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* ConstantOfShapeOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ConstantOfShapeKernel>(param_.get());
 }
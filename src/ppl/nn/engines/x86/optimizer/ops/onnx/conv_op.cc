@@ -21,14 +21,186 @@
 #include "ppl/nn/engines/x86/kernels/onnx/conv1d_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_conv.h"
 #include "ppl/nn/common/logger.h"
+#include "ppl/common/destructor.h"
 
 #include "ppl/kernel/x86/common/threading_tools.h"
 
+#include <chrono>
+#include <string.h>
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/conv.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+static string GenConv2dAlgoKey(const ppl::kernel::x86::conv2d_param& param, const TensorShape& src_shape,
+                               isa_t isa) {
+    string key = "conv2d_g" + to_string(param.group) + "_ic" + to_string(param.channels) + "_oc" +
+        to_string(param.num_output) + "_k" + to_string(param.kernel_h) + "x" + to_string(param.kernel_w) + "_s" +
+        to_string(param.stride_h) + "x" + to_string(param.stride_w) + "_p" + to_string(param.pad_h) + "x" +
+        to_string(param.pad_w) + "_d" + to_string(param.dilation_h) + "x" + to_string(param.dilation_w) + "_f" +
+        to_string(param.fuse_flag) + "_in";
+    for (uint32_t i = 0; i < src_shape.GetDimCount(); ++i) {
+        key += (i == 0 ? "" : "x") + to_string(src_shape.GetDim(i));
+    }
+    key += "_fmt" + to_string(src_shape.GetDataFormat()) + "_isa" + to_string(isa);
+    return key;
+}
+
+/** @brief returns the average execution time of `algo_info` in microseconds, or a negative value if unavailable. */
+static double MeasureConv2dAlgo(const ppl::kernel::x86::conv2d_param& param,
+                                const ppl::kernel::x86::conv2d_algo_info& algo_info, const TensorShape& src_shape,
+                                const TensorShape& dst_shape, const float* weight, const float* bias,
+                                X86Device* device) {
+    auto mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(param, algo_info, device->GetAllocator());
+    if (!mgr) {
+        return -1;
+    }
+
+    ppl::kernel::x86::conv2d_fp32_executor* executor = nullptr;
+    BufferDesc src_buf, dst_buf, tmp_buf;
+    Destructor __guard([mgr, &executor, &src_buf, &dst_buf, &tmp_buf, device]() -> void {
+        device->Free(&tmp_buf);
+        device->Free(&dst_buf);
+        device->Free(&src_buf);
+        delete executor;
+        mgr->release_cvt_weights();
+        delete mgr;
+    });
+
+    if (mgr->gen_cvt_weights(weight, bias) != RC_SUCCESS) {
+        return -1;
+    }
+
+    TensorShape src_desc(src_shape), dst_desc(dst_shape);
+    src_desc.SetDataFormat(algo_info.input_format);
+    dst_desc.SetDataFormat(algo_info.output_format);
+
+    executor = mgr->gen_executor();
+    executor->set_src_shape(&src_desc);
+    executor->set_dst_shape(&dst_desc);
+    if (executor->prepare() != RC_SUCCESS) {
+        return -1;
+    }
+
+    if (device->Realloc(src_desc, &src_buf) != RC_SUCCESS || device->Realloc(dst_desc, &dst_buf) != RC_SUCCESS ||
+        device->Realloc(executor->cal_temp_buffer_size(), &tmp_buf) != RC_SUCCESS) {
+        return -1;
+    }
+    memset(src_buf.addr, 0, src_desc.CalcBytesIncludingPadding());
+
+    executor->set_temp_buffer(tmp_buf.addr);
+    executor->set_src((const float*)src_buf.addr);
+    executor->set_dst((float*)dst_buf.addr);
+
+    static const uint32_t warmup_times = 2, run_times = 8;
+    for (uint32_t i = 0; i < warmup_times; ++i) {
+        if (executor->execute() != RC_SUCCESS) {
+            return -1;
+        }
+    }
+
+    auto begin_ts = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < run_times; ++i) {
+        executor->execute();
+    }
+    auto end_ts = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_ts - begin_ts).count() / 1000.0 / run_times;
+}
+
+/**
+   @brief measures algorithms that are applicable to `param` and have the same formats as `heuristic`, and returns
+   the fastest one.
+*/
+static ppl::kernel::x86::conv2d_algo_t TuneConv2dAlgo(const ppl::kernel::x86::conv2d_param& param,
+                                                      const ppl::kernel::x86::conv2d_algo_info& heuristic,
+                                                      const TensorShape& src_shape, const TensorShape& dst_shape,
+                                                      const float* weight, const float* bias, X86Device* device) {
+    typedef ppl::kernel::x86::conv2d_algo conv2d_algo;
+
+    vector<ppl::kernel::x86::conv2d_algo_t> candidates = {heuristic.algo_type};
+    if (heuristic.input_format == heuristic.output_format) {
+        const bool no_dilation = (param.dilation_h == 1 && param.dilation_w == 1);
+        candidates.push_back(conv2d_algo::DIRECT);
+        if (param.kernel_h == 3 && param.kernel_w == 3 && param.stride_h == 1 && param.stride_w == 1 && no_dilation) {
+            candidates.push_back(conv2d_algo::WINOGRAD_B4F3);
+        }
+        if (param.kernel_h == 5 && param.kernel_w == 5 && param.stride_h == 2 && param.stride_w == 2 && no_dilation) {
+            candidates.push_back(conv2d_algo::WINOGRAD_B2F5S2);
+        }
+        if (param.kernel_h == 1 && param.kernel_w == 1 && param.stride_h == 1 && param.stride_w == 1 &&
+            param.pad_h == 0 && param.pad_w == 0) {
+            candidates.push_back(conv2d_algo::GEMM_DIRECT);
+        }
+        if (param.group == param.channels && param.group == param.num_output) {
+            candidates.push_back(conv2d_algo::DEPTHWISE);
+        }
+    }
+
+    auto best_algo = heuristic.algo_type;
+    double best_cost = -1;
+    for (uint32_t i = 0; i < candidates.size(); ++i) {
+        if (i > 0 && candidates[i] == heuristic.algo_type) {
+            continue;
+        }
+
+        ppl::kernel::x86::conv2d_algo_info algo_info = heuristic;
+        algo_info.algo_type = candidates[i];
+        auto cost = MeasureConv2dAlgo(param, algo_info, src_shape, dst_shape, weight, bias, device);
+        LOG(DEBUG) << "conv2d algo[" << candidates[i] << "] costs [" << cost << "] us";
+        if (cost >= 0 && (best_cost < 0 || cost < best_cost)) {
+            best_cost = cost;
+            best_algo = candidates[i];
+        }
+    }
+
+    return best_algo;
+}
+
+static void FillConv2dParam(const ppl::nn::onnx::ConvParam& conv_param, uint64_t kernel_dims,
+                            ppl::kernel::x86::conv2d_param* conv2d_param) {
+    if (kernel_dims == 1) {
+        conv2d_param->kernel_h = 1;
+        conv2d_param->kernel_w = conv_param.kernel_shape[0];
+        conv2d_param->stride_h = 1;
+        conv2d_param->stride_w = conv_param.strides[0];
+        conv2d_param->pad_h = 0;
+        conv2d_param->pad_w = conv_param.pads[0];
+        conv2d_param->dilation_h = 1;
+        conv2d_param->dilation_w = conv_param.dilations[0];
+    }
+    if (kernel_dims == 2) {
+        conv2d_param->kernel_h = conv_param.kernel_shape[0];
+        conv2d_param->kernel_w = conv_param.kernel_shape[1];
+        conv2d_param->stride_h = conv_param.strides[0];
+        conv2d_param->stride_w = conv_param.strides[1];
+        conv2d_param->pad_h = conv_param.pads[0];
+        conv2d_param->pad_w = conv_param.pads[1];
+        conv2d_param->dilation_h = conv_param.dilations[0];
+        conv2d_param->dilation_w = conv_param.dilations[1];
+    }
+    conv2d_param->group = conv_param.group;
+}
+
+ConvOp::ConvOp(const ir::Node* node) : X86OptKernel(node), conv2d_param_(nullptr), conv1d_param_(nullptr) {
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        auto x = info->GetInput<TensorImpl>(0)->GetShape();
+        auto w = info->GetInput<TensorImpl>(1)->GetShape();
+        if (x->GetDim(1) != w->GetDim(1) * param_->group) {
+            LOG(ERROR) << "input tensor's channels(" << x->GetDim(1) <<
+                ") and weight's channels*group(" << w->GetDim(1) << "*"<< param_->group << ") not match.";
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        return onnx::ReshapeConv(info, param_.get());
+    };
+
+    infer_type_func_ = GenericInferType;
+}
+
 ConvOp::~ConvOp() {
     if (conv2d_param_ != nullptr) {
         if (conv2d_param_->mgr != nullptr) {
@@ -63,24 +235,97 @@ RetCode ConvOp::DoInit(const OptKernelOptions& options) {
         return ppl::common::RC_UNSUPPORTED;
     }
 
-    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
-        auto x = info->GetInput<TensorImpl>(0)->GetShape();
-        auto w = info->GetInput<TensorImpl>(1)->GetShape();
-        if (x->GetDim(1) != w->GetDim(1) * param_->group) {
-            LOG(ERROR) << "input tensor's channels(" << x->GetDim(1) <<
-                ") and weight's channels*group(" << w->GetDim(1) << "*"<< param_->group << ") not match.";
-            return ppl::common::RC_INVALID_VALUE;
-        }
-        return onnx::ReshapeConv(info, param_.get());
-    };
-
-    infer_type_func_ = GenericInferType;
-
     aux_param_.bias_term = (node->GetInputCount() == 3) ? 1 : 0;
 
     return RC_SUCCESS;
 }
 
+/** @brief generates the fallback manager of winograd algorithms for `conv2d_param_->mgr` */
+void ConvOp::InitConv2dManagers(ppl::common::Allocator* allocator) {
+    if (conv2d_param_->algo_info.algo_type == ppl::kernel::x86::conv2d_algo::WINOGRAD_B4F3) {
+        conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::DIRECT;
+        conv2d_param_->fallback_mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
+            conv2d_param_->param, conv2d_param_->algo_info, allocator);
+        conv2d_param_->infer_fallback_func = [](const TensorImpl* X, const TensorImpl* Y,
+                                                const ppl::kernel::x86::conv2d_param* param) -> bool {
+            const int64_t dst_h = Y->GetShape()->GetDim(2);
+            const int64_t dst_w = Y->GetShape()->GetDim(3);
+            const int64_t batch = X->GetShape()->GetDim(0);
+            const int64_t num_tiles = batch * ((dst_h + 3) / 4) * ((dst_w + 3) / 4);
+            const bool align_tiles = (dst_h % 4 == 0) && (dst_w % 4) == 0;
+
+            const int64_t num_threads = ppl::kernel::x86::get_omp_max_threads();
+            if (num_threads > 4) { // Maybe memory bound. Just maybe.
+                if (param->group > 4) {
+                    if (param->channels / param->group <= 2 * 1.801f * 16) { // Multigroup need more channels
+                        return true;
+                    }
+                }
+                if (param->group / num_threads > 1 && num_threads / batch <= 4) { // Many group but small batch
+                    return true;
+                }
+            }
+            return num_tiles < (align_tiles ? 10 : 12);
+        };
+        conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::WINOGRAD_B4F3;
+    }
+
+    if (conv2d_param_->algo_info.algo_type == ppl::kernel::x86::conv2d_algo::WINOGRAD_B2F5S2) {
+        conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::DIRECT;
+        conv2d_param_->fallback_mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
+            conv2d_param_->param, conv2d_param_->algo_info, allocator);
+        conv2d_param_->infer_fallback_func = [](const TensorImpl* X, const TensorImpl* Y,
+                                                const ppl::kernel::x86::conv2d_param* param) -> bool {
+            const int64_t dst_h = Y->GetShape()->GetDim(2);
+            const int64_t dst_w = Y->GetShape()->GetDim(3);
+            const int64_t batch = X->GetShape()->GetDim(0);
+            const int64_t num_tiles = batch * ((dst_h + 1) / 2) * ((dst_w + 1) / 2);
+            const bool align_tiles = (dst_h % 2 == 0) && (dst_w % 2) == 0;
+
+            const int64_t num_threads = ppl::kernel::x86::get_omp_max_threads();
+            if (num_threads > 4) { // Maybe memory bound. Just maybe.
+                if (param->group / num_threads > 1 && num_threads / batch <= 4) { // Many group but small batch
+                    return true;
+                }
+            }
+            return num_tiles < (align_tiles ? 10 : 12);
+        };
+        conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::WINOGRAD_B2F5S2;
+    }
+
+    if (!tuned_dims_.empty() && conv2d_param_->infer_fallback_func) {
+        // the measured algorithm is preferred for the tuned shape
+        auto tuned_dims = tuned_dims_;
+        auto infer_fallback_func = conv2d_param_->infer_fallback_func;
+        conv2d_param_->infer_fallback_func = [tuned_dims, infer_fallback_func](
+                                                 const TensorImpl* X, const TensorImpl* Y,
+                                                 const ppl::kernel::x86::conv2d_param* param) -> bool {
+            auto x_shape = X->GetShape();
+            if (x_shape->GetDimCount() == tuned_dims.size() &&
+                std::equal(tuned_dims.begin(), tuned_dims.end(), x_shape->GetDims())) {
+                return false;
+            }
+            return infer_fallback_func(X, Y, param);
+        };
+    }
+}
+
+/** @brief converts weights for `conv2d_param_->mgr` and its fallback manager */
+void ConvOp::GenConv2dCvtWeights(const float* weight_data, const float* bias_data) {
+    if (bias_data != nullptr) {
+        conv2d_param_->mgr->gen_cvt_weights(weight_data, bias_data);
+        if (conv2d_param_->fallback_mgr) {
+            conv2d_param_->fallback_mgr->gen_cvt_weights(weight_data, bias_data);
+        }
+    } else {
+        std::vector<float> zero_bias(conv2d_param_->param.num_output, 0.0f);
+        conv2d_param_->mgr->gen_cvt_weights(weight_data, zero_bias.data());
+        if (conv2d_param_->fallback_mgr) {
+            conv2d_param_->fallback_mgr->gen_cvt_weights(weight_data, zero_bias.data());
+        }
+    }
+}
+
 ppl::common::RetCode ConvOp::SelectAlgorithm(const InputOutputInfo& info, const OptKernelOptions& options) {
     auto node = GetNode();
     auto graph_data = options.graph_data;
@@ -131,102 +376,63 @@ ppl::common::RetCode ConvOp::SelectAlgorithm(const InputOutputInfo& info, const
         ppl::kernel::x86::conv2d_param& conv2d_param = conv2d_param_->param;
         if (kernel_dims == 1) {
             conv1d_param_ = conv2d_param_; // use conv1d_param_ as a flag
-            conv2d_param.kernel_h = 1;
-            conv2d_param.kernel_w = conv_param.kernel_shape[0];
-            conv2d_param.stride_h = 1;
-            conv2d_param.stride_w = conv_param.strides[0];
-            conv2d_param.pad_h = 0;
-            conv2d_param.pad_w = conv_param.pads[0];
-            conv2d_param.dilation_h = 1;
-            conv2d_param.dilation_w = conv_param.dilations[0];
         }
-        if (kernel_dims == 2) {
-            conv2d_param.kernel_h = conv_param.kernel_shape[0];
-            conv2d_param.kernel_w = conv_param.kernel_shape[1];
-            conv2d_param.stride_h = conv_param.strides[0];
-            conv2d_param.stride_w = conv_param.strides[1];
-            conv2d_param.pad_h = conv_param.pads[0];
-            conv2d_param.pad_w = conv_param.pads[1];
-            conv2d_param.dilation_h = conv_param.dilations[0];
-            conv2d_param.dilation_w = conv_param.dilations[1];
-        }
-        conv2d_param.group = conv_param.group;
+        FillConv2dParam(conv_param, kernel_dims, &conv2d_param);
         conv2d_param.num_output = num_output;
         conv2d_param.channels = channels;
         conv2d_param.fuse_flag = aux_param_.fuse_flag;
 
+        auto src_shape = info.GetInput<TensorImpl>(0)->GetShape();
+        auto dst_shape = info.GetOutput<TensorImpl>(0)->GetShape();
+
         conv2d_param_->algo_info = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(
-            info.GetInput<TensorImpl>(0)->GetShape()->GetDataFormat(), conv2d_param_->param, options.device->GetISA());
+            src_shape->GetDataFormat(), conv2d_param_->param, options.device->GetISA());
+
+        // selected algorithms are only valid for the shape they are measured with
+        bool is_algo_tuned = false;
+        if (options.algo_selects && conv2d_param_->algo_info.algo_type != ppl::kernel::x86::conv2d_algo::UNKNOWN &&
+            !(conv2d_param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM) && src_shape->GetDimCount() == 4 &&
+            src_shape->CalcElementsExcludingPadding() > 0 && dst_shape->CalcElementsExcludingPadding() > 0) {
+            auto key = GenConv2dAlgoKey(conv2d_param, *src_shape, options.device->GetISA());
+            auto ref = options.algo_selects->find(key);
+            if (ref != options.algo_selects->end()) {
+                conv2d_param_->algo_info.algo_type = ref->second;
+                is_algo_tuned = true;
+            } else if (options.config->enable_algo_tuning) {
+                vector<float> zero_bias;
+                if (!bias_data) {
+                    zero_bias.resize(conv2d_param.num_output, 0.0f);
+                }
+                conv2d_param_->algo_info.algo_type =
+                    TuneConv2dAlgo(conv2d_param, conv2d_param_->algo_info, *src_shape, *dst_shape, weight_data,
+                                   bias_data ? bias_data : zero_bias.data(), options.device);
+                options.algo_selects->insert(make_pair(key, conv2d_param_->algo_info.algo_type));
+                is_algo_tuned = true;
+                LOG(DEBUG) << "tuned conv[" << node->GetName() << "]: algo[" << conv2d_param_->algo_info.algo_type
+                           << "]";
+            }
+        }
 
         if (conv2d_param_->algo_info.algo_type == ppl::kernel::x86::conv2d_algo::UNKNOWN) {
             LOG(INFO) << "Conv select algorithm failed, use fallback kernel";
         } else {
             conv2d_param_->mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
                 conv2d_param_->param, conv2d_param_->algo_info, options.device->GetAllocator());
-
-            if (conv2d_param_->algo_info.algo_type == ppl::kernel::x86::conv2d_algo::WINOGRAD_B4F3) {
-                conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::DIRECT;
-                conv2d_param_->fallback_mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
+            if (!conv2d_param_->mgr && is_algo_tuned) {
+                LOG(WARNING) << "tuned algo[" << conv2d_param_->algo_info.algo_type << "] of conv["
+                             << node->GetName() << "] is unavailable. use the default algo.";
+                conv2d_param_->algo_info = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(
+                    src_shape->GetDataFormat(), conv2d_param_->param, options.device->GetISA());
+                conv2d_param_->mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
                     conv2d_param_->param, conv2d_param_->algo_info, options.device->GetAllocator());
-                conv2d_param_->infer_fallback_func = [](const TensorImpl* X, const TensorImpl* Y,
-                                                        const ppl::kernel::x86::conv2d_param* param) -> bool {
-                    const int64_t dst_h = Y->GetShape()->GetDim(2);
-                    const int64_t dst_w = Y->GetShape()->GetDim(3);
-                    const int64_t batch = X->GetShape()->GetDim(0);
-                    const int64_t num_tiles = batch * ((dst_h + 3) / 4) * ((dst_w + 3) / 4);
-                    const bool align_tiles = (dst_h % 4 == 0) && (dst_w % 4) == 0;
-
-                    const int64_t num_threads = ppl::kernel::x86::get_omp_max_threads();
-                    if (num_threads > 4) { // Maybe memory bound. Just maybe.
-                        if (param->group > 4) {
-                            if (param->channels / param->group <= 2 * 1.801f * 16) { // Multigroup need more channels
-                                return true;
-                            }
-                        }
-                        if (param->group / num_threads > 1 && num_threads / batch <= 4) { // Many group but small batch
-                            return true;
-                        }
-                    }
-                    return num_tiles < (align_tiles ? 10 : 12);
-                };
-                conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::WINOGRAD_B4F3;
+                is_algo_tuned = false;
             }
 
-            if (conv2d_param_->algo_info.algo_type == ppl::kernel::x86::conv2d_algo::WINOGRAD_B2F5S2) {
-                conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::DIRECT;
-                conv2d_param_->fallback_mgr = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(
-                    conv2d_param_->param, conv2d_param_->algo_info, options.device->GetAllocator());
-                conv2d_param_->infer_fallback_func = [](const TensorImpl* X, const TensorImpl* Y,
-                                                        const ppl::kernel::x86::conv2d_param* param) -> bool {
-                    const int64_t dst_h = Y->GetShape()->GetDim(2);
-                    const int64_t dst_w = Y->GetShape()->GetDim(3);
-                    const int64_t batch = X->GetShape()->GetDim(0);
-                    const int64_t num_tiles = batch * ((dst_h + 1) / 2) * ((dst_w + 1) / 2);
-                    const bool align_tiles = (dst_h % 2 == 0) && (dst_w % 2) == 0;
-
-                    const int64_t num_threads = ppl::kernel::x86::get_omp_max_threads();
-                    if (num_threads > 4) { // Maybe memory bound. Just maybe.
-                        if (param->group / num_threads > 1 && num_threads / batch <= 4) { // Many group but small batch
-                            return true;
-                        }
-                    }
-                    return num_tiles < (align_tiles ? 10 : 12);
-                };
-                conv2d_param_->algo_info.algo_type = ppl::kernel::x86::conv2d_algo::WINOGRAD_B2F5S2;
-            }
-
-            if (bias_data != nullptr) {
-                conv2d_param_->mgr->gen_cvt_weights(weight_data, bias_data);
-                if (conv2d_param_->fallback_mgr) {
-                    conv2d_param_->fallback_mgr->gen_cvt_weights(weight_data, bias_data);
-                }
-            } else {
-                std::vector<float> zero_bias(conv2d_param.num_output, 0.0f);
-                conv2d_param_->mgr->gen_cvt_weights(weight_data, zero_bias.data());
-                if (conv2d_param_->fallback_mgr) {
-                    conv2d_param_->fallback_mgr->gen_cvt_weights(weight_data, zero_bias.data());
-                }
+            if (is_algo_tuned) {
+                tuned_dims_.assign(src_shape->GetDims(), src_shape->GetDims() + src_shape->GetDimCount());
             }
+            InitConv2dManagers(options.device->GetAllocator());
+            GenConv2dCvtWeights(weight_data, bias_data);
         }
     } else {
         LOG(ERROR) << "Unsupported kernel dim: " << kernel_dims;
@@ -285,6 +491,186 @@ bool ConvOp::TryFuseSum() {
     return true;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ConvOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+
+    flatbuffers::Offset<pmx::x86::ConvAlgoInfo> fb_algo_info;
+    flatbuffers::Offset<flatbuffers::Vector<float>> fb_cvt_filter, fb_cvt_bias;
+    flatbuffers::Offset<flatbuffers::Vector<float>> fb_fallback_cvt_filter, fb_fallback_cvt_bias;
+    if (conv2d_param_ && conv2d_param_->algo_info.algo_type != ppl::kernel::x86::conv2d_algo::UNKNOWN) {
+        auto& algo_info = conv2d_param_->algo_info;
+        fb_algo_info = pmx::x86::CreateConvAlgoInfoDirect(private_data, algo_info.algo_type, algo_info.isa,
+                                                          algo_info.input_format, algo_info.output_format,
+                                                          &tuned_dims_);
+
+        auto mgr = conv2d_param_->mgr;
+        fb_cvt_filter = private_data.CreateVector(mgr->cvt_filter(), mgr->cvt_filter_size());
+        fb_cvt_bias = private_data.CreateVector(mgr->cvt_bias(), mgr->cvt_bias_size());
+
+        auto fallback_mgr = conv2d_param_->fallback_mgr;
+        if (fallback_mgr) {
+            fb_fallback_cvt_filter =
+                private_data.CreateVector(fallback_mgr->cvt_filter(), fallback_mgr->cvt_filter_size());
+            fb_fallback_cvt_bias = private_data.CreateVector(fallback_mgr->cvt_bias(), fallback_mgr->cvt_bias_size());
+        }
+    }
+
+    int64_t num_output = 0, channels = 0;
+    if (conv2d_param_) {
+        num_output = conv2d_param_->param.num_output;
+        channels = conv2d_param_->param.channels;
+    }
+    auto fb_param_info =
+        pmx::x86::CreateConvParamInfo(private_data, num_output, channels, aux_param_.fuse_flag, aux_param_.bias_term);
+    auto fb_dformat = private_data.CreateVector(common_param_.output_formats);
+    auto fb_conv_data =
+        pmx::x86::CreateConvData(private_data, fb_algo_info, fb_param_info, fb_dformat, fb_cvt_filter, fb_cvt_bias,
+                                 fb_fallback_cvt_filter, fb_fallback_cvt_bias);
+    auto fb_op_data = pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_ConvData, fb_conv_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeConvParam(*param_, &builder);
+    return WriteOpParam(pmx::onnx::OpParamType_ConvParam, fb_param.Union(), private_data, &builder, ds);
+}
+
+/**
+   @brief copies converted weights in `fb_filter` and `fb_bias` to buffers allocated by `allocator` for `mgr`.
+   converted weights are padded or transformed from the original ones, so they are no smaller than the original
+   `filter_elements` and `bias_elements`.
+*/
+static RetCode LoadConv2dCvtWeights(const flatbuffers::Vector<float>* fb_filter,
+                                    const flatbuffers::Vector<float>* fb_bias, uint64_t filter_elements,
+                                    uint64_t bias_elements, ppl::common::Allocator* allocator,
+                                    ppl::kernel::x86::conv2d_fp32_manager* mgr) {
+    if (!fb_filter || fb_filter->size() == 0 || !fb_bias || fb_bias->size() == 0) {
+        return RC_NOT_FOUND;
+    }
+    if (fb_filter->size() < filter_elements || fb_bias->size() < bias_elements) {
+        LOG(ERROR) << "size of converted filter[" << fb_filter->size() << "] or bias[" << fb_bias->size()
+                   << "] is less than size of the declared filter[" << filter_elements << "] or bias["
+                   << bias_elements << "].";
+        return RC_INVALID_VALUE;
+    }
+
+    auto cvt_filter = (float*)allocator->Alloc(fb_filter->size() * sizeof(float));
+    if (!cvt_filter) {
+        return RC_OUT_OF_MEMORY;
+    }
+    memcpy(cvt_filter, fb_filter->data(), fb_filter->size() * sizeof(float));
+    mgr->set_cvt_filter(cvt_filter, fb_filter->size());
+
+    auto cvt_bias = (float*)allocator->Alloc(fb_bias->size() * sizeof(float));
+    if (!cvt_bias) {
+        return RC_OUT_OF_MEMORY; // `cvt_filter` is freed by `release_cvt_weights()`
+    }
+    memcpy(cvt_bias, fb_bias->data(), fb_bias->size() * sizeof(float));
+    mgr->set_cvt_bias(cvt_bias, fb_bias->size());
+
+    return RC_SUCCESS;
+}
+
+RetCode ConvOp::DeserializeData(const pmx::DeserializationContext& ctx, const void* base, uint64_t size) {
+    auto node = GetNode();
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ConvParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    param_ = make_shared<ppl::nn::onnx::ConvParam>();
+    pmx::onnx::DeserializeConvParam(*fb_op_param->value_as_ConvParam(), param_.get());
+    aux_param_.param = param_.get();
+
+    auto fb_conv_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_ConvData();
+    if (!fb_conv_data || !fb_conv_data->param_info()) {
+        LOG(ERROR) << "private data of conv[" << node->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param_info = fb_conv_data->param_info();
+    aux_param_.fuse_flag = fb_param_info->fuse_flag();
+    aux_param_.bias_term = fb_param_info->bias_term();
+    pmx::utils::Fbvec2Stdvec(fb_conv_data->dformat(), &common_param_.output_formats);
+
+    auto fb_algo_info = fb_conv_data->algo_info();
+    if (!fb_algo_info) {
+        return RC_SUCCESS; // uses conv runtime
+    }
+
+    if ((fb_algo_info->isa() & device_->GetISA()) != fb_algo_info->isa()) {
+        LOG(ERROR) << "isa[" << fb_algo_info->isa() << "] of conv[" << node->GetName()
+                   << "] is not supported by current device isa[" << device_->GetISA() << "]";
+        return RC_UNSUPPORTED;
+    }
+
+    auto weight_shape_ref = ctx.shapes->find(node->GetInput(1));
+    if (weight_shape_ref == ctx.shapes->end()) {
+        LOG(ERROR) << "shape of weight of conv[" << node->GetName() << "] not found.";
+        return RC_NOT_FOUND;
+    }
+    const uint64_t kernel_dims = param_->kernel_shape.size() == 0 ? (weight_shape_ref->second.GetDimCount() - 2)
+                                                                  : param_->kernel_shape.size();
+
+    if (!conv2d_param_) {
+        conv2d_param_ = new Conv2dParam;
+    }
+    if (kernel_dims == 1) {
+        conv1d_param_ = conv2d_param_; // use conv1d_param_ as a flag
+    }
+
+    ppl::kernel::x86::conv2d_param& conv2d_param = conv2d_param_->param;
+    FillConv2dParam(*param_, kernel_dims, &conv2d_param);
+    conv2d_param.num_output = fb_param_info->num_output();
+    conv2d_param.channels = fb_param_info->channels();
+    conv2d_param.fuse_flag = aux_param_.fuse_flag;
+
+    const TensorShape& weight_shape = weight_shape_ref->second;
+    if (weight_shape.GetDimCount() != kernel_dims + 2 || weight_shape.GetDim(0) != conv2d_param.num_output ||
+        weight_shape.GetDim(1) * conv2d_param.group != conv2d_param.channels) {
+        LOG(ERROR) << "num_output[" << conv2d_param.num_output << "] or channels[" << conv2d_param.channels
+                   << "] of conv[" << node->GetName() << "] does not match its weight shape.";
+        return RC_INVALID_VALUE;
+    }
+    const uint64_t filter_elements = weight_shape.CalcElementsExcludingPadding();
+    const uint64_t bias_elements = conv2d_param.num_output;
+
+    conv2d_param_->algo_info.algo_type = fb_algo_info->algo_type();
+    conv2d_param_->algo_info.isa = fb_algo_info->isa();
+    conv2d_param_->algo_info.input_format = fb_algo_info->input_format();
+    conv2d_param_->algo_info.output_format = fb_algo_info->output_format();
+    pmx::utils::Fbvec2Stdvec(fb_algo_info->tuned_dims(), &tuned_dims_);
+
+    auto allocator = device_->GetAllocator();
+    conv2d_param_->mgr =
+        ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(conv2d_param, conv2d_param_->algo_info, allocator);
+    if (!conv2d_param_->mgr) {
+        LOG(ERROR) << "generate algo[" << conv2d_param_->algo_info.algo_type << "] of conv[" << node->GetName()
+                   << "] failed.";
+        return RC_UNSUPPORTED;
+    }
+    InitConv2dManagers(allocator);
+
+    auto status = LoadConv2dCvtWeights(fb_conv_data->cvt_filter(), fb_conv_data->cvt_bias(), filter_elements,
+                                       bias_elements, allocator, conv2d_param_->mgr);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "load converted weights of conv[" << node->GetName() << "] failed: " << GetRetCodeStr(status);
+        return status;
+    }
+    if (conv2d_param_->fallback_mgr) {
+        status = LoadConv2dCvtWeights(fb_conv_data->fallback_cvt_filter(), fb_conv_data->fallback_cvt_bias(),
+                                      filter_elements, bias_elements, allocator, conv2d_param_->fallback_mgr);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "load converted weights of the fallback algo of conv[" << node->GetName()
+                       << "] failed: " << GetRetCodeStr(status);
+            return status;
+        }
+    }
+
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* ConvOp::CreateKernelImpl() const {
     if (conv2d_param_ && conv2d_param_->algo_info.algo_type != ppl::kernel::x86::conv2d_algo::UNKNOWN) {
         if (conv1d_param_) return CreateKernelImplWithParam<Conv1dKernel>(conv2d_param_);
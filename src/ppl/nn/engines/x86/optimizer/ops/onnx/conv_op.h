@@ -26,7 +26,7 @@ namespace ppl { namespace nn { namespace x86 {
 class PostDepthwiseConvOp;
 class ConvOp final : public X86OptKernel {
 public:
-    ConvOp(const ir::Node* node) : X86OptKernel(node), conv2d_param_(nullptr), conv1d_param_(nullptr) {}
+    ConvOp(const ir::Node* node);
 
     ~ConvOp();
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
@@ -43,11 +43,27 @@ public:
     bool TryFuseReLU6();
     bool TryFuseSum();
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+    void SetDevice(const X86Device* device) override {
+        device_ = device;
+    }
+#endif
+
+private:
+    void InitConv2dManagers(ppl::common::Allocator* allocator);
+    void GenConv2dCvtWeights(const float* weight_data, const float* bias_data);
+
 private:
     std::shared_ptr<ppl::nn::onnx::ConvParam> param_;
     ConvParam aux_param_;
     Conv2dParam* conv2d_param_;
     Conv2dParam* conv1d_param_; // do not need alloc/free, map to conv2d_param_
+    std::vector<int64_t> tuned_dims_; // input dims that the selected algorithm is measured with
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    const X86Device* device_ = nullptr;
+#endif
 
     friend PostDepthwiseConvOp;
 };
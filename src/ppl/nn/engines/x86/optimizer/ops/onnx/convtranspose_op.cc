@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/convtranspose_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_convtranspose.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/conv_transpose.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -53,6 +58,31 @@ RetCode ConvTransposeOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ConvTransposeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeConvTransposeParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ConvTransposeParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ConvTransposeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ConvTransposeParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    // kernel dims have been checked by DoInit() before the model was exported
+    param_ = make_shared<ppl::nn::onnx::ConvTransposeParam>();
+    pmx::onnx::DeserializeConvTransposeParam(*fb_op_param->value_as_ConvTransposeParam(), param_.get());
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeConvTranspose(info, param_.get());
+    };
+    infer_type_func_ = GenericInferType;
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ConvTransposeOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ConvTransposeKernel>(param_.get());
 }
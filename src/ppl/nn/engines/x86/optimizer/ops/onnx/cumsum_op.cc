@@ -17,6 +17,11 @@
 
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/cumsum_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/cumsum_kernel.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/cumsum.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -34,6 +39,30 @@ RetCode CumSumOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode CumSumOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeCumSumParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_CumSumParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode CumSumOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_CumSumParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::CumSumParam>();
+    pmx::onnx::DeserializeCumSumParam(*fb_op_param->value_as_CumSumParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* CumSumOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<CumSumKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/depth_to_space_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_depth_to_space.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/depth_to_space.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -40,6 +45,30 @@ RetCode DepthToSpaceOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode DepthToSpaceOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeDepthToSpaceParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_DepthToSpaceParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode DepthToSpaceOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_DepthToSpaceParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::DepthToSpaceParam>();
+    pmx::onnx::DeserializeDepthToSpaceParam(*fb_op_param->value_as_DepthToSpaceParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* DepthToSpaceOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<DepthToSpaceKernel>(param_.get());
 }
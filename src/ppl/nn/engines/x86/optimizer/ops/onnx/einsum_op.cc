@@ -40,6 +40,26 @@ RetCode EinSumOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode EinSumOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateEinSumParamDirect(private_data, param_->equation.c_str());
+    return SerializeParamData(pmx::x86::ParamType_EinSumParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode EinSumOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_EinSumParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_EinSumParam();
+    auto param = make_shared<ppl::nn::onnx::EinSumParam>();
+    param->equation = fb_param->equation()->str();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* EinSumOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<EinSumKernel>(param_.get());
 }
@@ -19,11 +19,24 @@
 #include "ppl/nn/engines/x86/kernels/onnx/flatten_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_flatten.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/flatten.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+FlattenOp::FlattenOp(const ir::Node* node) : X86OptKernel(node) {
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeFlatten(info, param_.get());
+    };
+
+    infer_type_func_ = GenericInferType;
+}
+
 RetCode FlattenOp::DoInit(const OptKernelOptions& options) {
     auto status = GenericLoadParam(options, &param_);
     if (status != RC_SUCCESS) {
@@ -31,14 +44,26 @@ RetCode FlattenOp::DoInit(const OptKernelOptions& options) {
         return status;
     }
 
-    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
-        return onnx::ReshapeFlatten(info, param_.get());
-    };
+    return RC_SUCCESS;
+}
 
-    infer_type_func_ = GenericInferType;
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode FlattenOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeFlattenParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_FlattenParam, fb_param.Union(), &builder, ds);
+}
 
-    return RC_SUCCESS;
+RetCode FlattenOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_FlattenParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    param_ = make_shared<ppl::nn::onnx::FlattenParam>();
+    pmx::onnx::DeserializeFlattenParam(*fb_op_param->value_as_FlattenParam(), param_.get());
+    return DeserializeOutputData(*fb_op_param);
 }
+#endif
 
 KernelImpl* FlattenOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<FlattenKernel>(param_.get());
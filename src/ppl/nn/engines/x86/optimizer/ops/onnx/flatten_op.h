@@ -25,10 +25,15 @@ namespace ppl { namespace nn { namespace x86 {
 
 class FlattenOp final : public X86OptKernel {
 public:
-    FlattenOp(const ir::Node* node) : X86OptKernel(node) {}
+    FlattenOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+#endif
+
 private:
     std::shared_ptr<ppl::nn::onnx::FlattenParam> param_;
 };
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/gather_nd_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_gather_nd.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/gather_nd.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -40,6 +45,30 @@ RetCode GatherNDOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode GatherNDOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeGatherNDParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_GatherNDParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode GatherNDOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_GatherNDParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::GatherNDParam>();
+    pmx::onnx::DeserializeGatherNDParam(*fb_op_param->value_as_GatherNDParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* GatherNDOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<GatherNdKernel>(param_.get());
 }
@@ -19,11 +19,27 @@
 #include "ppl/nn/engines/x86/kernels/onnx/gemm_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_gemm.h"
 #include "ppl/nn/common/logger.h"
+#include <string.h>
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/gemm.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+GemmOp::GemmOp(const ir::Node* node) : X86OptKernel(node) {
+    aux_param_.post = ppl::kernel::x86::gemm_post::NONE;
+
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeGemm(info, param_.get());
+    };
+
+    infer_type_func_ = GenericInferType;
+}
+
 GemmOp::~GemmOp() {
     if (aux_param_.packed_b) ppl::common::AlignedFree(aux_param_.packed_b);
 }
@@ -38,12 +54,6 @@ RetCode GemmOp::DoInit(const OptKernelOptions& options) {
     auto node = GetNode();
     auto graph_data = options.graph_data;
 
-    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
-        return onnx::ReshapeGemm(info, param_.get());
-    };
-
-    infer_type_func_ = GenericInferType;
-
     auto b_data_it = graph_data->constants.find(node->GetInput(1));
     const float* b_data = nullptr;
     if (b_data_it != graph_data->constants.end()) {
@@ -75,6 +85,8 @@ RetCode GemmOp::DoInit(const OptKernelOptions& options) {
             aux_param_.packed_b = nullptr;
             return RC_SUCCESS;
         }
+        packed_b_bytes_ = packed_b_bytes;
+        packed_b_isa_ = isa;
     }
 
     return RC_SUCCESS;
@@ -92,10 +104,88 @@ RetCode GemmOp::OmitConstantsData(std::map<edgeid_t, int64_t>* constants_data_re
 }
 
 bool GemmOp::TryFuseReLU() {
+    if (aux_param_.fuse_gelu) {
+        return false;
+    }
     aux_param_.post = ppl::kernel::x86::gemm_post::RELU;
     return true;
 }
 
+bool GemmOp::TryFuseGELU(bool approximate) {
+    if (aux_param_.post != ppl::kernel::x86::gemm_post::NONE || aux_param_.fuse_gelu) {
+        return false;
+    }
+    aux_param_.fuse_gelu = true;
+    aux_param_.gelu_approximate = approximate;
+    return true;
+}
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode GemmOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_packed_b = private_data.CreateVector((const uint8_t*)aux_param_.packed_b,
+                                                 aux_param_.packed_b ? packed_b_bytes_ : 0);
+    auto fb_dformat = private_data.CreateVector(common_param_.output_formats);
+    const uint32_t gelu = aux_param_.fuse_gelu ? (aux_param_.gelu_approximate ? 2 : 1) : 0;
+    auto fb_gemm_data =
+        pmx::x86::CreateGemmData(private_data, aux_param_.post, packed_b_isa_, fb_packed_b, fb_dformat, gelu);
+    auto fb_op_data = pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_GemmData, fb_gemm_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeGemmParam(*param_, &builder);
+    return WriteOpParam(pmx::onnx::OpParamType_GemmParam, fb_param.Union(), private_data, &builder, ds);
+}
+
+RetCode GemmOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_GemmParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    param_ = make_shared<ppl::nn::onnx::GemmParam>();
+    pmx::onnx::DeserializeGemmParam(*fb_op_param->value_as_GemmParam(), param_.get());
+
+    auto fb_gemm_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_GemmData();
+    if (!fb_gemm_data) {
+        LOG(ERROR) << "private data of gemm[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    aux_param_.trans_a = param_->transA;
+    aux_param_.trans_b = param_->transB;
+    aux_param_.alpha = param_->alpha;
+    aux_param_.beta = param_->beta;
+    aux_param_.post = fb_gemm_data->post();
+    aux_param_.fuse_gelu = (fb_gemm_data->gelu() != 0);
+    aux_param_.gelu_approximate = (fb_gemm_data->gelu() == 2);
+    pmx::utils::Fbvec2Stdvec(fb_gemm_data->dformat(), &common_param_.output_formats);
+
+    auto fb_packed_b = fb_gemm_data->packed_b();
+    if (fb_packed_b && fb_packed_b->size() > 0) {
+        if (fb_gemm_data->isa() != device_->GetISA()) {
+            LOG(ERROR) << "matrix-B of gemm[" << GetNode()->GetName() << "] is packed for isa["
+                       << fb_gemm_data->isa() << "], which differs from current device isa[" << device_->GetISA()
+                       << "]";
+            return RC_UNSUPPORTED;
+        }
+
+        if (aux_param_.packed_b) {
+            ppl::common::AlignedFree(aux_param_.packed_b);
+        }
+        aux_param_.packed_b = (float*)ppl::common::AlignedAlloc(fb_packed_b->size(), 64);
+        if (aux_param_.packed_b == nullptr) {
+            return RC_OUT_OF_MEMORY;
+        }
+        memcpy(aux_param_.packed_b, fb_packed_b->data(), fb_packed_b->size());
+        packed_b_bytes_ = fb_packed_b->size();
+        packed_b_isa_ = fb_gemm_data->isa();
+    }
+
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* GemmOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<GemmKernel>(&aux_param_);
 }
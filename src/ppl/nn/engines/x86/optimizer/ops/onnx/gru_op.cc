@@ -67,6 +67,7 @@ RetCode GRUOp::DoInit(const OptKernelOptions& options) {
     infer_type_func_ = GenericInferType;
 
     auto isa = options.device->GetISA();
+    packed_isa_ = isa;
     auto node = GetNode();
     auto graph_data = options.graph_data;
     auto type_b = ppl::kernel::x86::gemm_m_type::TRANS;
@@ -82,6 +83,7 @@ RetCode GRUOp::DoInit(const OptKernelOptions& options) {
     auto N_w = w_shape.dims[1];
     if (w_data != nullptr) {
         auto packed_w_bytes = ppl::kernel::x86::gemm_fp32_get_packed_b_bytes(isa, N_w, K_w);
+        packed_w_bytes_ = packed_w_bytes;
         aux_param_.packed_W[0] = (float*)ppl::common::AlignedAlloc(packed_w_bytes, 64);
         if (ppl::common::RC_SUCCESS !=
             ppl::kernel::x86::gemm_fp32_pack_b(isa, w_data, type_b, N_w, K_w, w_shape.dims[2],
@@ -114,6 +116,8 @@ RetCode GRUOp::DoInit(const OptKernelOptions& options) {
         auto packed_zr_bytes = ppl::kernel::x86::gemm_fp32_get_packed_b_bytes(isa, N_r * 2, K_r);
         aux_param_.packed_Rzr[0] = (float*)ppl::common::AlignedAlloc(packed_zr_bytes, 64);
         auto packed_h_bytes = ppl::kernel::x86::gemm_fp32_get_packed_b_bytes(isa, N_r, K_r);
+        packed_zr_bytes_ = packed_zr_bytes;
+        packed_h_bytes_ = packed_h_bytes;
         aux_param_.packed_Rh[0] = (float*)ppl::common::AlignedAlloc(packed_h_bytes, 64);
         if (ppl::common::RC_SUCCESS !=
             ppl::kernel::x86::gemm_fp32_pack_b(isa, r_data, type_b, N_r * 2, K_r, r_shape.dims[2],
@@ -153,6 +157,65 @@ RetCode GRUOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode GRUOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_rnn_data = CreateRNNData(packed_isa_,
+                                     {{aux_param_.packed_W[0], packed_w_bytes_},
+                                      {aux_param_.packed_W[1], packed_w_bytes_},
+                                      {aux_param_.packed_Rzr[0], packed_zr_bytes_},
+                                      {aux_param_.packed_Rzr[1], packed_zr_bytes_},
+                                      {aux_param_.packed_Rh[0], packed_h_bytes_},
+                                      {aux_param_.packed_Rh[1], packed_h_bytes_}},
+                                     &private_data);
+    auto fb_param = pmx::x86::CreateGRUParamDirect(private_data, &param_->activation_alpha, &param_->activation_beta,
+                                                   &param_->activations, param_->clip, param_->direction,
+                                                   param_->hidden_size, param_->linear_before_reset);
+    return SerializeParamData(pmx::x86::ParamType_GRUParam, fb_param.Union(), &private_data, ds, fb_rnn_data);
+}
+
+RetCode GRUOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_GRUParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+    if (!fb_param_data->rnn_data()) {
+        LOG(ERROR) << "packed matrices of op[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_GRUParam();
+    param_ = make_shared<ppl::nn::onnx::GRUParam>();
+    pmx::utils::Fbvec2Stdvec(fb_param->activation_alpha(), &param_->activation_alpha);
+    pmx::utils::Fbvec2Stdvec(fb_param->activation_beta(), &param_->activation_beta);
+    pmx::utils::Fbvec2Stdvec(fb_param->activations(), &param_->activations);
+    param_->clip = fb_param->clip();
+    param_->direction = fb_param->direction();
+    param_->hidden_size = fb_param->hidden_size();
+    param_->linear_before_reset = fb_param->linear_before_reset();
+
+    aux_param_.param = param_.get();
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return ppl::nn::onnx::ReshapeGRU(info, param_.get());
+    };
+    infer_type_func_ = GenericInferType;
+
+    auto status = LoadRNNData(*fb_param_data->rnn_data(), device_->GetISA(),
+                              {{&aux_param_.packed_W[0], &packed_w_bytes_},
+                               {&aux_param_.packed_W[1], &packed_w_bytes_},
+                               {&aux_param_.packed_Rzr[0], &packed_zr_bytes_},
+                               {&aux_param_.packed_Rzr[1], &packed_zr_bytes_},
+                               {&aux_param_.packed_Rh[0], &packed_h_bytes_},
+                               {&aux_param_.packed_Rh[1], &packed_h_bytes_}});
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+    packed_isa_ = fb_param_data->rnn_data()->isa();
+
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* GRUOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<GRUKernel>(&aux_param_);
 }
@@ -31,9 +31,22 @@ public:
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+    void SetDevice(const X86Device* device) override {
+        device_ = device;
+    }
+#endif
+
 private:
     std::shared_ptr<ppl::nn::onnx::GRUParam> param_;
     GRUParam aux_param_;
+    uint64_t packed_w_bytes_ = 0;
+    uint64_t packed_zr_bytes_ = 0;
+    uint64_t packed_h_bytes_ = 0;
+    ppl::common::isa_t packed_isa_ = 0; // isa that matrices in `aux_param_` are packed for
+    const X86Device* device_ = nullptr;
 };
 
 }}} // namespace ppl::nn::x86
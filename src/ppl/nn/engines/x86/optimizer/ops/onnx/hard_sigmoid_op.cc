@@ -43,6 +43,27 @@ RetCode HardSigmoidOp::SelectFormat(const InputOutputInfo& info, vector<dataform
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode HardSigmoidOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateHardSigmoidParam(private_data, param_->alpha, param_->beta);
+    return SerializeParamData(pmx::x86::ParamType_HardSigmoidParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode HardSigmoidOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_HardSigmoidParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_HardSigmoidParam();
+    auto param = make_shared<ppl::nn::onnx::HardSigmoidParam>();
+    param->alpha = fb_param->alpha();
+    param->beta = fb_param->beta();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* HardSigmoidOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<HardSigmoidKernel>(param_.get());
 }
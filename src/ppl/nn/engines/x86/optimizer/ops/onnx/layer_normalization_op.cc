@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/layer_normalization_op.h"
+#include "ppl/nn/engines/x86/kernels/pmx/layer_norm_kernel.h"
+#include "ppl/nn/oputils/onnx/reshape_layer_normalization.h"
+#include "ppl/nn/common/logger.h"
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+RetCode LayerNormalizationOp::DoInit(const OptKernelOptions& options) {
+    auto status = GenericLoadParam(options, &param_);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "load param failed: " << GetRetCodeStr(status);
+        return status;
+    }
+
+    // statistics are computed in fp32, which is what the default stash_type(1) means
+    if (param_->stash_type != 1) {
+        LOG(ERROR) << "unsupported stash_type[" << param_->stash_type << "] of LayerNormalization["
+                   << GetNode()->GetName() << "]. only 1(float) is supported.";
+        return RC_UNSUPPORTED;
+    }
+
+    kernel_param_.elementwise_affine = true;
+    kernel_param_.axis = param_->axis;
+    kernel_param_.eps = param_->epsilon;
+    kernel_param_.skip_term = false;
+
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeLayerNormalization(info, param_.get());
+    };
+
+    infer_type_func_ = [](InputOutputInfo* info) -> void {
+        GenericInferType(info);
+        // Mean and InvStdDev are computed in fp32
+        for (uint32_t i = 1; i < info->GetOutputCount(); ++i) {
+            info->GetOutput<TensorImpl>(i)->GetShape()->SetDataType(DATATYPE_FLOAT32);
+        }
+    };
+
+    return RC_SUCCESS;
+}
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode LayerNormalizationOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param =
+        pmx::x86::CreateLayerNormalizationParam(private_data, param_->axis, param_->epsilon, param_->stash_type);
+    return SerializeParamData(pmx::x86::ParamType_LayerNormalizationParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode LayerNormalizationOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_LayerNormalizationParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_LayerNormalizationParam();
+    auto param = make_shared<ppl::nn::onnx::LayerNormalizationParam>();
+    param->axis = fb_param->axis();
+    param->epsilon = fb_param->epsilon();
+    param->stash_type = fb_param->stash_type();
+    return InitWithParam(param);
+}
+#endif
+
+KernelImpl* LayerNormalizationOp::CreateKernelImpl() const {
+    return CreateKernelImplWithParam<LayerNormKernel>(&kernel_param_);
+}
+
+}}} // namespace ppl::nn::x86
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_OPTIMIZER_OPS_ONNX_LAYER_NORMALIZATION_OP_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_OPTIMIZER_OPS_ONNX_LAYER_NORMALIZATION_OP_H_
+
+#include "ppl/nn/params/onnx/layer_normalization_param.h"
+#include "ppl/nn/params/pmx/layer_norm_param.h"
+#include "ppl/nn/engines/x86/optimizer/opt_kernel.h"
+
+namespace ppl { namespace nn { namespace x86 {
+
+class LayerNormalizationOp final : public X86OptKernel {
+public:
+    LayerNormalizationOp(const ir::Node* node) : X86OptKernel(node) {}
+    ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
+    KernelImpl* CreateKernelImpl() const override;
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+#endif
+
+private:
+    std::shared_ptr<ppl::nn::onnx::LayerNormalizationParam> param_;
+    ppl::nn::pmx::LayerNormParam kernel_param_; // shares the kernel with pmx.LayerNorm
+};
+
+}}} // namespace ppl::nn::x86
+
+#endif
@@ -18,6 +18,11 @@
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/leaky_relu_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/leaky_relu_kernel.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/leaky_relu.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -43,6 +48,30 @@ RetCode LeakyReluOp::SelectFormat(const InputOutputInfo& info, vector<dataformat
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode LeakyReluOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeLeakyReluParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_LeakyReluParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode LeakyReluOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_LeakyReluParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::LeakyReluParam>();
+    pmx::onnx::DeserializeLeakyReluParam(*fb_op_param->value_as_LeakyReluParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* LeakyReluOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<LeakyReluKernel>(param_.get());
 }
@@ -22,6 +22,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/lstm_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_lstm.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/lstm.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -64,6 +69,7 @@ RetCode LSTMOp::DoInit(const OptKernelOptions& options) {
 
     infer_type_func_ = GenericInferType;
     auto isa = options.device->GetISA();
+    packed_isa_ = isa;
     auto node = GetNode();
     auto graph_data = options.graph_data;
     auto w_data_it = graph_data->constants.find(node->GetInput(1));
@@ -78,6 +84,7 @@ RetCode LSTMOp::DoInit(const OptKernelOptions& options) {
     auto N_w = w_shape.dims[1];
     if (w_data != nullptr) {
         auto packed_w_bytes = ppl::kernel::x86::gemm_fp32_get_packed_b_bytes(isa, N_w, K_w);
+        packed_w_bytes_ = packed_w_bytes;
         aux_param_.packed_w[0] = (float*)ppl::common::AlignedAlloc(packed_w_bytes, 64);
         if (ppl::common::RC_SUCCESS !=
             ppl::kernel::x86::gemm_fp32_pack_b(isa, w_data, type_b, N_w, K_w, w_shape.dims[2],
@@ -108,6 +115,7 @@ RetCode LSTMOp::DoInit(const OptKernelOptions& options) {
     }
     if (r_data != nullptr) {
         auto packed_r_bytes = ppl::kernel::x86::gemm_fp32_get_packed_b_bytes(isa, N_r, K_r);
+        packed_r_bytes_ = packed_r_bytes;
         aux_param_.packed_r[0] = (float*)ppl::common::AlignedAlloc(packed_r_bytes, 64);
         if (ppl::common::RC_SUCCESS !=
             ppl::kernel::x86::gemm_fp32_pack_b(isa, r_data, type_b, N_r, K_r, r_shape.dims[2],
@@ -148,6 +156,58 @@ RetCode LSTMOp::OmitConstantsData(std::map<edgeid_t, int64_t>* constants_data_re
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode LSTMOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    // constants of packed matrices are omitted, so the packed ones are saved instead
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_rnn_data = CreateRNNData(packed_isa_,
+                                     {{aux_param_.packed_w[0], packed_w_bytes_},
+                                      {aux_param_.packed_w[1], packed_w_bytes_},
+                                      {aux_param_.packed_r[0], packed_r_bytes_},
+                                      {aux_param_.packed_r[1], packed_r_bytes_}},
+                                     &private_data);
+    auto fb_op_data = pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_RNNData, fb_rnn_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeLSTMParam(*param_, &builder);
+    return WriteOpParam(pmx::onnx::OpParamType_LSTMParam, fb_param.Union(), private_data, &builder, ds);
+}
+
+RetCode LSTMOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_LSTMParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    auto fb_rnn_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_RNNData();
+    if (!fb_rnn_data) {
+        LOG(ERROR) << "private data of op[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    param_ = make_shared<ppl::nn::onnx::LSTMParam>();
+    pmx::onnx::DeserializeLSTMParam(*fb_op_param->value_as_LSTMParam(), param_.get());
+    aux_param_.param = param_.get();
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapeLSTM(info, param_.get());
+    };
+    infer_type_func_ = GenericInferType;
+
+    auto status = LoadRNNData(*fb_rnn_data, device_->GetISA(),
+                              {{&aux_param_.packed_w[0], &packed_w_bytes_},
+                               {&aux_param_.packed_w[1], &packed_w_bytes_},
+                               {&aux_param_.packed_r[0], &packed_r_bytes_},
+                               {&aux_param_.packed_r[1], &packed_r_bytes_}});
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+    packed_isa_ = fb_rnn_data->isa();
+
+    pmx::utils::Fbvec2Stdvec(fb_rnn_data->dformat(), &common_param_.output_formats);
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* LSTMOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<LSTMKernel>(&aux_param_);
 }
@@ -18,23 +18,27 @@
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/matmul_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/matmul_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_matmul.h"
+#include "ppl/nn/common/logger.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
+#include <string.h>
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-MatMulOp::~MatMulOp() {
-    if (aux_param_.packed_b) ppl::common::AlignedFree(aux_param_.packed_b);
-}
-
-RetCode MatMulOp::DoInit(const OptKernelOptions& options) {
+MatMulOp::MatMulOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = [](InputOutputInfo* info) -> RetCode {
         return onnx::ReshapeMatMul(info, nullptr);
     };
 
     infer_type_func_ = GenericInferType;
+}
+
+MatMulOp::~MatMulOp() {
+    if (aux_param_.packed_b) ppl::common::AlignedFree(aux_param_.packed_b);
+}
 
+RetCode MatMulOp::DoInit(const OptKernelOptions& options) {
     auto node = GetNode();
     auto graph_data = options.graph_data;
 
@@ -75,6 +79,8 @@ RetCode MatMulOp::DoInit(const OptKernelOptions& options) {
                 aux_param_.packed_b = nullptr;
                 return RC_SUCCESS;
             }
+            packed_b_bytes_ = packed_b_bytes;
+            packed_b_isa_ = isa;
         }
     }
 
@@ -92,6 +98,93 @@ RetCode MatMulOp::OmitConstantsData(std::map<edgeid_t, int64_t>* constants_data_
     return RC_SUCCESS;
 }
 
+bool MatMulOp::TryFuseReLU() {
+    if (!CanFuseBiasAndActivation() || HasFusedActivation()) {
+        return false;
+    }
+    aux_param_.post = ppl::kernel::x86::gemm_post::RELU;
+    return true;
+}
+
+bool MatMulOp::TryFuseReLU6() {
+    if (!CanFuseBiasAndActivation() || HasFusedActivation()) {
+        return false;
+    }
+    aux_param_.post = ppl::kernel::x86::gemm_post::RELU6;
+    return true;
+}
+
+bool MatMulOp::TryFuseGELU(bool approximate) {
+    if (HasFusedActivation()) {
+        return false;
+    }
+    aux_param_.fuse_gelu = true;
+    aux_param_.gelu_approximate = approximate;
+    return true;
+}
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MatMulOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_packed_b = private_data.CreateVector((const uint8_t*)aux_param_.packed_b,
+                                                 aux_param_.packed_b ? packed_b_bytes_ : 0);
+    auto fb_dformat = private_data.CreateVector(common_param_.output_formats);
+    const uint32_t gelu = aux_param_.fuse_gelu ? (aux_param_.gelu_approximate ? 2 : 1) : 0;
+    auto fb_matmul_data =
+        pmx::x86::CreateMatMulData(private_data, aux_param_.post, packed_b_isa_, fb_packed_b, fb_dformat, gelu);
+    auto fb_op_data =
+        pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_MatMulData, fb_matmul_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    return WriteOpParam(pmx::onnx::OpParamType_NONE, 0, private_data, &builder, ds);
+}
+
+RetCode MatMulOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NONE);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_matmul_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_MatMulData();
+    if (!fb_matmul_data) {
+        LOG(ERROR) << "private data of matmul[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    aux_param_.post = fb_matmul_data->post();
+    aux_param_.fuse_gelu = (fb_matmul_data->gelu() != 0);
+    aux_param_.gelu_approximate = (fb_matmul_data->gelu() == 2);
+    pmx::utils::Fbvec2Stdvec(fb_matmul_data->dformat(), &common_param_.output_formats);
+
+    auto fb_packed_b = fb_matmul_data->packed_b();
+    if (fb_packed_b && fb_packed_b->size() > 0) {
+        if (fb_matmul_data->isa() != device_->GetISA()) {
+            LOG(ERROR) << "matrix-B of matmul[" << GetNode()->GetName() << "] is packed for isa["
+                       << fb_matmul_data->isa() << "], which differs from current device isa[" << device_->GetISA()
+                       << "]";
+            return RC_UNSUPPORTED;
+        }
+
+        if (aux_param_.packed_b) {
+            ppl::common::AlignedFree(aux_param_.packed_b);
+        }
+        aux_param_.packed_b = (float*)ppl::common::AlignedAlloc(fb_packed_b->size(), 64);
+        if (aux_param_.packed_b == nullptr) {
+            return RC_OUT_OF_MEMORY;
+        }
+        memcpy(aux_param_.packed_b, fb_packed_b->data(), fb_packed_b->size());
+        packed_b_bytes_ = fb_packed_b->size();
+        packed_b_isa_ = fb_matmul_data->isa();
+    } else if (aux_param_.post != ppl::kernel::x86::gemm_post::NONE || GetNode()->GetInputCount() > 2) {
+        LOG(ERROR) << "fused bias or activation of matmul[" << GetNode()->GetName() << "] needs packed matrix-B.";
+        return RC_INVALID_VALUE;
+    }
+
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* MatMulOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MatMulKernel>(&aux_param_);
 }
@@ -25,14 +25,39 @@ namespace ppl { namespace nn { namespace x86 {
 
 class MatMulOp final : public X86OptKernel {
 public:
-    MatMulOp(const ir::Node* node) : X86OptKernel(node) {}
+    MatMulOp(const ir::Node* node);
     ~MatMulOp();
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
     ppl::common::RetCode OmitConstantsData(std::map<edgeid_t, int64_t>* constants_data_refcount) override;
 
+    /** @brief bias and activations are fused only if B is a packed 2D matrix */
+    bool CanFuseBiasAndActivation() const {
+        return (aux_param_.packed_b != nullptr);
+    }
+    bool HasFusedActivation() const {
+        return (aux_param_.post != ppl::kernel::x86::gemm_post::NONE || aux_param_.fuse_gelu);
+    }
+    bool TryFuseReLU();
+    bool TryFuseReLU6();
+    /** @brief gelu is applied to the output of any matmul and does not need packed B */
+    bool TryFuseGELU(bool approximate);
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+    void SetDevice(const X86Device* device) override {
+        device_ = device;
+    }
+#endif
+
 private:
     MatMulParam aux_param_;
+    uint64_t packed_b_bytes_ = 0;
+    ppl::common::isa_t packed_b_isa_ = 0; // isa that `aux_param_.packed_b` is packed for
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    const X86Device* device_ = nullptr;
+#endif
 };
 
 }}} // namespace ppl::nn::x86
@@ -19,11 +19,24 @@
 #include "ppl/nn/engines/x86/kernels/onnx/maxpool_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_pooling.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/pooling.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+MaxPoolOp::MaxPoolOp(const ir::Node* node) : X86OptKernel(node) {
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        return onnx::ReshapePooling(info, param_.get());
+    };
+
+    infer_type_func_ = GenericInferType;
+}
+
 RetCode MaxPoolOp::DoInit(const OptKernelOptions& options) {
     auto status = GenericLoadParam(options, &param_);
     if (status != RC_SUCCESS) {
@@ -37,12 +50,6 @@ RetCode MaxPoolOp::DoInit(const OptKernelOptions& options) {
         return ppl::common::RC_UNSUPPORTED;
     }
 
-    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
-        return onnx::ReshapePooling(info, param_.get());
-    };
-
-    infer_type_func_ = GenericInferType;
-
     return RC_SUCCESS;
 }
 
@@ -55,6 +62,24 @@ RetCode MaxPoolOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MaxPoolOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializePoolingParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_PoolingParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode MaxPoolOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_PoolingParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    param_ = make_shared<ppl::nn::onnx::PoolingParam>();
+    pmx::onnx::DeserializePoolingParam(*fb_op_param->value_as_PoolingParam(), param_.get());
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* MaxPoolOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MaxPoolKernel>(param_.get());
 }
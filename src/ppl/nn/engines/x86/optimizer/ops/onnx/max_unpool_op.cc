@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/max_unpool_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_maxunpool.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/maxunpool.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -63,6 +68,30 @@ RetCode MaxUnPoolOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode MaxUnPoolOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeMaxUnpoolParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_MaxUnpoolParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode MaxUnPoolOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_MaxUnpoolParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::MaxUnpoolParam>();
+    pmx::onnx::DeserializeMaxUnpoolParam(*fb_op_param->value_as_MaxUnpoolParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* MaxUnPoolOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<MaxUnpoolKernel>(param_.get());
 }
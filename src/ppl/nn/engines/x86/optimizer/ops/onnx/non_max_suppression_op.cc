@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/non_max_suppression_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_non_max_suppression.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/non_max_suppression.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -42,6 +47,30 @@ RetCode NonMaxSupressionOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode NonMaxSupressionOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeNonMaxSuppressionParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_NonMaxSuppressionParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode NonMaxSupressionOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NonMaxSuppressionParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::NonMaxSuppressionParam>();
+    pmx::onnx::DeserializeNonMaxSuppressionParam(*fb_op_param->value_as_NonMaxSuppressionParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* NonMaxSupressionOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<NonMaxSuppressionKernel>(param_.get());
 }
@@ -40,6 +40,26 @@ RetCode OneHotOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode OneHotOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateOneHotParam(private_data, param_->axis);
+    return SerializeParamData(pmx::x86::ParamType_OneHotParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode OneHotOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_OneHotParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_OneHotParam();
+    auto param = make_shared<ppl::nn::onnx::OneHotParam>();
+    param->axis = fb_param->axis();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* OneHotOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<OneHotKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/pad_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_pad.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/pad.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -59,6 +64,30 @@ RetCode PadOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>* s
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode PadOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializePadParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_PadParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode PadOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_PadParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::PadParam>();
+    pmx::onnx::DeserializePadParam(*fb_op_param->value_as_PadParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* PadOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<PadKernel>(param_.get());
 }
@@ -47,6 +47,31 @@ RetCode RandomUniformOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode RandomUniformOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateRandomUniformParamDirect(private_data, param_->dtype, param_->high, param_->low,
+                                                             &param_->seed, &param_->shape);
+    return SerializeParamData(pmx::x86::ParamType_RandomUniformParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode RandomUniformOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_RandomUniformParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_RandomUniformParam();
+    auto param = make_shared<ppl::nn::onnx::RandomUniformParam>();
+    param->dtype = fb_param->dtype();
+    param->high = fb_param->high();
+    param->low = fb_param->low();
+    pmx::utils::Fbvec2Stdvec(fb_param->seed(), &param->seed);
+    pmx::utils::Fbvec2Stdvec(fb_param->shape(), &param->shape);
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* RandomUniformOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<RandomUniformKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/reduce_prod_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_reduce.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/reduce.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -49,6 +54,30 @@ RetCode ReduceProdOp::SelectFormat(const InputOutputInfo& info, vector<dataforma
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ReduceProdOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeReduceParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ReduceParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ReduceProdOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ReduceParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::ReduceParam>();
+    pmx::onnx::DeserializeReduceParam(*fb_op_param->value_as_ReduceParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ReduceProdOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ReduceProdKernel>(param_.get());
 }
@@ -22,9 +22,12 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode ReluOp::DoInit(const OptKernelOptions& options) {
+ReluOp::ReluOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = GenericInferDims;
     infer_type_func_ = GenericInferType;
+}
+
+RetCode ReluOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
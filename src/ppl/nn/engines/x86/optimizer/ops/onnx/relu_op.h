@@ -24,7 +24,7 @@ namespace ppl { namespace nn { namespace x86 {
 
 class ReluOp final : public X86OptKernel {
 public:
-    ReluOp(const ir::Node* node) : X86OptKernel(node) {}
+    ReluOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
     ppl::common::RetCode SelectFormat(const InputOutputInfo& info,
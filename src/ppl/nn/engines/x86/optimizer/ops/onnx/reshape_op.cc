@@ -39,6 +39,26 @@ RetCode ReshapeOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ReshapeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateReshapeParam(private_data, param_->allowzero);
+    return SerializeParamData(pmx::x86::ParamType_ReshapeParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode ReshapeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_ReshapeParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_ReshapeParam();
+    auto param = make_shared<ppl::nn::onnx::ReshapeParam>();
+    param->allowzero = fb_param->allowzero();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* ReshapeOp::CreateKernelImpl() const {
     return CreateKernelImplWithoutParam<ReshapeKernel>();
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/resize_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_resize.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/resize.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -52,6 +57,30 @@ RetCode ResizeOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ResizeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeResizeParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ResizeParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ResizeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ResizeParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::ResizeParam>();
+    pmx::onnx::DeserializeResizeParam(*fb_op_param->value_as_ResizeParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ResizeOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ResizeKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/roialign_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_roialign.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/roialign.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -68,6 +73,30 @@ RetCode ROIAlignOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ROIAlignOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeRoiAlignParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_RoiAlignParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ROIAlignOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_RoiAlignParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::RoiAlignParam>();
+    pmx::onnx::DeserializeRoiAlignParam(*fb_op_param->value_as_RoiAlignParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ROIAlignOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ROIAlignKernel>(param_.get());
 }
@@ -18,6 +18,11 @@
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/scatter_elements_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/scatter_elements_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_scatter_elements.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/scatter_elements.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -39,6 +44,30 @@ RetCode ScatterElementsOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ScatterElementsOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeScatterElementsParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_ScatterElementsParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode ScatterElementsOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_ScatterElementsParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::ScatterElementsParam>();
+    pmx::onnx::DeserializeScatterElementsParam(*fb_op_param->value_as_ScatterElementsParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* ScatterElementsOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ScatterElementsKernel>(param_.get());
 }
@@ -22,9 +22,12 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode SigmoidOp::DoInit(const OptKernelOptions& options) {
+SigmoidOp::SigmoidOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = GenericInferDims;
     infer_type_func_ = GenericInferType;
+}
+
+RetCode SigmoidOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
@@ -24,7 +24,7 @@ namespace ppl { namespace nn { namespace x86 {
 
 class SigmoidOp final : public X86OptKernel {
 public:
-    SigmoidOp(const ir::Node* node) : X86OptKernel(node) {}
+    SigmoidOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
     ppl::common::RetCode SelectFormat(const InputOutputInfo& info,
@@ -18,11 +18,21 @@
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/softmax_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/softmax_kernel.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/softmax.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+SoftmaxOp::SoftmaxOp(const ir::Node* node) : X86OptKernel(node) {
+    infer_dims_func_ = GenericInferDims;
+    infer_type_func_ = GenericInferType;
+}
+
 RetCode SoftmaxOp::DoInit(const OptKernelOptions& options) {
     auto status = GenericLoadParam(options, &param_);
     if (status != RC_SUCCESS) {
@@ -30,12 +40,27 @@ RetCode SoftmaxOp::DoInit(const OptKernelOptions& options) {
         return status;
     }
 
-    infer_dims_func_ = GenericInferDims;
-    infer_type_func_ = GenericInferType;
-
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode SoftmaxOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeSoftmaxParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_SoftmaxParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode SoftmaxOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_SoftmaxParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    param_ = make_shared<ppl::nn::onnx::SoftmaxParam>();
+    pmx::onnx::DeserializeSoftmaxParam(*fb_op_param->value_as_SoftmaxParam(), param_.get());
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* SoftmaxOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<SoftmaxKernel>(param_.get());
 }
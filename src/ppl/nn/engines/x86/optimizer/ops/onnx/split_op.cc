@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/split_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_split.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/split.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -56,6 +61,30 @@ RetCode SplitOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>*
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode SplitOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeSplitParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_SplitParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode SplitOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_SplitParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::SplitParam>();
+    pmx::onnx::DeserializeSplitParam(*fb_op_param->value_as_SplitParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* SplitOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<SplitKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/squeeze_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_squeeze.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/squeeze.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -43,6 +48,30 @@ RetCode SqueezeOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode SqueezeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeSqueezeParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_SqueezeParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode SqueezeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_SqueezeParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::SqueezeParam>();
+    pmx::onnx::DeserializeSqueezeParam(*fb_op_param->value_as_SqueezeParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* SqueezeOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<SqueezeKernel>(param_.get());
 }
@@ -18,18 +18,21 @@
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/sub_op.h"
 #include "ppl/nn/engines/x86/kernels/onnx/sub_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_add.h"
+#include "ppl/nn/common/logger.h"
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode SubOp::DoInit(const OptKernelOptions& options) {
+SubOp::SubOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = [](InputOutputInfo* info) -> RetCode {
         return onnx::ReshapeAdd(info, nullptr);
     };
 
     infer_type_func_ = GenericInferType;
+}
 
+RetCode SubOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
@@ -44,6 +47,35 @@ RetCode SubOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>* s
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode SubOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_fusion_data = pmx::x86::CreateFusionDataDirect(private_data, fuse_relu_, &common_param_.output_formats);
+    auto fb_op_data =
+        pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_FusionData, fb_fusion_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    return WriteOpParam(pmx::onnx::OpParamType_NONE, 0, private_data, &builder, ds);
+}
+
+RetCode SubOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NONE);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+    auto fb_fusion_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_FusionData();
+    if (!fb_fusion_data) {
+        LOG(ERROR) << "private data of op[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    fuse_relu_ = (fb_fusion_data->fuse_relu() != 0);
+    pmx::utils::Fbvec2Stdvec(fb_fusion_data->dformat(), &common_param_.output_formats);
+    return RC_SUCCESS;
+}
+#endif
+
 KernelImpl* SubOp::CreateKernelImpl() const {
     auto kernel = CreateKernelImplWithoutParam<SubKernel>();
     if (kernel) {
@@ -24,7 +24,7 @@ namespace ppl { namespace nn { namespace x86 {
 
 class SubOp final : public X86OptKernel {
 public:
-    SubOp(const ir::Node* node) : X86OptKernel(node) {}
+    SubOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
     ppl::common::RetCode SelectFormat(const InputOutputInfo& info,
@@ -38,6 +38,11 @@ public:
         return fuse_relu_;
     }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+#endif
+
 private:
     bool fuse_relu_ = false;
 };
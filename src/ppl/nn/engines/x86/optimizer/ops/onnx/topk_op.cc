@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/topk_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_topk.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/topk.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -44,6 +49,30 @@ RetCode TopKOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode TopKOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeTopKParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_TopKParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode TopKOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_TopKParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::TopKParam>();
+    pmx::onnx::DeserializeTopKParam(*fb_op_param->value_as_TopKParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* TopKOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<TopKKernel>(param_.get());
 }
@@ -19,6 +19,11 @@
 #include "ppl/nn/engines/x86/kernels/onnx/transpose_kernel.h"
 #include "ppl/nn/oputils/onnx/reshape_transpose.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/oputils/onnx/transpose.h"
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
@@ -52,6 +57,30 @@ RetCode TransposeOp::SelectFormat(const InputOutputInfo& info, vector<dataformat
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode TransposeOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder builder;
+    auto fb_param = pmx::onnx::SerializeTransposeParam(*param_, &builder);
+    return SerializeOutputData(pmx::onnx::OpParamType_TransposeParam, fb_param.Union(), &builder, ds);
+}
+
+RetCode TransposeOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_TransposeParam);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto param = make_shared<ppl::nn::onnx::TransposeParam>();
+    pmx::onnx::DeserializeTransposeParam(*fb_op_param->value_as_TransposeParam(), param.get());
+    auto status = InitWithParam(param);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+#endif
+
 KernelImpl* TransposeOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<TransposeKernel>(param_.get());
 }
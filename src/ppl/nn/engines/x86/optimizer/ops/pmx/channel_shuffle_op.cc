@@ -93,6 +93,26 @@ RetCode ChannelShuffleOp::SelectFormat(const InputOutputInfo& info, vector<dataf
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ChannelShuffleOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateChannelShuffleParam(private_data, param_->group);
+    return SerializeParamData(pmx::x86::ParamType_ChannelShuffleParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode ChannelShuffleOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_ChannelShuffleParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_ChannelShuffleParam();
+    auto param = make_shared<ppl::nn::pmx::ChannelShuffleParam>();
+    param->group = fb_param->group();
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* ChannelShuffleOp::CreateKernelImpl() const {
     return CreateKernelImplWithParam<ChannelShuffleKernel>(param_.get());
 }
@@ -33,6 +33,11 @@ public:
                                       std::vector<ppl::common::dataformat_t>* selected_output_formats) override;
     void SetGroup(int group);
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+#endif
+
 private:
     std::shared_ptr<ppl::nn::pmx::ChannelShuffleParam> param_;
 };
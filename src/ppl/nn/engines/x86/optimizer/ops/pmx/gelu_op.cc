@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/gelu_op.h"
+#include "ppl/nn/engines/x86/kernels/pmx/gelu_kernel.h"
+#include "ppl/nn/common/logger.h"
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+RetCode GeluOp::DoInit(const OptKernelOptions& options) {
+    auto status = GenericLoadParam(options, &param_);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "load param failed: " << GetRetCodeStr(status);
+        return status;
+    }
+
+    infer_type_func_ = GenericInferType;
+    infer_dims_func_ = GenericInferDims;
+    return RC_SUCCESS;
+}
+
+RetCode GeluOp::SelectFormat(const InputOutputInfo& info, vector<dataformat_t>* selected_input_formats,
+                             vector<dataformat_t>* selected_output_formats) {
+    selected_input_formats->at(0) = info.GetInput<TensorImpl>(0)->GetShape()->GetDataFormat();
+    selected_output_formats->at(0) = info.GetInput<TensorImpl>(0)->GetShape()->GetDataFormat();
+    return RC_SUCCESS;
+}
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode GeluOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateGELUParam(private_data, param_->approximate);
+    return SerializeParamData(pmx::x86::ParamType_GELUParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode GeluOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_GELUParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_GELUParam();
+    auto param = make_shared<ppl::nn::pmx::GELUParam>();
+    param->approximate = fb_param->approximate();
+    return InitWithParam(param);
+}
+#endif
+
+KernelImpl* GeluOp::CreateKernelImpl() const {
+    return CreateKernelImplWithParam<GeluKernel>(param_.get());
+}
+
+}}} // namespace ppl::nn::x86
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/layer_norm_op.h"
+#include "ppl/nn/engines/x86/kernels/pmx/layer_norm_kernel.h"
+#include "ppl/nn/common/logger.h"
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+RetCode LayerNormOp::DoInit(const OptKernelOptions& options) {
+    auto status = GenericLoadParam(options, &param_);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "load param failed: " << GetRetCodeStr(status);
+        return status;
+    }
+
+    if (param_->skip_term) {
+        LOG(ERROR) << "LayerNorm with skip_term is not supported.";
+        return RC_UNSUPPORTED;
+    }
+
+    infer_type_func_ = GenericInferType;
+
+    infer_dims_func_ = [this](InputOutputInfo* info) -> RetCode {
+        if (param_->elementwise_affine && info->GetInputCount() < 2) {
+            LOG(DEBUG) << "ERROR: input count[" << info->GetInputCount() << "] < 2 when elementwise_affine is true.";
+            return RC_INVALID_VALUE;
+        }
+
+        // scale and shift are not broadcasted. they must have as many elements as the normalized dims.
+        auto in_shape0 = info->GetInput<TensorImpl>(0)->GetShape();
+        const int32_t dim_count = in_shape0->GetDimCount();
+        const int32_t axis = param_->axis < 0 ? param_->axis + dim_count : param_->axis;
+        if (axis < 0 || axis >= dim_count) {
+            LOG(DEBUG) << "ERROR: axis[" << param_->axis << "] is out of range[" << -dim_count << ", " << dim_count
+                       << ").";
+            return RC_INVALID_VALUE;
+        }
+        uint64_t normalized_elem_count = 1;
+        for (int32_t i = axis; i < dim_count; ++i) {
+            normalized_elem_count *= in_shape0->GetDim(i);
+        }
+        for (uint32_t i = 1; i < info->GetInputCount(); ++i) {
+            auto input = info->GetInput<TensorImpl>(i);
+            if (input && input->GetShape()->CalcElementsExcludingPadding() != normalized_elem_count) {
+                LOG(DEBUG) << "ERROR: element count of input[" << i << "] != element count of normalized dims["
+                           << normalized_elem_count << "].";
+                return RC_INVALID_VALUE;
+            }
+        }
+
+        return GenericInferDims(info);
+    };
+
+    return RC_SUCCESS;
+}
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode LayerNormOp::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_param = pmx::x86::CreateLayerNormParam(private_data, param_->elementwise_affine, param_->axis,
+                                                   param_->eps, param_->skip_term);
+    return SerializeParamData(pmx::x86::ParamType_LayerNormParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode LayerNormOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_LayerNormParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_LayerNormParam();
+    auto param = make_shared<ppl::nn::pmx::LayerNormParam>();
+    param->elementwise_affine = fb_param->elementwise_affine();
+    param->axis = fb_param->axis();
+    param->eps = fb_param->eps();
+    param->skip_term = fb_param->skip_term();
+    return InitWithParam(param);
+}
+#endif
+
+KernelImpl* LayerNormOp::CreateKernelImpl() const {
+    return CreateKernelImplWithParam<LayerNormKernel>(param_.get());
+}
+
+}}} // namespace ppl::nn::x86
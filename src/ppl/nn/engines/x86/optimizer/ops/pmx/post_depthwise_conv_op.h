@@ -41,6 +41,16 @@ public:
     static PostDepthwiseConv2dParam* TryMakePostDepthwiseConv2dParam(
         ConvOp *conv_op, ConvOp *post_conv_op);
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    /** @brief converted weights of the fused convs are not exported yet */
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+#endif
+
 private:
     PostDepthwiseConv2dParam *pd_conv2d_param_;
 };
@@ -22,7 +22,7 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
-RetCode ReorderOp::DoInit(const OptKernelOptions& options) {
+ReorderOp::ReorderOp(const ir::Node* node) : X86OptKernel(node) {
     infer_dims_func_ = [](InputOutputInfo* info) -> RetCode {
         auto& input = *info->GetInput<TensorImpl>(0)->GetShape();
         auto& output = *info->GetOutput<TensorImpl>(0)->GetShape();
@@ -40,6 +40,9 @@ RetCode ReorderOp::DoInit(const OptKernelOptions& options) {
     };
 
     infer_type_func_ = GenericInferType;
+}
+
+RetCode ReorderOp::DoInit(const OptKernelOptions& options) {
     return RC_SUCCESS;
 }
 
@@ -24,7 +24,7 @@ namespace ppl { namespace nn { namespace x86 {
 
 class ReorderOp final : public X86OptKernel {
 public:
-    ReorderOp(const ir::Node* node) : X86OptKernel(node) {}
+    ReorderOp(const ir::Node* node);
     ppl::common::RetCode DoInit(const OptKernelOptions& options) override;
     KernelImpl* CreateKernelImpl() const override;
 };
@@ -19,6 +19,7 @@
 
 #include "ppl/nn/common/logger.h"
 #include "ppl/nn/engines/common/pmx/shape_operation_kernel.h"
+#include <string.h>
 
 using namespace std;
 using namespace ppl::common;
@@ -40,6 +41,54 @@ RetCode ShapeOperationOp::SelectFormat(const InputOutputInfo& info, vector<dataf
     return RC_SUCCESS;
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode ShapeOperationOp::SerializeData(const pmx::SerializationContext& ctx, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    const uint32_t width = ppl::nn::pmx::ShapeMatrix::MAXDIMSIZE + 1;
+    const uint32_t matrix_size = width * width;
+    vector<flatbuffers::Offset<pmx::x86::ShapeMatrix>> fb_shape_matrix;
+    fb_shape_matrix.reserve(param_->alpha.size());
+    for (auto it = param_->alpha.begin(); it != param_->alpha.end(); ++it) {
+        // edge ids are saved as their indices in the model
+        const ppl::nn::pmx::ShapeMatrix& matrix = it->second;
+        auto fb_numerator = private_data.CreateVector(&matrix.numerator[0][0], matrix_size);
+        auto fb_denominator = private_data.CreateVector(&matrix.denominator[0][0], matrix_size);
+        fb_shape_matrix.push_back(pmx::x86::CreateShapeMatrix(private_data, ctx.eid2seq[it->first], fb_numerator,
+                                                              fb_denominator, matrix.real_dim, matrix.scalar));
+    }
+    auto fb_param = pmx::x86::CreateShapeOperationParamDirect(private_data, &fb_shape_matrix);
+    return SerializeParamData(pmx::x86::ParamType_ShapeOperationParam, fb_param.Union(), &private_data, ds);
+}
+
+RetCode ShapeOperationOp::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_param_data = LoadParamData(base, size, pmx::x86::ParamType_ShapeOperationParam);
+    if (!fb_param_data) {
+        return RC_INVALID_VALUE;
+    }
+
+    auto fb_param = fb_param_data->param_as_ShapeOperationParam();
+    auto param = make_shared<ppl::nn::pmx::ShapeOperationParam>();
+    const uint32_t width = ppl::nn::pmx::ShapeMatrix::MAXDIMSIZE + 1;
+    const uint32_t matrix_size = width * width;
+    auto fb_shape_matrix = fb_param->shape_matrix();
+    for (uint32_t i = 0; i < fb_shape_matrix->size(); ++i) {
+        auto fb_matrix = fb_shape_matrix->Get(i);
+        if (fb_matrix->numerator()->size() != matrix_size || fb_matrix->denominator()->size() != matrix_size) {
+            LOG(ERROR) << "size of shape matrix of op[" << GetNode()->GetName() << "] != " << matrix_size << ".";
+            return RC_INVALID_VALUE;
+        }
+
+        ppl::nn::pmx::ShapeMatrix matrix;
+        memcpy(&matrix.numerator[0][0], fb_matrix->numerator()->data(), matrix_size * sizeof(int64_t));
+        memcpy(&matrix.denominator[0][0], fb_matrix->denominator()->data(), matrix_size * sizeof(int64_t));
+        matrix.real_dim = fb_matrix->real_dim();
+        matrix.scalar = fb_matrix->scalar();
+        param->alpha[fb_matrix->edge()] = matrix;
+    }
+    return InitWithParam(param);
+}
+#endif
+
 KernelImpl* ShapeOperationOp::CreateKernelImpl() const {
     auto kernel = op_.CreateKernelImpl();
     ((ppl::nn::pmx::ShapeOperationKernel*)kernel)->SetParam(param_.get());
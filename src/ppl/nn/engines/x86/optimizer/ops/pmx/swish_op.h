@@ -35,6 +35,16 @@ public:
         param_->beta = beta;
     };
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    /** @brief `beta` is set by fusion and not exported yet */
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+#endif
+
 private:
     std::shared_ptr<ppl::nn::pmx::SwishParam> param_;
 };
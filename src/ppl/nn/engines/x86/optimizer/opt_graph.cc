@@ -23,6 +23,9 @@
 #include "ppl/nn/engines/x86/optimizer/opt_rule_manager.h"
 #include "ppl/nn/common/logger.h"
 #include "ppl/nn/engines/utils.h"
+#include "ppl/nn/optimizers/utils.h"
+#include "ppl/nn/engines/engine_context.h"
+#include "ppl/nn/runtime/kernel_exec_context.h"
 
 //#define SHOW_GRAPH_VIS
 #ifdef SHOW_GRAPH_VIS
@@ -34,24 +37,33 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
 
+static RetCode CreateOptKernel(ir::Node* node, unique_ptr<OptKernel>* opt_kernel) {
+    auto& type = node->GetType();
+    auto creator = OptKernelCreatorManager::GetInstance()->Find(type.domain, type.name, type.version);
+    if (!creator) {
+        LOG(ERROR) << "cannot find creator for X86OptKernel[" << node->GetName() << "] of type[" << type.domain
+                   << ":" << type.name << "]";
+        return RC_NOT_FOUND;
+    }
+
+    opt_kernel->reset((*creator)(node));
+    if (!(*opt_kernel)) {
+        LOG(ERROR) << "create X86OptKernel failed: oom";
+        return RC_OUT_OF_MEMORY;
+    }
+
+    return RC_SUCCESS;
+}
+
 RetCode OptGraph::InitKernels(const ir::Graph* graph) {
     auto topo = graph->topo.get();
     for (auto it = topo->CreateNodeIter(); it->IsValid(); it->Forward()) {
         auto node = it->Get();
-        auto& type = node->GetType();
-        auto creator = OptKernelCreatorManager::GetInstance()->Find(type.domain, type.name, type.version);
-        if (!creator) {
-            LOG(ERROR) << "cannot find creator for X86OptKernel[" << node->GetName() << "] of type[" << type.domain
-                       << ":" << type.name << "]";
-            return RC_NOT_FOUND;
-        }
-
-        auto opt_kernel = unique_ptr<X86OptKernel>((*creator)(node));
-        if (!opt_kernel) {
-            LOG(ERROR) << "create X86OptKernel failed: oom";
-            return RC_OUT_OF_MEMORY;
+        unique_ptr<OptKernel> opt_kernel;
+        auto status = CreateOptKernel(node, &opt_kernel);
+        if (status != RC_SUCCESS) {
+            return status;
         }
-
         info_->kernels.emplace(node->GetId(), std::move(opt_kernel));
     }
 
@@ -191,7 +203,253 @@ RetCode OptGraph::TryToInferDims(X86Device* device) {
     return RC_SUCCESS;
 }
 
-RetCode OptGraph::DoOptimize(const utils::SharedResource& resource, const EngineConfig& config, X86Device* device) {
+/** provides the device of the engine to kernels that are executed when graphs are optimized */
+class ConstantFoldingContext final : public EngineContext {
+public:
+    ConstantFoldingContext(X86Device* device) : device_(device) {}
+    const char* GetName() const override {
+        return "x86";
+    }
+    Device* GetDevice() const override {
+        return device_;
+    }
+
+private:
+    X86Device* device_;
+};
+
+static bool IsGraphIOEdge(const ir::GraphTopo* topo, edgeid_t eid) {
+    for (uint32_t i = 0; i < topo->GetInputCount(); ++i) {
+        if (topo->GetInput(i) == eid) {
+            return true;
+        }
+    }
+    for (uint32_t i = 0; i < topo->GetOutputCount(); ++i) {
+        if (topo->GetOutput(i) == eid) {
+            return true;
+        }
+    }
+    for (uint32_t i = 0; i < topo->GetExtraInputCount(); ++i) {
+        if (topo->GetExtraInput(i) == eid) {
+            return true;
+        }
+    }
+    return false;
+}
+
+RetCode OptGraph::FoldConstants(const utils::SharedResource& resource, const EngineConfig& config, X86Device* device,
+                                set<nodeid_t>* consumers) {
+    auto topo = graph_->topo.get();
+    auto& constants = graph_->data->constants;
+    auto& shapes = graph_->data->shapes;
+
+    auto is_foldable_input = [this, &constants](edgeid_t eid) -> bool {
+        if (eid == INVALID_EDGEID) {
+            return true;
+        }
+        if (constants.find(eid) == constants.end()) {
+            return false;
+        }
+        // constants that are loaded on demand have no data here
+        auto tensor = tensor_impls_[eid].get();
+        return (tensor->GetBufferPtr() && tensor->GetShape()->GetDataFormat() == DATAFORMAT_NDARRAY);
+    };
+
+    auto is_foldable_output = [this, topo, &config](edgeid_t eid) -> bool {
+        // outputs of graphs are produced by nodes
+        if (IsGraphIOEdge(topo, eid)) {
+            return false;
+        }
+        auto ref = tensor_impls_.find(eid);
+        if (ref == tensor_impls_.end() || ref->second->GetType() != TENSORTYPE_NORMAL) {
+            return false;
+        }
+        // skips outputs that are known to be too large before evaluating them
+        auto shape = ref->second->GetShape();
+        return (shape->GetDimCount() == 0 || shape->CalcBytesIncludingPadding() <= config.max_folded_constant_bytes);
+    };
+
+    vector<nodeid_t> sorted_nodes;
+    topo->TopologicalSort([&sorted_nodes](nodeid_t nid) -> void {
+        sorted_nodes.push_back(nid);
+    });
+
+    // no input is reused as output buffer
+    const vector<nodeid_t> edge_last_consumer(topo->GetCurrentEdgeIdBound(), INVALID_NODEID);
+    ConstantFoldingContext folding_ctx(device);
+
+    uint32_t folded_count = 0;
+    uint64_t folded_bytes = 0;
+    for (auto nid : sorted_nodes) {
+        auto node = topo->GetNode(nid);
+        if (node->GetInputCount() == 0 || node->GetExtraInputCount() > 0 ||
+            utils::IsRandomOrSubgraphOp(node->GetType())) {
+            continue;
+        }
+
+        bool is_foldable = true;
+        for (uint32_t i = 0; i < node->GetInputCount() && is_foldable; ++i) {
+            is_foldable = is_foldable_input(node->GetInput(i));
+        }
+        for (uint32_t i = 0; i < node->GetOutputCount() && is_foldable; ++i) {
+            is_foldable = is_foldable_output(node->GetOutput(i));
+        }
+        if (!is_foldable) {
+            continue;
+        }
+
+        auto opt_kernel = info_->kernels[nid].get();
+        auto kernel = unique_ptr<KernelImpl>(opt_kernel->CreateKernelImpl());
+        if (!kernel) {
+            LOG(ERROR) << "create kernel[" << node->GetName() << "] failed: oom";
+            return RC_OUT_OF_MEMORY;
+        }
+        kernel->SetEngineContext(&folding_ctx);
+
+        KernelExecContext exec_ctx;
+        exec_ctx.SetNode(node);
+        exec_ctx.SetAcquireFunc(acquire_tensor_func_);
+        exec_ctx.SetEdgeLastConsumerList(&edge_last_consumer);
+
+        auto status = kernel->Execute(&exec_ctx);
+        if (status != RC_SUCCESS) {
+            LOG(DEBUG) << "evaluating constant node[" << node->GetName() << "] failed: " << GetRetCodeStr(status)
+                       << ". it is kept.";
+            for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+                tensor_impls_[node->GetOutput(i)]->FreeBuffer();
+            }
+            continue;
+        }
+
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            auto shape = tensor_impls_[node->GetOutput(i)]->GetShape();
+            auto bytes = shape->CalcBytesExcludingPadding();
+            if (shape->GetDataFormat() != DATAFORMAT_NDARRAY || bytes == 0 ||
+                bytes > config.max_folded_constant_bytes) {
+                is_foldable = false;
+                break;
+            }
+        }
+        if (!is_foldable) {
+            for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+                tensor_impls_[node->GetOutput(i)]->FreeBuffer();
+            }
+            continue;
+        }
+
+        // outputs become constants. tensors are replaced because constants are reserved tensors.
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            auto eid = node->GetOutput(i);
+            auto edge = topo->GetEdge(eid);
+            auto src = tensor_impls_[eid].get();
+            auto src_shape = src->GetShape();
+            const uint64_t bytes = src_shape->CalcBytesExcludingPadding();
+
+            ir::Constant constant;
+            status = constant.data.Init(bytes);
+            if (status != RC_SUCCESS) {
+                LOG(ERROR) << "allocate " << bytes << " bytes for constant[" << edge->GetName()
+                           << "] failed: " << GetRetCodeStr(status);
+                return status;
+            }
+            memcpy(constant.data.GetData(), src->GetBufferPtr<void>(), bytes);
+
+            ir::Shape ir_shape;
+            ir_shape.data_type = src_shape->GetDataType();
+            ir_shape.data_format = src_shape->GetDataFormat();
+            ir_shape.dims.assign(src_shape->GetDims(), src_shape->GetDims() + src_shape->GetDimCount());
+
+            auto dst = new TensorImpl(edge, TENSORTYPE_RESERVED);
+            *dst->GetShape() = *src_shape;
+            dst->SetDevice(device);
+            status = dst->ReallocBuffer();
+            if (status != RC_SUCCESS) {
+                delete dst;
+                LOG(ERROR) << "ReallocBuffer for tensor[" << edge->GetName() << "] failed: " << GetRetCodeStr(status);
+                return status;
+            }
+            memcpy(dst->GetBufferPtr<void>(), constant.data.GetData(), bytes);
+            tensor_impls_[eid].reset(dst);
+
+            constants[eid] = std::move(constant);
+            shapes[eid] = ir_shape;
+            topo->MarkAsConstant(eid);
+            edge->SetProducer(INVALID_NODEID);
+            folded_bytes += bytes;
+
+            for (auto it = edge->CreateConsumerIter(); it.IsValid(); it.Forward()) {
+                consumers->insert(it.Get());
+            }
+        }
+
+        // constants that are used only by this node are removed
+        set<edgeid_t> input_eids;
+        for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+            if (node->GetInput(i) != INVALID_EDGEID) {
+                input_eids.insert(node->GetInput(i));
+            }
+        }
+        for (auto eid : input_eids) {
+            auto edge = topo->GetEdge(eid);
+            edge->DelConsumer(nid);
+            if (edge->CalcConsumerCount() == 0 &&
+                resource.reserved_edgeids.find(eid) == resource.reserved_edgeids.end() && !IsGraphIOEdge(topo, eid)) {
+                constants.erase(eid);
+                shapes.erase(eid);
+                tensor_impls_.erase(eid);
+                topo->DelEdge(eid);
+            }
+        }
+
+        LOG(DEBUG) << "node[" << node->GetName() << "] is folded into constants.";
+        kernel.reset();
+        info_->kernels.erase(nid);
+        topo->DelNode(nid);
+        consumers->erase(nid);
+        ++folded_count;
+    }
+
+    if (folded_count > 0) {
+        LOG(INFO) << "[" << folded_count << "] nodes of graph[" << topo->GetName() << "] are folded into ["
+                  << folded_bytes << "] bytes of constants.";
+    }
+
+    return RC_SUCCESS;
+}
+
+/*
+  kernels may use constant inputs in Init(), e.g. MatMul and Gemm pack matrix-B, so consumers of folded constants are
+  initialized again. new kernels are created because Init() may allocate resources that are not released if it is
+  called twice.
+*/
+RetCode OptGraph::ReinitKernels(const set<nodeid_t>& nids, const OptKernelOptions& options) {
+    auto topo = graph_->topo.get();
+    for (auto nid : nids) {
+        auto node = topo->GetNode(nid);
+        if (!node) {
+            continue;
+        }
+
+        unique_ptr<OptKernel> opt_kernel;
+        auto status = CreateOptKernel(node, &opt_kernel);
+        if (status != RC_SUCCESS) {
+            return status;
+        }
+
+        status = static_cast<X86OptKernel*>(opt_kernel.get())->Init(options);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "Init for kernel[" << node->GetName() << "] failed: " << GetRetCodeStr(status);
+            return status;
+        }
+
+        info_->kernels[nid] = std::move(opt_kernel);
+    }
+
+    return RC_SUCCESS;
+}
+
+RetCode OptGraph::DoOptimize(const utils::SharedResource& resource, const EngineConfig& config, X86Device* device,
+                             map<string, uint32_t>* algo_selects, const set<edgeid_t>* lazy_constants) {
     OptKernelOptions options;
     options.resource = &resource;
     options.config = &config;
@@ -200,6 +458,7 @@ RetCode OptGraph::DoOptimize(const utils::SharedResource& resource, const Engine
     options.tensors = &tensor_impls_;
     options.device = device;
     options.info = info_;
+    options.algo_selects = algo_selects;
 
     for (auto it = info_->kernels.begin(); it != info_->kernels.end(); ++it) {
         auto kernel = (X86OptKernel*)(it->second.get());
@@ -214,6 +473,10 @@ RetCode OptGraph::DoOptimize(const utils::SharedResource& resource, const Engine
         auto edge_id = it->first;
         if (graph_->data->constants.find(edge_id) != graph_->data->constants.end()) {
             auto tensor = it->second.get();
+            // constants loaded on demand are not read when inferring shapes
+            if (lazy_constants && lazy_constants->find(edge_id) != lazy_constants->end()) {
+                continue;
+            }
             tensor->SetDevice(device);
             tensor->ReallocBuffer();
             memcpy(tensor->GetBufferPtr<void>(), graph_->data->constants[edge_id].data.GetData(),
@@ -235,6 +498,30 @@ RetCode OptGraph::DoOptimize(const utils::SharedResource& resource, const Engine
         return status;
     }
 
+    if (config.max_folded_constant_bytes > 0) {
+        set<nodeid_t> consumers;
+        status = FoldConstants(resource, config, device, &consumers);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "FoldConstants failed: " << GetRetCodeStr(status);
+            return status;
+        }
+
+        if (!consumers.empty()) {
+            status = ReinitKernels(consumers, options);
+            if (status != RC_SUCCESS) {
+                LOG(ERROR) << "ReinitKernels failed: " << GetRetCodeStr(status);
+                return status;
+            }
+
+            // dims that depend on data of folded constants can be inferred now, e.g. outputs of Reshape
+            status = TryToInferDims(device);
+            if (status != RC_SUCCESS) {
+                LOG(ERROR) << "TryToInferDims failed: " << GetRetCodeStr(status);
+                return status;
+            }
+        }
+    }
+
     auto opt_rule_manager = OptRuleManager::Instance();
 
     if (config.enable_graph_fusion) {
@@ -19,6 +19,7 @@
 #define _ST_HPC_PPL_NN_ENGINES_X86_OPTIMIZER_OPT_GRAPH_H_
 
 #include <memory>
+#include <set>
 
 #include "ppl/nn/ir/graph.h"
 #include "ppl/nn/engines/x86/x86_device.h"
@@ -31,13 +32,20 @@ namespace ppl { namespace nn { namespace x86 {
 class OptGraph final {
 public:
     ppl::common::RetCode Init(const utils::SharedResource&, ir::Graph*, RuntimePartitionInfo*);
-    ppl::common::RetCode DoOptimize(const utils::SharedResource&, const EngineConfig&, X86Device*);
+    /** @param lazy_constants constants that are loaded on demand. their data are not copied to tensors. */
+    ppl::common::RetCode DoOptimize(const utils::SharedResource&, const EngineConfig&, X86Device*,
+                                    std::map<std::string, uint32_t>* algo_selects = nullptr,
+                                    const std::set<edgeid_t>* lazy_constants = nullptr);
 
 private:
     ppl::common::RetCode InitKernels(const ir::Graph* graph);
     ppl::common::RetCode InitTensorImpls(const utils::SharedResource&);
     ppl::common::RetCode TryToInferType(X86Device* device);
     ppl::common::RetCode TryToInferDims(X86Device* device);
+    /** @param consumers consumers of folded constants, which are not folded themselves */
+    ppl::common::RetCode FoldConstants(const utils::SharedResource&, const EngineConfig&, X86Device*,
+                                       std::set<nodeid_t>* consumers);
+    ppl::common::RetCode ReinitKernels(const std::set<nodeid_t>&, const OptKernelOptions&);
 
 private:
     ir::Graph* graph_ = nullptr;
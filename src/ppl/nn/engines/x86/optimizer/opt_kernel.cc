@@ -18,6 +18,7 @@
 #include "ppl/nn/engines/x86/optimizer/opt_kernel.h"
 #include "ppl/common/sys.h"
 #include "ppl/common/log.h"
+#include <string.h>
 using namespace std;
 using namespace ppl::common;
 
@@ -34,7 +35,229 @@ ppl::common::RetCode X86OptKernel::Init(const OptKernelOptions& options) {
     }
 
     engine_config_ = options.config;
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    has_param_ = (options.graph_data->attrs.find(GetNode()->GetId()) != options.graph_data->attrs.end());
+#endif
     return DoInit(options);
 }
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+RetCode X86OptKernel::WriteOpParam(pmx::onnx::OpParamType type, flatbuffers::Offset<void> fb_param,
+                                   const flatbuffers::FlatBufferBuilder& private_data,
+                                   flatbuffers::FlatBufferBuilder* builder, utils::DataStream* ds) {
+    auto fb_data = builder->CreateVector(private_data.GetBufferPointer(), private_data.GetSize());
+    auto fb_root = pmx::onnx::CreateOpParam(*builder, type, fb_param, fb_data);
+    pmx::onnx::FinishOpParamBuffer(*builder, fb_root);
+    return ds->Write(builder->GetBufferPointer(), builder->GetSize());
+}
+
+RetCode X86OptKernel::SerializeOutputData(pmx::onnx::OpParamType type, flatbuffers::Offset<void> fb_param,
+                                          flatbuffers::FlatBufferBuilder* builder, utils::DataStream* ds) const {
+    flatbuffers::FlatBufferBuilder private_data;
+    auto fb_output_data = pmx::x86::CreateOutputDataDirect(private_data, &common_param_.output_formats);
+    auto fb_op_data = pmx::x86::CreateOpData(private_data, pmx::x86::PrivateDataType_OutputData,
+                                             fb_output_data.Union());
+    pmx::x86::FinishOpDataBuffer(private_data, fb_op_data);
+    return WriteOpParam(type, fb_param, private_data, builder, ds);
+}
+
+const pmx::onnx::OpParam* X86OptKernel::LoadOpParam(const void* base, uint64_t size,
+                                                     pmx::onnx::OpParamType type) const {
+    auto node = GetNode();
+    if (size == 0) {
+        LOG(ERROR) << "data of op[" << node->GetName() << "] is empty. op[" << node->GetType().name
+                   << "] may not support being exported.";
+        return nullptr;
+    }
+
+    flatbuffers::Verifier verifier((const uint8_t*)base, size);
+    if (!pmx::onnx::VerifyOpParamBuffer(verifier)) {
+        LOG(ERROR) << "verify op param of op[" << node->GetName() << "] failed.";
+        return nullptr;
+    }
+
+    auto fb_op_param = pmx::onnx::GetOpParam(base);
+    if (fb_op_param->value_type() != type || (type != pmx::onnx::OpParamType_NONE && !fb_op_param->value())) {
+        LOG(ERROR) << "param type of op[" << node->GetName() << "] is ["
+                   << pmx::onnx::EnumNameOpParamType(fb_op_param->value_type()) << "], expected ["
+                   << pmx::onnx::EnumNameOpParamType(type) << "].";
+        return nullptr;
+    }
+
+    auto fb_data = fb_op_param->data_();
+    if (!fb_data) {
+        LOG(ERROR) << "private data of op[" << node->GetName() << "] not found.";
+        return nullptr;
+    }
+
+    flatbuffers::Verifier data_verifier(fb_data->data(), fb_data->size());
+    if (!pmx::x86::VerifyOpDataBuffer(data_verifier)) {
+        LOG(ERROR) << "verify private data of op[" << node->GetName() << "] failed.";
+        return nullptr;
+    }
+
+    return fb_op_param;
+}
+
+RetCode X86OptKernel::SerializeData(const pmx::SerializationContext&, utils::DataStream* ds) const {
+    if (has_param_) {
+        return RC_UNSUPPORTED;
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+    return SerializeOutputData(pmx::onnx::OpParamType_NONE, 0, &builder, ds);
+}
+
+RetCode X86OptKernel::DeserializeData(const pmx::DeserializationContext&, const void* base, uint64_t size) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NONE);
+    if (!fb_op_param) {
+        return RC_INVALID_VALUE;
+    }
+
+    // kernels without params only set their infer functions in DoInit()
+    auto status = InitWithParam(nullptr);
+    if (status != RC_SUCCESS) {
+        return status;
+    }
+
+    return DeserializeOutputData(*fb_op_param);
+}
+
+RetCode X86OptKernel::InitWithParam(const shared_ptr<ir::Attr>& param) {
+    ir::GraphData graph_data;
+    if (param) {
+        graph_data.attrs.insert(make_pair(GetNode()->GetId(), param));
+    }
+
+    OptKernelOptions options;
+    options.config = engine_config_;
+    options.graph_data = &graph_data;
+    has_param_ = (param != nullptr);
+    auto status = DoInit(options);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "init op[" << GetNode()->GetName() << "] failed: " << GetRetCodeStr(status);
+    }
+    return status;
+}
+
+RetCode X86OptKernel::SerializeParamData(pmx::x86::ParamType type, flatbuffers::Offset<void> fb_param,
+                                         flatbuffers::FlatBufferBuilder* private_data, utils::DataStream* ds,
+                                         flatbuffers::Offset<pmx::x86::RNNData> fb_rnn_data) const {
+    auto fb_dformat = private_data->CreateVector(common_param_.output_formats);
+    auto fb_param_data = pmx::x86::CreateParamData(*private_data, type, fb_param, fb_dformat, fb_rnn_data);
+    auto fb_op_data = pmx::x86::CreateOpData(*private_data, pmx::x86::PrivateDataType_ParamData,
+                                             fb_param_data.Union());
+    pmx::x86::FinishOpDataBuffer(*private_data, fb_op_data);
+
+    flatbuffers::FlatBufferBuilder builder;
+    return WriteOpParam(pmx::onnx::OpParamType_NONE, 0, *private_data, &builder, ds);
+}
+
+const pmx::x86::ParamData* X86OptKernel::LoadParamData(const void* base, uint64_t size, pmx::x86::ParamType type) {
+    auto fb_op_param = LoadOpParam(base, size, pmx::onnx::OpParamType_NONE);
+    if (!fb_op_param) {
+        return nullptr;
+    }
+
+    auto node = GetNode();
+    auto fb_param_data = pmx::x86::GetOpData(fb_op_param->data_()->data())->value_as_ParamData();
+    if (!fb_param_data) {
+        LOG(ERROR) << "param data of op[" << node->GetName() << "] not found.";
+        return nullptr;
+    }
+    if (fb_param_data->param_type() != type || !fb_param_data->param()) {
+        LOG(ERROR) << "param type of op[" << node->GetName() << "] is ["
+                   << pmx::x86::EnumNameParamType(fb_param_data->param_type()) << "], expected ["
+                   << pmx::x86::EnumNameParamType(type) << "].";
+        return nullptr;
+    }
+
+    pmx::utils::Fbvec2Stdvec(fb_param_data->dformat(), &common_param_.output_formats);
+    return fb_param_data;
+}
+
+flatbuffers::Offset<pmx::x86::RNNData>
+X86OptKernel::CreateRNNData(isa_t isa, const vector<pair<const float*, uint64_t>>& packed,
+                            flatbuffers::FlatBufferBuilder* private_data) const {
+    vector<uint64_t> packed_bytes(packed.size(), 0);
+    vector<uint8_t> packed_data;
+    for (uint32_t i = 0; i < packed.size(); ++i) {
+        if (packed[i].first) {
+            auto data = (const uint8_t*)packed[i].first;
+            packed_bytes[i] = packed[i].second;
+            packed_data.insert(packed_data.end(), data, data + packed[i].second);
+        }
+    }
+
+    auto fb_packed_bytes = private_data->CreateVector(packed_bytes);
+    auto fb_packed = private_data->CreateVector(packed_data);
+    auto fb_dformat = private_data->CreateVector(common_param_.output_formats);
+    return pmx::x86::CreateRNNData(*private_data, isa, fb_packed_bytes, fb_packed, fb_dformat);
+}
+
+RetCode X86OptKernel::LoadRNNData(const pmx::x86::RNNData& fb_rnn_data, isa_t isa,
+                                  const vector<pair<float**, uint64_t*>>& packed) const {
+    auto node = GetNode();
+    auto fb_packed_bytes = fb_rnn_data.packed_bytes();
+    if (!fb_packed_bytes || fb_packed_bytes->size() != packed.size()) {
+        LOG(ERROR) << "number of packed matrices of op[" << node->GetName() << "] != " << packed.size() << ".";
+        return RC_INVALID_VALUE;
+    }
+
+    const uint64_t data_size = (fb_rnn_data.packed() ? fb_rnn_data.packed()->size() : 0);
+    uint64_t offset = 0;
+    for (uint32_t i = 0; i < fb_packed_bytes->size(); ++i) {
+        const uint64_t bytes = fb_packed_bytes->Get(i);
+        if (bytes > data_size - offset) {
+            LOG(ERROR) << "size of packed matrices of op[" << node->GetName() << "] exceeds the saved data size["
+                       << data_size << "].";
+            return RC_INVALID_VALUE;
+        }
+        offset += bytes;
+    }
+    if (offset != data_size) {
+        LOG(ERROR) << "size of packed matrices of op[" << node->GetName() << "] is [" << offset
+                   << "], which differs from the saved data size[" << data_size << "].";
+        return RC_INVALID_VALUE;
+    }
+    if (data_size > 0 && fb_rnn_data.isa() != isa) {
+        LOG(ERROR) << "matrices of op[" << node->GetName() << "] are packed for isa[" << fb_rnn_data.isa()
+                   << "], which differs from current device isa[" << isa << "]";
+        return RC_UNSUPPORTED;
+    }
+
+    offset = 0;
+    for (uint32_t i = 0; i < packed.size(); ++i) {
+        const uint64_t bytes = fb_packed_bytes->Get(i);
+        if (bytes == 0) {
+            continue;
+        }
+
+        auto data = (float*)ppl::common::AlignedAlloc(bytes, 64);
+        if (!data) {
+            LOG(ERROR) << "allocate packed matrix of op[" << node->GetName() << "] failed.";
+            return RC_OUT_OF_MEMORY;
+        }
+        memcpy(data, fb_rnn_data.packed()->data() + offset, bytes);
+        *packed[i].first = data;
+        *packed[i].second = bytes;
+        offset += bytes;
+    }
+
+    return RC_SUCCESS;
+}
+
+RetCode X86OptKernel::DeserializeOutputData(const pmx::onnx::OpParam& fb_op_param) {
+    auto fb_op_data = pmx::x86::GetOpData(fb_op_param.data_()->data());
+    auto fb_output_data = fb_op_data->value_as_OutputData();
+    if (!fb_output_data) {
+        LOG(ERROR) << "output data of op[" << GetNode()->GetName() << "] not found.";
+        return RC_INVALID_VALUE;
+    }
+
+    pmx::utils::Fbvec2Stdvec(fb_output_data->dformat(), &common_param_.output_formats);
+    return RC_SUCCESS;
+}
+#endif
+
 }}} // namespace ppl::nn::x86
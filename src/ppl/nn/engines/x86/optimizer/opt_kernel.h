@@ -26,6 +26,12 @@
 #include "ppl/nn/engines/x86/engine_config.h"
 #include <functional>
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+#include "ppl/nn/models/pmx/generated/onnx_op_generated.h"
+#include "ppl/nn/models/pmx/utils.h"
+#include "ppl/nn/engines/x86/pmx/generated/x86_op_params_generated.h"
+#endif
+
 namespace ppl { namespace nn { namespace utils {
 struct SharedResource;
 }}} // namespace ppl::nn::utils
@@ -40,6 +46,8 @@ struct OptKernelOptions final {
     X86Device* device = nullptr;
     RuntimePartitionInfo* info = nullptr;
     std::map<edgeid_t, std::unique_ptr<TensorImpl>>* tensors = nullptr;
+    /** key of a kernel's param and shapes => selected algorithm, shared by all graphs of an engine */
+    std::map<std::string, uint32_t>* algo_selects = nullptr;
 };
 
 class X86OptKernel : public OptKernel {
@@ -80,18 +88,81 @@ public:
         return ppl::common::RC_SUCCESS;
     }
 
-#ifdef PPLNN_ENABLE_PMX_MODEL
-    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override {
-        return ppl::common::RC_UNSUPPORTED;
+    /** @brief input `idx` is a constant that is loaded from `entry` before execution */
+    void SetLazyConstant(uint32_t idx, const std::shared_ptr<ConstantCache::Entry>& entry) {
+        if (common_param_.lazy_constants.size() <= idx) {
+            common_param_.lazy_constants.resize(idx + 1);
+        }
+        common_param_.lazy_constants[idx] = entry;
     }
-    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override {
-        return ppl::common::RC_UNSUPPORTED;
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    /**
+       @brief saves output formats of kernels without params. kernels with params or other private data must
+       override it, otherwise RC_UNSUPPORTED is returned.
+    */
+    ppl::common::RetCode SerializeData(const pmx::SerializationContext&, utils::DataStream*) const override;
+    /** @brief loads data saved by the default `SerializeData()` and calls `DoInit()` with empty graph data */
+    ppl::common::RetCode DeserializeData(const pmx::DeserializationContext&, const void*, uint64_t) override;
+
+    /** @brief kernels created from pmx models are not initialized by `Init()`. */
+    void SetEngineConfig(const EngineConfig* config) {
+        engine_config_ = config;
     }
+    virtual void SetDevice(const X86Device*) {}
 #endif
 
 protected:
     virtual ppl::common::RetCode DoInit(const OptKernelOptions&) = 0;
 
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    /**
+       @brief writes an `OpParam` which contains `fb_param` of `type` and `private_data` of this kernel.
+       `fb_param` must be created by `builder`.
+    */
+    static ppl::common::RetCode WriteOpParam(pmx::onnx::OpParamType type, flatbuffers::Offset<void> fb_param,
+                                             const flatbuffers::FlatBufferBuilder& private_data,
+                                             flatbuffers::FlatBufferBuilder* builder, utils::DataStream* ds);
+
+    /**
+       @brief returns the `OpParam` in [base, base + size), or nullptr if it or the private data in it is invalid,
+       or its param is not of `type`.
+    */
+    const pmx::onnx::OpParam* LoadOpParam(const void* base, uint64_t size, pmx::onnx::OpParamType type) const;
+
+    /** @brief for kernels whose private data are output formats only */
+    ppl::common::RetCode SerializeOutputData(pmx::onnx::OpParamType type, flatbuffers::Offset<void> fb_param,
+                                             flatbuffers::FlatBufferBuilder* builder, utils::DataStream* ds) const;
+    ppl::common::RetCode DeserializeOutputData(const pmx::onnx::OpParam&);
+
+    /**
+       @brief for kernels whose params are not defined in onnx_op.fbs. `fb_param` of `type` and `fb_rnn_data` must be
+       created by `private_data`.
+    */
+    ppl::common::RetCode SerializeParamData(pmx::x86::ParamType type, flatbuffers::Offset<void> fb_param,
+                                            flatbuffers::FlatBufferBuilder* private_data, utils::DataStream* ds,
+                                            flatbuffers::Offset<pmx::x86::RNNData> fb_rnn_data = 0) const;
+    /** @brief returns the `ParamData` saved by `SerializeParamData()` and loads output formats from it */
+    const pmx::x86::ParamData* LoadParamData(const void* base, uint64_t size, pmx::x86::ParamType type);
+
+    /**
+       @brief creates `RNNData` of matrices packed for `isa`. `packed[i]` is the address and size of the i-th matrix.
+       the address is null if the matrix is not packed.
+    */
+    flatbuffers::Offset<pmx::x86::RNNData>
+    CreateRNNData(ppl::common::isa_t isa, const std::vector<std::pair<const float*, uint64_t>>& packed,
+                  flatbuffers::FlatBufferBuilder* private_data) const;
+    /**
+       @brief allocates and copies the i-th matrix in `fb_rnn_data` to `*packed[i].first`, whose size is written to
+       `*packed[i].second`. matrices which are not packed are skipped. `isa` is the isa of the current device.
+    */
+    ppl::common::RetCode LoadRNNData(const pmx::x86::RNNData& fb_rnn_data, ppl::common::isa_t isa,
+                                     const std::vector<std::pair<float**, uint64_t*>>& packed) const;
+
+    /** @brief calls `DoInit()` with `param` as the only data of the graph. `param` can be null. */
+    ppl::common::RetCode InitWithParam(const std::shared_ptr<ir::Attr>& param);
+#endif
+
     template <typename T>
     ppl::common::RetCode GenericLoadParam(const OptKernelOptions& options, std::shared_ptr<T>* param) const {
         auto node = GetNode();
@@ -163,6 +234,9 @@ protected:
     std::function<ppl::common::RetCode(InputOutputInfo*)> infer_dims_func_;
     X86CommonParam common_param_;
     const EngineConfig* engine_config_;
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    bool has_param_ = false; // whether the node has params in graph data
+#endif
 };
 
 }}} // namespace ppl::nn::x86
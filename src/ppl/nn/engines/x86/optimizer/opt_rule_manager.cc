@@ -22,10 +22,13 @@
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_conv_eltwise.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_conv_depthwise.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_gemm_activation.h"
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_matmul_bias_activation.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_arithmetic_relu.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_batch_normalization_relu.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_channel_shuffle.h"
 #include "ppl/nn/engines/x86/optimizer/rules/fuse_swish.h"
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_layer_norm.h"
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_gelu.h"
 #include "ppl/nn/engines/x86/optimizer/rules/layout_optimize.h"
 
 namespace ppl { namespace nn { namespace x86 {
@@ -96,7 +99,10 @@ OptRuleManager::OptRuleManager() {
     REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseArithmeticReLU", FuseArithmeticReLU);
     REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseBatchNormalizationReLU", FuseBatchNormalizationReLU);
     REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseGemmActivation", FuseGemmActivation);
+    REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseMatMulBiasActivation", FuseMatMulBiasActivation);
     REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseSwish", FuseSwish);
+    REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseLayerNorm", FuseLayerNorm);
+    REGISTER_OPT_RULE("FusionBeforeLayoutOptimize", "FuseGELU", FuseGELU);
 
     REGISTER_OPT_RULE("FusionAfterLayoutOptimize", "FuseConvDepthwise", FuseConvDepthwise);
 }
@@ -21,40 +21,6 @@
 
 namespace ppl { namespace nn { namespace x86 {
 
-static bool IsReLU6(const ir::GraphData* graph_data, const ir::Node* clip_node) {
-    if (clip_node->GetType().domain != "" || clip_node->GetType().name != "Clip") {
-        return false;
-    }
-
-    auto min_edge_id = clip_node->GetInput(1);
-    auto max_edge_id = clip_node->GetInput(2);
-    auto& constants = graph_data->constants;
-    auto min_edge_constant = constants.find(min_edge_id);
-    auto max_edge_constant = constants.find(max_edge_id);
-    if (min_edge_constant == constants.end() || max_edge_constant == constants.end()) {
-        return false;
-    }
-
-    auto& shapes = graph_data->shapes;
-    auto min_edge_shape = shapes.find(min_edge_id);
-    auto max_edge_shape = shapes.find(max_edge_id);
-    if (min_edge_shape == shapes.end() || max_edge_shape == shapes.end()) {
-        return false;
-    }
-    if (min_edge_shape->second.data_type != ppl::common::DATATYPE_FLOAT32 ||
-        max_edge_shape->second.data_type != ppl::common::DATATYPE_FLOAT32) {
-        return false;
-    }
-
-    float min_val = *((float*)min_edge_constant->second.data.GetData());
-    float max_val = *((float*)max_edge_constant->second.data.GetData());
-    if (min_val == 0.0f && max_val == 6.0f) {
-        return true;
-    }
-
-    return false;
-}
-
 bool FuseConvActivation(const OptKernelOptions& options) {
     bool graphchanged = false;
     auto graph_topo = options.graph_topo;
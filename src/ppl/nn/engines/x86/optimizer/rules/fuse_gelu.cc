@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_gelu.h"
+#include "ppl/nn/engines/x86/optimizer/rules/utils.h"
+#include "ppl/nn/params/pmx/gelu_param.h"
+#include <cmath>
+
+namespace ppl { namespace nn { namespace x86 {
+
+static bool IsScalarConstant(const ir::GraphData* graph_data, edgeid_t edge_id, float expected) {
+    float value = 0.0f;
+    return (edge_id != INVALID_EDGEID && GetScalarConstant(graph_data, edge_id, &value) &&
+            fabsf(value - expected) <= 1e-4f);
+}
+
+// returns the producer of `edge_id` if it is an onnx op named `type_name` and `edge_id` is used by it only
+static ir::Node* GetSingleUseProducer(const OptKernelOptions& options, edgeid_t edge_id, const char* type_name) {
+    auto graph_topo = options.graph_topo;
+    auto edge = graph_topo->GetEdge(edge_id);
+    if (edge->CalcConsumerCount() != 1 || IsReservedEdge(*options.tensors, edge_id)) {
+        return nullptr;
+    }
+
+    auto producer = graph_topo->GetNode(edge->GetProducer());
+    if (!producer || producer->GetType().domain != "" || producer->GetType().name != type_name ||
+        HasFusedReLU(options, producer)) {
+        return nullptr;
+    }
+    return producer;
+}
+
+// x / sqrt(2) or x * (1 / sqrt(2)). returns x.
+static edgeid_t MatchErfInput(const OptKernelOptions& options, const ir::Node* erf_node,
+                              std::vector<ir::Node*>* nodes) {
+    auto graph_data = options.graph_data;
+    auto erf_input_edge_id = erf_node->GetInput(0);
+
+    auto div_node = GetSingleUseProducer(options, erf_input_edge_id, "Div");
+    if (div_node && IsScalarConstant(graph_data, div_node->GetInput(1), 1.4142135f)) {
+        nodes->push_back(div_node);
+        return div_node->GetInput(0);
+    }
+
+    auto mul_node = GetSingleUseProducer(options, erf_input_edge_id, "Mul");
+    if (mul_node) {
+        for (uint32_t i = 0; i < 2; ++i) {
+            auto x_edge_id = mul_node->GetInput(i);
+            if (IsScalarConstant(graph_data, GetOtherInput(mul_node, x_edge_id), 0.7071068f)) {
+                nodes->push_back(mul_node);
+                return x_edge_id;
+            }
+        }
+    }
+
+    return INVALID_EDGEID;
+}
+
+// sqrt(2 / pi) * (x + 0.044715 * x^3). returns x.
+static edgeid_t MatchTanhInput(const OptKernelOptions& options, const ir::Node* tanh_node,
+                               std::vector<ir::Node*>* nodes) {
+    auto graph_data = options.graph_data;
+
+    auto scale_node = GetSingleUseProducer(options, tanh_node->GetInput(0), "Mul");
+    if (!scale_node) {
+        return INVALID_EDGEID;
+    }
+    edgeid_t sum_edge_id = INVALID_EDGEID;
+    for (uint32_t i = 0; i < 2; ++i) {
+        if (IsScalarConstant(graph_data, GetOtherInput(scale_node, scale_node->GetInput(i)), 0.7978845608f)) {
+            sum_edge_id = scale_node->GetInput(i);
+        }
+    }
+    if (sum_edge_id == INVALID_EDGEID) {
+        return INVALID_EDGEID;
+    }
+
+    auto sum_node = GetSingleUseProducer(options, sum_edge_id, "Add");
+    if (!sum_node) {
+        return INVALID_EDGEID;
+    }
+    for (uint32_t i = 0; i < 2; ++i) {
+        auto x_edge_id = sum_node->GetInput(i);
+        auto cube_mul_edge_id = GetOtherInput(sum_node, x_edge_id);
+        if (cube_mul_edge_id == INVALID_EDGEID) {
+            continue;
+        }
+
+        auto cube_mul_node = GetSingleUseProducer(options, cube_mul_edge_id, "Mul");
+        if (!cube_mul_node) {
+            continue;
+        }
+        for (uint32_t j = 0; j < 2; ++j) {
+            auto cube_edge_id = cube_mul_node->GetInput(j);
+            if (!IsScalarConstant(graph_data, GetOtherInput(cube_mul_node, cube_edge_id), 0.044715f)) {
+                continue;
+            }
+            auto pow_node = GetSingleUseProducer(options, cube_edge_id, "Pow");
+            if (pow_node && pow_node->GetInput(0) == x_edge_id &&
+                IsScalarConstant(graph_data, pow_node->GetInput(1), 3.0f)) {
+                nodes->insert(nodes->end(), {pow_node, cube_mul_node, sum_node, scale_node});
+                return x_edge_id;
+            }
+        }
+    }
+
+    return INVALID_EDGEID;
+}
+
+// 0.5 * x * (1 + activation), in which multiplications may be in any order. returns output of the last node.
+static edgeid_t MatchGELUOutput(const OptKernelOptions& options, edgeid_t x_edge_id, const ir::Node* act_node,
+                                std::vector<ir::Node*>* nodes) {
+    auto graph_data = options.graph_data;
+
+    auto one_add_node = GetSingleConsumer(options, act_node->GetOutput(0), "Add");
+    if (!one_add_node || HasFusedReLU(options, one_add_node) ||
+        !IsScalarConstant(graph_data, GetOtherInput(one_add_node, act_node->GetOutput(0)), 1.0f)) {
+        return INVALID_EDGEID;
+    }
+
+    auto add_output_edge_id = one_add_node->GetOutput(0);
+    auto mul1_node = GetSingleConsumer(options, add_output_edge_id, "Mul");
+    if (!mul1_node || HasFusedReLU(options, mul1_node)) {
+        return INVALID_EDGEID;
+    }
+    auto mul1_other_edge_id = GetOtherInput(mul1_node, add_output_edge_id);
+    if (mul1_other_edge_id == INVALID_EDGEID) {
+        return INVALID_EDGEID;
+    }
+
+    if (mul1_other_edge_id == x_edge_id || IsScalarConstant(graph_data, mul1_other_edge_id, 0.5f)) {
+        // ((1 + activation) * x) * 0.5 or ((1 + activation) * 0.5) * x
+        auto mul2_node = GetSingleConsumer(options, mul1_node->GetOutput(0), "Mul");
+        if (!mul2_node || HasFusedReLU(options, mul2_node)) {
+            return INVALID_EDGEID;
+        }
+        auto mul2_other_edge_id = GetOtherInput(mul2_node, mul1_node->GetOutput(0));
+        if (mul1_other_edge_id == x_edge_id ? !IsScalarConstant(graph_data, mul2_other_edge_id, 0.5f)
+                                            : mul2_other_edge_id != x_edge_id) {
+            return INVALID_EDGEID;
+        }
+        nodes->insert(nodes->end(), {one_add_node, mul1_node, mul2_node});
+        return mul2_node->GetOutput(0);
+    }
+
+    // (x * 0.5) * (1 + activation)
+    auto half_node = GetSingleUseProducer(options, mul1_other_edge_id, "Mul");
+    if (!half_node || GetOtherInput(half_node, x_edge_id) == INVALID_EDGEID ||
+        !IsScalarConstant(graph_data, GetOtherInput(half_node, x_edge_id), 0.5f)) {
+        return INVALID_EDGEID;
+    }
+    nodes->insert(nodes->end(), {half_node, one_add_node, mul1_node});
+    return mul1_node->GetOutput(0);
+}
+
+/*
+  0.5 * x * (1 + Erf(x / sqrt(2))) is replaced by pmx.GELU(x), and
+  0.5 * x * (1 + Tanh(sqrt(2 / pi) * (x + 0.044715 * Pow(x, 3)))) is replaced by pmx.GELU(x) with approximate = true.
+*/
+bool FuseGELU(const OptKernelOptions& options) {
+    bool graph_changed = false;
+    auto graph_topo = options.graph_topo;
+    auto graph_data = options.graph_data;
+    auto& tensors = *options.tensors;
+
+    for (auto it = graph_topo->CreateNodeIter(); it->IsValid(); it->Forward()) {
+        auto node = it->Get();
+        if (node->GetType().domain != "" || (node->GetType().name != "Erf" && node->GetType().name != "Tanh")) {
+            continue;
+        }
+
+        auto act_node = node;
+        const bool approximate = (act_node->GetType().name == "Tanh");
+
+        std::vector<ir::Node*> to_delete_nodes;
+        auto x_edge_id = approximate ? MatchTanhInput(options, act_node, &to_delete_nodes)
+                                     : MatchErfInput(options, act_node, &to_delete_nodes);
+        if (x_edge_id == INVALID_EDGEID) {
+            continue;
+        }
+        auto x_tensor_ref = tensors.find(x_edge_id);
+        if (x_tensor_ref == tensors.end() ||
+            x_tensor_ref->second->GetShape()->GetDataType() != ppl::common::DATATYPE_FLOAT32) {
+            continue;
+        }
+
+        to_delete_nodes.push_back(act_node);
+        auto output_edge_id = MatchGELUOutput(options, x_edge_id, act_node, &to_delete_nodes);
+        if (output_edge_id == INVALID_EDGEID) {
+            continue;
+        }
+
+        /** 1. create fused node and its param **/
+        const std::string gelu_node_name =
+            "Fused_GELU_" + to_delete_nodes.front()->GetName() + "_" + to_delete_nodes.back()->GetName();
+        auto node_ret_pair = graph_topo->AddNode(gelu_node_name);
+        if (!node_ret_pair.second) {
+            LOG(ERROR) << "node[" << gelu_node_name << "] already exists.";
+            continue;
+        }
+        auto gelu_node = node_ret_pair.first;
+        gelu_node->SetType(ir::Node::Type("pmx", "GELU", 1));
+
+        auto gelu_param = std::make_shared<ppl::nn::pmx::GELUParam>();
+        gelu_param->approximate = approximate;
+        graph_data->attrs[gelu_node->GetId()] = gelu_param;
+
+        /** 2. replace ops with fused op **/
+        std::vector<edgeid_t> constant_edge_ids;
+        for (auto n : to_delete_nodes) {
+            for (uint32_t i = 0; i < n->GetInputCount(); ++i) {
+                if (graph_data->constants.find(n->GetInput(i)) != graph_data->constants.end()) {
+                    constant_edge_ids.push_back(n->GetInput(i));
+                }
+            }
+        }
+
+        std::vector<ir::Edge*> inputs{graph_topo->GetEdge(x_edge_id)};
+        std::vector<ir::Edge*> outputs{graph_topo->GetEdge(output_edge_id)};
+        if (ppl::common::RC_SUCCESS !=
+            ReplaceSubgraphWithOneNode(options, to_delete_nodes, inputs, outputs, gelu_node)) {
+            LOG(ERROR) << "Replace sequence nodes with node [" << gelu_node_name << "] failed.";
+            graph_data->attrs.erase(gelu_node->GetId());
+            graph_topo->DelNode(gelu_node->GetId());
+            continue;
+        }
+
+        for (auto edge_id : constant_edge_ids) {
+            auto edge = graph_topo->GetEdge(edge_id);
+            if (edge && edge->CalcConsumerCount() == 0 && !IsReservedEdge(tensors, edge_id)) {
+                graph_data->constants.erase(edge_id);
+                graph_topo->DelEdge(edge_id);
+            }
+        }
+
+        /** 3. create opt_kernel **/
+        X86OptKernel* opt_kernel = nullptr;
+        if (ppl::common::RC_SUCCESS != CreateX86OptKernel(options, gelu_node, &opt_kernel)) {
+            LOG(ERROR) << "Create OptKernel [" << gelu_node_name << "] failed.";
+            graph_data->attrs.erase(gelu_node->GetId());
+            graph_topo->DelNode(gelu_node->GetId());
+            continue;
+        }
+        opt_kernel->SetOutputDataFormat(0, tensors[output_edge_id]->GetShape()->GetDataFormat());
+
+        LOG(DEBUG) << "Successfully fused " << gelu_node_name;
+        graph_changed = true;
+    }
+
+    return graph_changed;
+}
+
+}}} // namespace ppl::nn::x86
@@ -19,6 +19,7 @@
 #include "ppl/nn/engines/x86/optimizer/rules/utils.h"
 #include "ppl/nn/engines/x86/optimizer/opt_rule_manager.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/gemm_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/gelu_op.h"
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -43,15 +44,17 @@ bool FuseGemmActivation(const OptKernelOptions &options) {
 
             auto successor_node_id = gemm_output_edge->CreateConsumerIter().Get();
             auto successor_node = graph_topo->GetNode(successor_node_id);
-            if (successor_node->GetType().domain != "") {
-                continue;
-            }
 
             auto gemm_kernel = reinterpret_cast<GemmOp*>(info->kernels[gemm_node->GetId()].get());
-            if (successor_node->GetType().name == "Relu") {
+            if (successor_node->GetType().domain == "" && successor_node->GetType().name == "Relu") {
                 if (!gemm_kernel->TryFuseReLU()) { // set fuse flag to gemm_op
                     continue;
                 }
+            } else if (successor_node->GetType().domain == "pmx" && successor_node->GetType().name == "GELU") {
+                auto gelu_kernel = reinterpret_cast<GeluOp*>(info->kernels[successor_node_id].get());
+                if (!gemm_kernel->TryFuseGELU(gelu_kernel->IsApproximate())) {
+                    continue;
+                }
             } else {
                 continue;
             }
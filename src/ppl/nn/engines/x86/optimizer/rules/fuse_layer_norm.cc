@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_layer_norm.h"
+#include "ppl/nn/engines/x86/optimizer/rules/utils.h"
+#include "ppl/nn/params/onnx/reduce_param.h"
+#include "ppl/nn/params/pmx/layer_norm_param.h"
+#include <algorithm>
+
+namespace ppl { namespace nn { namespace x86 {
+
+// reduced axes must be the last dims of input and kept. returns the first of them.
+static int32_t GetNormalizedAxis(const ir::GraphData* graph_data, const ir::Node* reduce_node, uint32_t dim_count) {
+    if (reduce_node->GetInputCount() != 1) {
+        return -1;
+    }
+    auto param_ref = graph_data->attrs.find(reduce_node->GetId());
+    if (param_ref == graph_data->attrs.end()) {
+        return -1;
+    }
+    auto param = static_cast<const ppl::nn::onnx::ReduceParam*>(param_ref->second.get());
+    if (!param->keepdims || param->axes.empty() || param->axes.size() > dim_count) {
+        return -1;
+    }
+
+    std::vector<int32_t> axes(param->axes.size());
+    for (uint32_t i = 0; i < axes.size(); ++i) {
+        axes[i] = param->axes[i] < 0 ? param->axes[i] + dim_count : param->axes[i];
+    }
+    std::sort(axes.begin(), axes.end());
+    for (uint32_t i = 0; i < axes.size(); ++i) {
+        if (axes[i] != (int32_t)(dim_count - axes.size() + i)) {
+            return -1;
+        }
+    }
+    return axes[0];
+}
+
+// fp32 constant that is broadcasted to the normalized dims of input, e.g. [C] or [1, 1, C] for input [N, L, C]
+static bool IsAffineParam(const ir::GraphData* graph_data, edgeid_t edge_id, const TensorShape& input_shape,
+                          int32_t axis) {
+    if (graph_data->constants.find(edge_id) == graph_data->constants.end()) {
+        return false;
+    }
+    auto shape_ref = graph_data->shapes.find(edge_id);
+    if (shape_ref == graph_data->shapes.end()) {
+        return false;
+    }
+
+    auto& shape = shape_ref->second;
+    const uint32_t dim_count = input_shape.GetDimCount();
+    if (shape.data_type != ppl::common::DATATYPE_FLOAT32 || shape.data_format != ppl::common::DATAFORMAT_NDARRAY ||
+        shape.dims.size() > dim_count) {
+        return false;
+    }
+
+    const uint32_t offset = dim_count - shape.dims.size();
+    for (uint32_t i = 0; i < shape.dims.size(); ++i) {
+        const int64_t expected = (i + offset < (uint32_t)axis) ? 1 : input_shape.GetDim(i + offset);
+        if (shape.dims[i] != expected) {
+            return false;
+        }
+    }
+    return (dim_count - axis <= shape.dims.size());
+}
+
+/*
+  x -> ReduceMean -> Sub(x, mean) -> Pow(2) -> ReduceMean -> Add(eps) -> Sqrt -> Div(diff, std) [-> Mul(scale) [-> Add(shift)]]
+  is replaced by pmx.LayerNorm(x [, scale [, shift]]).
+*/
+bool FuseLayerNorm(const OptKernelOptions& options) {
+    bool graph_changed = false;
+    auto graph_topo = options.graph_topo;
+    auto graph_data = options.graph_data;
+    auto& tensors = *options.tensors;
+
+    for (auto it = graph_topo->CreateNodeIter(); it->IsValid(); it->Forward()) {
+        auto node = it->Get();
+        if (node->GetType().domain != "" || node->GetType().name != "ReduceMean") {
+            continue;
+        }
+
+        auto mean_node = node;
+        auto input_edge_id = mean_node->GetInput(0);
+        auto input_tensor_ref = tensors.find(input_edge_id);
+        if (input_tensor_ref == tensors.end()) {
+            continue;
+        }
+        auto& input_shape = *input_tensor_ref->second->GetShape();
+        if (input_shape.GetDataType() != ppl::common::DATATYPE_FLOAT32 || input_shape.GetDimCount() == 0) {
+            continue;
+        }
+        const int32_t axis = GetNormalizedAxis(graph_data, mean_node, input_shape.GetDimCount());
+        if (axis < 0) {
+            continue;
+        }
+
+        // x - mean(x)
+        auto sub_node = GetSingleConsumer(options, mean_node->GetOutput(0), "Sub");
+        if (!sub_node || sub_node->GetInput(0) != input_edge_id || sub_node->GetInput(1) != mean_node->GetOutput(0) ||
+            HasFusedReLU(options, sub_node)) {
+            continue;
+        }
+
+        // diff is consumed by Pow and Div
+        auto diff_edge_id = sub_node->GetOutput(0);
+        auto diff_edge = graph_topo->GetEdge(diff_edge_id);
+        if (diff_edge->CalcConsumerCount() != 2 || IsReservedEdge(tensors, diff_edge_id)) {
+            continue;
+        }
+        ir::Node* pow_node = nullptr;
+        ir::Node* div_node = nullptr;
+        for (auto consumer_it = diff_edge->CreateConsumerIter(); consumer_it.IsValid(); consumer_it.Forward()) {
+            auto consumer = graph_topo->GetNode(consumer_it.Get());
+            if (consumer->GetType().domain == "" && consumer->GetType().name == "Pow") {
+                pow_node = consumer;
+            } else if (consumer->GetType().domain == "" && consumer->GetType().name == "Div") {
+                div_node = consumer;
+            }
+        }
+        if (!pow_node || !div_node || pow_node->GetInput(0) != diff_edge_id || div_node->GetInput(0) != diff_edge_id ||
+            HasFusedReLU(options, div_node)) {
+            continue;
+        }
+        float exponent = 0.0f;
+        if (!GetScalarConstant(graph_data, pow_node->GetInput(1), &exponent) || exponent != 2.0f) {
+            continue;
+        }
+
+        // variance = mean(diff ^ 2) over the same axes
+        auto var_node = GetSingleConsumer(options, pow_node->GetOutput(0), "ReduceMean");
+        if (!var_node || GetNormalizedAxis(graph_data, var_node, input_shape.GetDimCount()) != axis) {
+            continue;
+        }
+
+        // sqrt(variance + eps)
+        auto eps_node = GetSingleConsumer(options, var_node->GetOutput(0), "Add");
+        if (!eps_node || HasFusedReLU(options, eps_node)) {
+            continue;
+        }
+        auto eps_edge_id = GetOtherInput(eps_node, var_node->GetOutput(0));
+        float eps = 0.0f;
+        if (eps_edge_id == INVALID_EDGEID || !GetScalarConstant(graph_data, eps_edge_id, &eps)) {
+            continue;
+        }
+        auto sqrt_node = GetSingleConsumer(options, eps_node->GetOutput(0), "Sqrt");
+        if (!sqrt_node || GetSingleConsumer(options, sqrt_node->GetOutput(0), "Div") != div_node ||
+            div_node->GetInput(1) != sqrt_node->GetOutput(0)) {
+            continue;
+        }
+
+        std::vector<ir::Node*> to_delete_nodes{mean_node, sub_node, pow_node, var_node, eps_node, sqrt_node, div_node};
+        std::vector<ir::Edge*> inputs{graph_topo->GetEdge(input_edge_id)};
+        auto output_edge_id = div_node->GetOutput(0);
+
+        // optional scale and shift
+        auto scale_node = GetSingleConsumer(options, output_edge_id, "Mul");
+        if (scale_node && !HasFusedReLU(options, scale_node)) {
+            auto scale_edge_id = GetOtherInput(scale_node, output_edge_id);
+            if (scale_edge_id != INVALID_EDGEID && IsAffineParam(graph_data, scale_edge_id, input_shape, axis)) {
+                to_delete_nodes.push_back(scale_node);
+                inputs.push_back(graph_topo->GetEdge(scale_edge_id));
+                output_edge_id = scale_node->GetOutput(0);
+
+                auto shift_node = GetSingleConsumer(options, output_edge_id, "Add");
+                if (shift_node && !HasFusedReLU(options, shift_node)) {
+                    auto shift_edge_id = GetOtherInput(shift_node, output_edge_id);
+                    if (shift_edge_id != INVALID_EDGEID &&
+                        IsAffineParam(graph_data, shift_edge_id, input_shape, axis)) {
+                        to_delete_nodes.push_back(shift_node);
+                        inputs.push_back(graph_topo->GetEdge(shift_edge_id));
+                        output_edge_id = shift_node->GetOutput(0);
+                    }
+                }
+            }
+        }
+
+        /** 1. create fused node and its param **/
+        const std::string layer_norm_node_name = "Fused_LayerNorm_" + mean_node->GetName() + "_" +
+            graph_topo->GetNode(graph_topo->GetEdge(output_edge_id)->GetProducer())->GetName();
+        auto node_ret_pair = graph_topo->AddNode(layer_norm_node_name);
+        if (!node_ret_pair.second) {
+            LOG(ERROR) << "node[" << layer_norm_node_name << "] already exists.";
+            continue;
+        }
+        auto layer_norm_node = node_ret_pair.first;
+        layer_norm_node->SetType(ir::Node::Type("pmx", "LayerNorm", 1));
+
+        auto layer_norm_param = std::make_shared<ppl::nn::pmx::LayerNormParam>();
+        layer_norm_param->elementwise_affine = (inputs.size() > 1);
+        layer_norm_param->axis = axis;
+        layer_norm_param->eps = eps;
+        layer_norm_param->skip_term = false;
+        graph_data->attrs[layer_norm_node->GetId()] = layer_norm_param;
+
+        /** 2. replace ops with fused op **/
+        const edgeid_t exponent_edge_id = pow_node->GetInput(1);
+        std::vector<ir::Edge*> outputs{graph_topo->GetEdge(output_edge_id)};
+        if (ppl::common::RC_SUCCESS !=
+            ReplaceSubgraphWithOneNode(options, to_delete_nodes, inputs, outputs, layer_norm_node)) {
+            LOG(ERROR) << "Replace sequence nodes with node [" << layer_norm_node_name << "] failed.";
+            graph_data->attrs.erase(layer_norm_node->GetId());
+            graph_topo->DelNode(layer_norm_node->GetId());
+            continue;
+        }
+
+        // exponent and eps are no longer used
+        for (auto edge_id : {exponent_edge_id, eps_edge_id}) {
+            auto edge = graph_topo->GetEdge(edge_id);
+            if (edge && edge->CalcConsumerCount() == 0 && !IsReservedEdge(tensors, edge_id)) {
+                graph_data->constants.erase(edge_id);
+                graph_topo->DelEdge(edge_id);
+            }
+        }
+
+        /** 3. create opt_kernel **/
+        X86OptKernel* opt_kernel = nullptr;
+        if (ppl::common::RC_SUCCESS != CreateX86OptKernel(options, layer_norm_node, &opt_kernel)) {
+            LOG(ERROR) << "Create OptKernel [" << layer_norm_node_name << "] failed.";
+            graph_data->attrs.erase(layer_norm_node->GetId());
+            graph_topo->DelNode(layer_norm_node->GetId());
+            continue;
+        }
+        opt_kernel->SetOutputDataFormat(0, tensors[output_edge_id]->GetShape()->GetDataFormat());
+
+        LOG(DEBUG) << "Successfully fused " << layer_norm_node_name;
+        graph_changed = true;
+    }
+
+    return graph_changed;
+}
+
+}}} // namespace ppl::nn::x86
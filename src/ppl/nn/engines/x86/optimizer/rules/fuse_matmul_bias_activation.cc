@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/rules/fuse_matmul_bias_activation.h"
+#include "ppl/nn/engines/x86/optimizer/rules/utils.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/matmul_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/add_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/gelu_op.h"
+
+namespace ppl { namespace nn { namespace x86 {
+
+// fp32 constant that is broadcasted to rows of matmul's output, e.g. [N], [1, N] or [1]
+static bool IsMatMulBias(const ir::GraphData* graph_data, edgeid_t bias_edge_id, int64_t N,
+                         uint32_t output_dim_count) {
+    if (graph_data->constants.find(bias_edge_id) == graph_data->constants.end()) {
+        return false;
+    }
+
+    auto bias_shape_ref = graph_data->shapes.find(bias_edge_id);
+    if (bias_shape_ref == graph_data->shapes.end()) {
+        return false;
+    }
+    auto& bias_shape = bias_shape_ref->second;
+    if (bias_shape.data_type != ppl::common::DATATYPE_FLOAT32 ||
+        bias_shape.data_format != ppl::common::DATAFORMAT_NDARRAY || bias_shape.dims.size() > output_dim_count) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i + 1 < bias_shape.dims.size(); ++i) {
+        if (bias_shape.dims[i] != 1) {
+            return false;
+        }
+    }
+    return (bias_shape.dims.empty() || bias_shape.dims.back() == N || bias_shape.dims.back() == 1);
+}
+
+bool FuseMatMulBiasActivation(const OptKernelOptions& options) {
+    bool graph_changed = false;
+    auto graph_topo = options.graph_topo;
+    auto graph_data = options.graph_data;
+    auto info = options.info;
+    auto& tensors = *options.tensors;
+
+    for (auto it = graph_topo->CreateNodeIter(); it->IsValid(); it->Forward()) {
+        auto node = it->Get();
+        if (node->GetType().domain == "" && node->GetType().name == "MatMul") {
+            auto matmul_node = node;
+            auto matmul_kernel = static_cast<MatMulOp*>(info->kernels[matmul_node->GetId()].get());
+            auto matmul_output_edge_id = matmul_node->GetOutput(0);
+            auto matmul_output_edge = graph_topo->GetEdge(matmul_output_edge_id);
+            if (matmul_output_edge->CalcConsumerCount() != 1) {
+                continue;
+            }
+            if (IsReservedEdge(tensors, matmul_output_edge_id)) {
+                continue;
+            }
+            auto matmul_output_shape = tensors[matmul_output_edge_id]->GetShape();
+            if (matmul_output_shape->GetDataType() != ppl::common::DATATYPE_FLOAT32 ||
+                matmul_output_shape->GetDimCount() == 0) {
+                continue;
+            }
+
+            auto successor_node_id = matmul_output_edge->CreateConsumerIter().Get();
+            auto successor_node = graph_topo->GetNode(successor_node_id);
+            if (successor_node->GetType().domain == "pmx" && successor_node->GetType().name == "GELU") {
+                auto gelu_kernel = static_cast<GeluOp*>(info->kernels[successor_node_id].get());
+                if (!matmul_kernel->TryFuseGELU(gelu_kernel->IsApproximate())) {
+                    continue;
+                }
+            } else if (successor_node->GetType().domain != "") {
+                continue;
+            } else if (successor_node->GetType().name == "Add") {
+                // bias must be added before activation
+                if (!matmul_kernel->CanFuseBiasAndActivation() || matmul_node->GetInputCount() != 2 ||
+                    matmul_kernel->HasFusedActivation()) {
+                    continue;
+                }
+
+                auto bias_edge_id = successor_node->GetInput(0) == matmul_output_edge_id ? successor_node->GetInput(1)
+                                                                                         : successor_node->GetInput(0);
+                if (bias_edge_id == matmul_output_edge_id) {
+                    continue;
+                }
+
+                auto& b_dims = graph_data->shapes[matmul_node->GetInput(1)].dims;
+                if (!IsMatMulBias(graph_data, bias_edge_id, b_dims.back(), matmul_output_shape->GetDimCount())) {
+                    continue;
+                }
+
+                auto add_kernel = static_cast<AddOp*>(info->kernels[successor_node_id].get());
+                if (add_kernel->HasFuseReLU() && !matmul_kernel->TryFuseReLU()) {
+                    continue;
+                }
+
+                // bias becomes the 3rd input of matmul
+                auto bias_edge = graph_topo->GetEdge(bias_edge_id);
+                bias_edge->DelConsumer(successor_node_id);
+                bias_edge->AddConsumer(matmul_node->GetId());
+                matmul_node->AddInput(bias_edge_id);
+            } else if (successor_node->GetType().name == "Relu") {
+                if (!matmul_kernel->TryFuseReLU()) {
+                    continue;
+                }
+            } else if (IsReLU6(graph_data, successor_node)) {
+                if (!matmul_kernel->TryFuseReLU6()) {
+                    continue;
+                }
+                // remove relu6's input min/max's connect in advance
+                for (uint32_t i = 1; i < successor_node->GetInputCount(); ++i) {
+                    auto edge = graph_topo->GetEdge(successor_node->GetInput(i));
+                    edge->DelConsumer(successor_node_id);
+                    if (edge->CalcConsumerCount() == 0 && !IsReservedEdge(tensors, edge->GetId())) {
+                        graph_data->constants.erase(edge->GetId());
+                        graph_topo->DelEdge(edge->GetId());
+                    }
+                }
+            } else {
+                continue;
+            }
+
+            auto successor_output_edge_id = successor_node->GetOutput(0);
+            auto successor_output_edge = graph_topo->GetEdge(successor_output_edge_id);
+            // matmul_node -> matmul_output_edge -> successor_node -> successor_output_edge
+            // matmul_node                                         -> successor_output_edge
+            matmul_node->ReplaceOutput(matmul_output_edge_id, successor_output_edge_id);
+            successor_output_edge->SetProducer(matmul_node->GetId());
+
+            info->kernels.erase(successor_node_id);
+            tensors.erase(matmul_output_edge_id);
+            graph_topo->DelNode(successor_node_id);
+            graph_topo->DelEdge(matmul_output_edge_id);
+
+            graph_changed = true;
+        }
+    }
+
+    return graph_changed;
+}
+
+}}} // namespace ppl::nn::x86
@@ -17,6 +17,8 @@
 
 #include "ppl/nn/engines/x86/optimizer/rules/utils.h"
 #include "ppl/nn/engines/x86/optimizer/opt_rule_manager.h"
+#include "ppl/nn/utils/min_cut_solver.h"
+#include <set>
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -189,15 +191,209 @@ static ppl::common::RetCode FuseReorderOp(const OptKernelOptions& options) {
     return ppl::common::RC_SUCCESS;
 }
 
-bool LayoutOptimize(const OptKernelOptions &options) {
+struct LayoutPlan final {
+    std::vector<ppl::common::dataformat_t> input_formats;
+    std::vector<ppl::common::dataformat_t> output_formats;
+};
+
+struct LayoutCost final {
+    uint32_t reorder_count = 0;
+    uint64_t reorder_bytes = 0;
+    /** bytes of inputs and outputs of all nodes, which grows with paddings of N16CX */
+    uint64_t node_bytes = 0;
+    /** bytes moved when converting outputs of the graph to NDARRAY */
+    uint64_t output_bytes = 0;
+
+    uint64_t GetTotalBytes() const {
+        return reorder_bytes + node_bytes + output_bytes;
+    }
+};
+
+static void InitIOInfo(const ir::Node* node, std::map<edgeid_t, std::unique_ptr<TensorImpl>>* tensors,
+                       InputOutputInfo* info) {
+    info->SetNode(node);
+    info->SetAcquireFunc([tensors](edgeid_t eid, uint32_t) -> EdgeObject* {
+        auto iter = tensors->find(eid);
+        if (iter == tensors->end()) {
+            return nullptr;
+        }
+        return iter->second.get();
+    });
+}
+
+static ppl::common::RetCode SelectLayout(X86OptKernel* kernel, const InputOutputInfo& info, LayoutPlan* plan) {
+    auto node = kernel->GetNode();
+    plan->input_formats.assign(node->GetInputCount(), ppl::common::DATAFORMAT_NDARRAY);
+    plan->output_formats.assign(node->GetOutputCount(), ppl::common::DATAFORMAT_NDARRAY);
+    return kernel->SelectFormat(info, &plan->input_formats, &plan->output_formats);
+}
+
+static uint64_t CalcTensorBytes(const TensorShape* shape, ppl::common::dataformat_t format) {
+    uint64_t bytes = std::max(ppl::common::GetSizeOfDataType(shape->GetDataType()), (uint32_t)1);
+    for (uint32_t i = 0; i < shape->GetDimCount(); ++i) {
+        uint64_t dim = (shape->GetDim(i) > 0) ? shape->GetDim(i) : 1; // unknown dims are counted as 1
+        if (i == 1 && format == ppl::common::DATAFORMAT_N16CX) {
+            dim = (dim + 15) / 16 * 16;
+        }
+        bytes *= dim;
+    }
+    return bytes;
+}
+
+static uint64_t CalcReorderCost(const TensorShape* shape, ppl::common::dataformat_t src_format,
+                                ppl::common::dataformat_t dst_format) {
+    if (src_format == dst_format) {
+        return 0;
+    }
+    return CalcTensorBytes(shape, src_format) + CalcTensorBytes(shape, dst_format);
+}
+
+static uint64_t CalcNodeCost(const ir::Node* node, const LayoutPlan& plan,
+                             std::map<edgeid_t, std::unique_ptr<TensorImpl>>& tensors) {
+    uint64_t bytes = 0;
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        auto edge_id = node->GetInput(i);
+        if (edge_id != INVALID_EDGEID) {
+            bytes += CalcTensorBytes(tensors[edge_id]->GetShape(), plan.input_formats[i]);
+        }
+    }
+    for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+        bytes += CalcTensorBytes(tensors[node->GetOutput(i)]->GetShape(), plan.output_formats[i]);
+    }
+    return bytes;
+}
+
+/** @brief formats of edges produced by nodes are taken from `plans`, and others from their tensors. */
+static std::vector<ppl::common::dataformat_t> CollectEdgeFormats(const OptKernelOptions& options,
+                                                                 const std::vector<nodeid_t>& sorted_nodes,
+                                                                 const std::vector<LayoutPlan>& plans) {
     auto graph_topo = options.graph_topo;
-    auto info = options.info;
-    auto &tensors = *options.tensors;
+    auto& tensors = *options.tensors;
 
-    std::vector<nodeid_t> sorted_nodes;
-    graph_topo->TopologicalSort([&sorted_nodes](nodeid_t nid) -> void {
-        sorted_nodes.push_back(nid);
-    });
+    std::vector<ppl::common::dataformat_t> edge_formats(graph_topo->GetCurrentEdgeIdBound(),
+                                                        ppl::common::DATAFORMAT_NDARRAY);
+    for (auto it = tensors.begin(); it != tensors.end(); ++it) {
+        edge_formats[it->first] = it->second->GetShape()->GetDataFormat();
+    }
+    for (auto node_id : sorted_nodes) {
+        auto node = graph_topo->GetNode(node_id);
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            edge_formats[node->GetOutput(i)] = plans[node_id].output_formats[i];
+        }
+    }
+    return edge_formats;
+}
+
+static void CalcLayoutCost(const OptKernelOptions& options, const std::vector<nodeid_t>& sorted_nodes,
+                           const std::vector<LayoutPlan>& plans, LayoutCost* cost) {
+    auto graph_topo = options.graph_topo;
+    auto& tensors = *options.tensors;
+    auto edge_formats = CollectEdgeFormats(options, sorted_nodes, plans);
+
+    // reorders of the same edge to the same format are merged by FuseReorderOp()
+    std::set<std::pair<edgeid_t, ppl::common::dataformat_t>> reorders;
+    for (auto node_id : sorted_nodes) {
+        auto node = graph_topo->GetNode(node_id);
+        auto& plan = plans[node_id];
+        for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+            auto edge_id = node->GetInput(i);
+            if (edge_id != INVALID_EDGEID && edge_formats[edge_id] != plan.input_formats[i]) {
+                reorders.insert(std::make_pair(edge_id, plan.input_formats[i]));
+            }
+        }
+        for (uint32_t i = 0; i < node->GetExtraInputCount(); ++i) {
+            auto edge_id = node->GetExtraInput(i);
+            if (edge_formats[edge_id] != ppl::common::DATAFORMAT_NDARRAY) {
+                reorders.insert(std::make_pair(edge_id, ppl::common::DATAFORMAT_NDARRAY));
+            }
+        }
+        cost->node_bytes += CalcNodeCost(node, plan, tensors);
+    }
+
+    for (uint32_t i = 0; i < graph_topo->GetOutputCount(); ++i) {
+        auto edge_id = graph_topo->GetOutput(i);
+        cost->output_bytes +=
+            CalcReorderCost(tensors[edge_id]->GetShape(), edge_formats[edge_id], ppl::common::DATAFORMAT_NDARRAY);
+    }
+
+    cost->reorder_count = reorders.size();
+    for (auto it = reorders.begin(); it != reorders.end(); ++it) {
+        cost->reorder_bytes += CalcReorderCost(tensors[it->first]->GetShape(), edge_formats[it->first], it->second);
+    }
+}
+
+/**
+   @brief selects formats of `kernel` as if all of its inputs are in `format`.
+   @return false if `kernel` does not produce `format` in this case.
+*/
+static bool ProbeLayout(X86OptKernel* kernel, ppl::common::dataformat_t format,
+                        std::map<edgeid_t, std::unique_ptr<TensorImpl>>* tensors, LayoutPlan* plan) {
+    auto node = kernel->GetNode();
+    if (node->GetOutputCount() == 0) {
+        return false;
+    }
+
+    std::vector<ppl::common::dataformat_t> saved_formats(node->GetInputCount(), ppl::common::DATAFORMAT_NDARRAY);
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        auto edge_id = node->GetInput(i);
+        if (edge_id == INVALID_EDGEID) {
+            continue;
+        }
+        auto shape = (*tensors)[edge_id]->GetShape();
+        saved_formats[i] = shape->GetDataFormat();
+        shape->SetDataFormat((format == ppl::common::DATAFORMAT_N16CX && shape->GetDimCount() == 4)
+                                 ? ppl::common::DATAFORMAT_N16CX
+                                 : ppl::common::DATAFORMAT_NDARRAY);
+    }
+
+    InputOutputInfo IOinfo;
+    InitIOInfo(node, tensors, &IOinfo);
+    auto status = SelectLayout(kernel, IOinfo, plan);
+
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        auto edge_id = node->GetInput(i);
+        if (edge_id != INVALID_EDGEID) {
+            (*tensors)[edge_id]->GetShape()->SetDataFormat(saved_formats[i]);
+        }
+    }
+
+    if (status != ppl::common::RC_SUCCESS) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+        if (plan->output_formats[i] != format) {
+            return false;
+        }
+    }
+
+    // N16CX is only planned for 4-D tensors
+    if (format == ppl::common::DATAFORMAT_N16CX) {
+        for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+            auto edge_id = node->GetInput(i);
+            if (edge_id != INVALID_EDGEID && plan->input_formats[i] == ppl::common::DATAFORMAT_N16CX &&
+                (*tensors)[edge_id]->GetShape()->GetDimCount() != 4) {
+                return false;
+            }
+        }
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            if ((*tensors)[node->GetOutput(i)]->GetShape()->GetDimCount() != 4) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*
+  selects algorithms and formats of nodes in topological order. each node follows formats of its inputs, which
+  may cause reorders where neighbours disagree.
+*/
+static bool SelectLayoutGreedily(const OptKernelOptions& options, const std::vector<nodeid_t>& sorted_nodes,
+                                 std::vector<LayoutPlan>* plans) {
+    auto info = options.info;
+    auto& tensors = *options.tensors;
 
     for (auto node_id : sorted_nodes) {
         if (info->kernels.find(node_id) == info->kernels.end()) {
@@ -208,14 +404,7 @@ bool LayoutOptimize(const OptKernelOptions &options) {
         auto node = kernel->GetNode();
 
         InputOutputInfo IOinfo;
-        IOinfo.SetNode(node);
-        IOinfo.SetAcquireFunc([&tensors](edgeid_t eid, uint32_t etype) -> EdgeObject* {
-            auto iter = tensors.find(eid);
-            if (iter == tensors.end()) {
-                return nullptr;
-            }
-            return iter->second.get();
-        });
+        InitIOInfo(node, options.tensors, &IOinfo);
 
         auto status = kernel->SelectAlgorithm(IOinfo, options);
         if (status != ppl::common::RC_SUCCESS) {
@@ -223,24 +412,188 @@ bool LayoutOptimize(const OptKernelOptions &options) {
             return false;
         }
 
-        std::vector<ppl::common::dataformat_t> selected_input_formats(node->GetInputCount(), ppl::common::DATAFORMAT_NDARRAY);
-        std::vector<ppl::common::dataformat_t> selected_output_formats(node->GetOutputCount(), ppl::common::DATAFORMAT_NDARRAY);
-
-        status = kernel->SelectFormat(IOinfo, &selected_input_formats, &selected_output_formats);
+        auto& plan = plans->at(node_id);
+        status = SelectLayout(kernel, IOinfo, &plan);
         if (status != ppl::common::RC_SUCCESS) {
             LOG(ERROR) << "kernel[" << node->GetName() << "] SelectFormat failed: " << ppl::common::GetRetCodeStr(status);
             return false;
         }
 
+        for (uint32_t i = 0; i < node->GetOutputCount(); i++) {
+            tensors[node->GetOutput(i)]->GetShape()->SetDataFormat(plan.output_formats[i]);
+        }
+    }
+
+    return true;
+}
+
+/*
+  nodes that work in both NDARRAY and N16CX and follow formats of their inputs, e.g. activations, eltwise ops and
+  pooling, are labeled 0(NDARRAY) or 1(N16CX) as a whole. other nodes, e.g. convolutions whose algorithms are
+  selected already, keep the greedy formats. the labeling that minimizes bytes moved by reorders plus bytes
+  accessed by nodes is solved globally by a minimum cut, and is taken only if it costs less than the greedy one.
+  reorders of an edge shared by several consumers are counted once for each consumer in the solver.
+*/
+static void RefineLayout(const OptKernelOptions& options, const std::vector<nodeid_t>& sorted_nodes,
+                         std::vector<LayoutPlan>* plans) {
+    static const uint32_t NOT_FLEXIBLE = UINT32_MAX;
+    static const ppl::common::dataformat_t label2format[2] = {ppl::common::DATAFORMAT_NDARRAY,
+                                                              ppl::common::DATAFORMAT_N16CX};
+
+    auto graph_topo = options.graph_topo;
+    auto info = options.info;
+    auto& tensors = *options.tensors;
+
+    std::vector<uint32_t> nid2var(graph_topo->GetCurrentNodeIdBound(), NOT_FLEXIBLE);
+    std::vector<nodeid_t> var2nid;
+    std::vector<LayoutPlan> candidates[2];
+    for (auto node_id : sorted_nodes) {
+        auto kernel = (X86OptKernel*)info->kernels[node_id].get();
+        LayoutPlan plans_of_labels[2];
+        if (ProbeLayout(kernel, label2format[0], options.tensors, &plans_of_labels[0]) &&
+            ProbeLayout(kernel, label2format[1], options.tensors, &plans_of_labels[1])) {
+            nid2var[node_id] = var2nid.size();
+            var2nid.push_back(node_id);
+            candidates[0].push_back(std::move(plans_of_labels[0]));
+            candidates[1].push_back(std::move(plans_of_labels[1]));
+        }
+    }
+    if (var2nid.empty()) {
+        return;
+    }
+
+    auto edge_formats = CollectEdgeFormats(options, sorted_nodes, *plans);
+
+    utils::MinCutSolver solver(var2nid.size());
+    for (uint32_t v = 0; v < var2nid.size(); ++v) {
+        auto node = graph_topo->GetNode(var2nid[v]);
+        solver.AddUnary(v, CalcNodeCost(node, candidates[0][v], tensors), CalcNodeCost(node, candidates[1][v], tensors));
+    }
+
+    for (auto node_id : sorted_nodes) {
+        auto node = graph_topo->GetNode(node_id);
+        const uint32_t cv = nid2var[node_id];
+        const uint32_t input_count = node->GetInputCount();
+
+        for (uint32_t i = 0; i < input_count + node->GetExtraInputCount(); ++i) {
+            const bool is_extra_input = (i >= input_count);
+            auto edge_id = is_extra_input ? node->GetExtraInput(i - input_count) : node->GetInput(i);
+            if (edge_id == INVALID_EDGEID) {
+                continue;
+            }
+            auto shape = tensors[edge_id]->GetShape();
+
+            ppl::common::dataformat_t dst_formats[2];
+            for (uint32_t l = 0; l < 2; ++l) {
+                if (is_extra_input) {
+                    dst_formats[l] = ppl::common::DATAFORMAT_NDARRAY;
+                } else {
+                    dst_formats[l] = (cv == NOT_FLEXIBLE) ? plans->at(node_id).input_formats[i]
+                                                          : candidates[l][cv].input_formats[i];
+                }
+            }
+
+            // outputs of flexible nodes are in the format of their labels
+            auto producer_id = graph_topo->GetEdge(edge_id)->GetProducer();
+            const uint32_t pv = (producer_id == INVALID_NODEID) ? NOT_FLEXIBLE : nid2var[producer_id];
+
+            if (pv == NOT_FLEXIBLE && cv == NOT_FLEXIBLE) {
+                continue;
+            }
+            if (pv == NOT_FLEXIBLE) {
+                auto src_format = edge_formats[edge_id];
+                solver.AddUnary(cv, CalcReorderCost(shape, src_format, dst_formats[0]),
+                                CalcReorderCost(shape, src_format, dst_formats[1]));
+            } else if (cv == NOT_FLEXIBLE || is_extra_input) {
+                solver.AddUnary(pv, CalcReorderCost(shape, label2format[0], dst_formats[0]),
+                                CalcReorderCost(shape, label2format[1], dst_formats[0]));
+            } else {
+                solver.AddPairwise(pv, cv, CalcReorderCost(shape, label2format[0], dst_formats[0]),
+                                   CalcReorderCost(shape, label2format[0], dst_formats[1]),
+                                   CalcReorderCost(shape, label2format[1], dst_formats[0]),
+                                   CalcReorderCost(shape, label2format[1], dst_formats[1]));
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < graph_topo->GetOutputCount(); ++i) {
+        auto edge_id = graph_topo->GetOutput(i);
+        auto producer_id = graph_topo->GetEdge(edge_id)->GetProducer();
+        if (producer_id != INVALID_NODEID && nid2var[producer_id] != NOT_FLEXIBLE) {
+            auto shape = tensors[edge_id]->GetShape();
+            solver.AddUnary(nid2var[producer_id], 0,
+                            CalcReorderCost(shape, ppl::common::DATAFORMAT_N16CX, ppl::common::DATAFORMAT_NDARRAY));
+        }
+    }
+
+    std::vector<uint8_t> labels;
+    solver.Solve(&labels);
+
+    std::vector<LayoutPlan> refined_plans(*plans);
+    for (uint32_t v = 0; v < var2nid.size(); ++v) {
+        refined_plans[var2nid[v]] = candidates[labels[v]][v];
+    }
+
+    LayoutCost greedy_cost, refined_cost;
+    CalcLayoutCost(options, sorted_nodes, *plans, &greedy_cost);
+    CalcLayoutCost(options, sorted_nodes, refined_plans, &refined_cost);
+    if (refined_cost.GetTotalBytes() >= greedy_cost.GetTotalBytes()) {
+        LOG(DEBUG) << "greedy layout is kept. [" << greedy_cost.reorder_count << "] reorders of ["
+                   << greedy_cost.reorder_bytes << "] bytes.";
+        return;
+    }
+
+    for (auto node_id : sorted_nodes) {
+        auto node = graph_topo->GetNode(node_id);
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            tensors[node->GetOutput(i)]->GetShape()->SetDataFormat(refined_plans[node_id].output_formats[i]);
+        }
+    }
+
+    // nodes that are not flexible may accept inputs in other formats without changing their outputs, e.g. Shape
+    for (auto node_id : sorted_nodes) {
+        if (nid2var[node_id] != NOT_FLEXIBLE) {
+            continue;
+        }
+        auto kernel = (X86OptKernel*)info->kernels[node_id].get();
+        InputOutputInfo IOinfo;
+        InitIOInfo(kernel->GetNode(), options.tensors, &IOinfo);
+        LayoutPlan plan;
+        if (SelectLayout(kernel, IOinfo, &plan) == ppl::common::RC_SUCCESS &&
+            plan.output_formats == refined_plans[node_id].output_formats) {
+            refined_plans[node_id].input_formats = std::move(plan.input_formats);
+        }
+    }
+
+    LayoutCost final_cost;
+    CalcLayoutCost(options, sorted_nodes, refined_plans, &final_cost);
+    LOG(INFO) << "layout planning removed [" << (int64_t)greedy_cost.reorder_count - (int64_t)final_cost.reorder_count
+              << "] reorders: [" << greedy_cost.reorder_count << "] reorders of [" << greedy_cost.reorder_bytes
+              << "] bytes -> [" << final_cost.reorder_count << "] reorders of [" << final_cost.reorder_bytes
+              << "] bytes.";
+
+    *plans = std::move(refined_plans);
+}
+
+static bool InsertReorderOps(const OptKernelOptions& options, const std::vector<nodeid_t>& sorted_nodes,
+                             const std::vector<LayoutPlan>& plans) {
+    auto info = options.info;
+    auto& tensors = *options.tensors;
+
+    for (auto node_id : sorted_nodes) {
+        auto kernel = (X86OptKernel*)info->kernels[node_id].get();
+        auto node = kernel->GetNode();
+        auto& plan = plans[node_id];
+
         for (uint32_t i = 0; i < node->GetInputCount(); i++) {
             auto edge_id = node->GetInput(i);
             if (edge_id == INVALID_EDGEID) {
                 continue;
             }
             auto input_format = tensors[edge_id]->GetShape()->GetDataFormat();
-            auto selected_input_format = selected_input_formats[i];
+            auto selected_input_format = plan.input_formats[i];
             if (input_format != selected_input_format) {
-                status = AddReorderOp(options, edge_id, node_id, REORDER_INPUT, input_format, selected_input_format);
+                auto status = AddReorderOp(options, edge_id, node_id, REORDER_INPUT, input_format, selected_input_format);
                 if (status != ppl::common::RC_SUCCESS) {
                     LOG(ERROR) << "add reorder op failed.";
                     return false;
@@ -253,8 +606,8 @@ bool LayoutOptimize(const OptKernelOptions &options) {
             auto edge_id = node->GetExtraInput(i);
             auto extra_input_format = tensors[edge_id]->GetShape()->GetDataFormat();
             if (extra_input_format != ppl::common::DATAFORMAT_NDARRAY) {
-                status = AddReorderOp(options, edge_id, node_id, REORDER_EXTRA_INPUT, extra_input_format,
-                                      ppl::common::DATAFORMAT_NDARRAY);
+                auto status = AddReorderOp(options, edge_id, node_id, REORDER_EXTRA_INPUT, extra_input_format,
+                                           ppl::common::DATAFORMAT_NDARRAY);
                 if (status != ppl::common::RC_SUCCESS) {
                     LOG(ERROR) << "add reorder op failed.";
                     return false;
@@ -263,13 +616,32 @@ bool LayoutOptimize(const OptKernelOptions &options) {
         }
 
         for (uint32_t i = 0; i < node->GetOutputCount(); i++) {
-            auto edge_id = node->GetOutput(i);
-            auto selected_output_format = selected_output_formats[i];
-            tensors[edge_id]->GetShape()->SetDataFormat(selected_output_format);
-            kernel->SetOutputDataFormat(i, selected_output_format);
+            kernel->SetOutputDataFormat(i, plan.output_formats[i]);
         }
     }
 
+    return true;
+}
+
+bool LayoutOptimize(const OptKernelOptions &options) {
+    auto graph_topo = options.graph_topo;
+
+    std::vector<nodeid_t> sorted_nodes;
+    graph_topo->TopologicalSort([&sorted_nodes](nodeid_t nid) -> void {
+        sorted_nodes.push_back(nid);
+    });
+
+    std::vector<LayoutPlan> plans(graph_topo->GetCurrentNodeIdBound());
+    if (!SelectLayoutGreedily(options, sorted_nodes, &plans)) {
+        return false;
+    }
+
+    RefineLayout(options, sorted_nodes, &plans);
+
+    if (!InsertReorderOps(options, sorted_nodes, plans)) {
+        return false;
+    }
+
     auto status = FuseReorderOp(options);
     if (status != ppl::common::RC_SUCCESS) {
         LOG(ERROR) << "FuseReorderOp failed: " << ppl::common::GetRetCodeStr(status);
@@ -16,9 +16,111 @@
 // under the License.
 
 #include "ppl/nn/engines/x86/optimizer/rules/utils.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/add_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/sub_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/mul_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/div_op.h"
 
 namespace ppl { namespace nn { namespace x86 {
 
+bool IsReLU6(const ir::GraphData* graph_data, const ir::Node* clip_node) {
+    if (clip_node->GetType().domain != "" || clip_node->GetType().name != "Clip") {
+        return false;
+    }
+
+    auto min_edge_id = clip_node->GetInput(1);
+    auto max_edge_id = clip_node->GetInput(2);
+    auto& constants = graph_data->constants;
+    auto min_edge_constant = constants.find(min_edge_id);
+    auto max_edge_constant = constants.find(max_edge_id);
+    if (min_edge_constant == constants.end() || max_edge_constant == constants.end()) {
+        return false;
+    }
+
+    auto& shapes = graph_data->shapes;
+    auto min_edge_shape = shapes.find(min_edge_id);
+    auto max_edge_shape = shapes.find(max_edge_id);
+    if (min_edge_shape == shapes.end() || max_edge_shape == shapes.end()) {
+        return false;
+    }
+    if (min_edge_shape->second.data_type != ppl::common::DATATYPE_FLOAT32 ||
+        max_edge_shape->second.data_type != ppl::common::DATATYPE_FLOAT32) {
+        return false;
+    }
+
+    float min_val = *((float*)min_edge_constant->second.data.GetData());
+    float max_val = *((float*)max_edge_constant->second.data.GetData());
+    if (min_val == 0.0f && max_val == 6.0f) {
+        return true;
+    }
+
+    return false;
+}
+
+ir::Node* GetSingleConsumer(const OptKernelOptions& options, edgeid_t edge_id, const char* type_name) {
+    auto graph_topo = options.graph_topo;
+    auto edge = graph_topo->GetEdge(edge_id);
+    if (edge->CalcConsumerCount() != 1 || IsReservedEdge(*options.tensors, edge_id)) {
+        return nullptr;
+    }
+
+    auto consumer = graph_topo->GetNode(edge->CreateConsumerIter().Get());
+    if (!consumer || consumer->GetType().domain != "" || consumer->GetType().name != type_name) {
+        return nullptr;
+    }
+    return consumer;
+}
+
+edgeid_t GetOtherInput(const ir::Node* node, edgeid_t edge_id) {
+    if (node->GetInputCount() != 2) {
+        return INVALID_EDGEID;
+    }
+    if (node->GetInput(0) == edge_id) {
+        return (node->GetInput(1) == edge_id ? INVALID_EDGEID : node->GetInput(1));
+    }
+    if (node->GetInput(1) == edge_id) {
+        return node->GetInput(0);
+    }
+    return INVALID_EDGEID;
+}
+
+bool GetScalarConstant(const ir::GraphData* graph_data, edgeid_t edge_id, float* value) {
+    auto constant_ref = graph_data->constants.find(edge_id);
+    auto shape_ref = graph_data->shapes.find(edge_id);
+    if (constant_ref == graph_data->constants.end() || shape_ref == graph_data->shapes.end()) {
+        return false;
+    }
+    if (shape_ref->second.data_type != ppl::common::DATATYPE_FLOAT32) {
+        return false;
+    }
+    for (auto dim : shape_ref->second.dims) {
+        if (dim != 1) {
+            return false;
+        }
+    }
+    *value = *((const float*)constant_ref->second.data.GetData());
+    return true;
+}
+
+bool HasFusedReLU(const OptKernelOptions& options, const ir::Node* arithmetic_node) {
+    auto& type = arithmetic_node->GetType();
+    if (type.domain != "") {
+        return false;
+    }
+
+    auto kernel = options.info->kernels[arithmetic_node->GetId()].get();
+    if (type.name == "Add") {
+        return static_cast<AddOp*>(kernel)->HasFuseReLU();
+    } else if (type.name == "Sub") {
+        return static_cast<SubOp*>(kernel)->HasFuseReLU();
+    } else if (type.name == "Mul") {
+        return static_cast<MulOp*>(kernel)->HasFuseReLU();
+    } else if (type.name == "Div") {
+        return static_cast<DivOp*>(kernel)->HasFuseReLU();
+    }
+    return false;
+}
+
 // replace subgraph with one node
 ppl::common::RetCode ReplaceSubgraphWithOneNode(
     const OptKernelOptions& options, std::vector<ir::Node*>& nodes,
@@ -63,6 +63,21 @@ inline bool IsReservedEdge(const std::map<edgeid_t, std::unique_ptr<TensorImpl>>
     return false;
 }
 
+// Clip(0, 6)
+bool IsReLU6(const ir::GraphData* graph_data, const ir::Node* clip_node);
+
+// returns the only consumer of `edge_id` if it is an onnx op named `type_name` and `edge_id` is not reserved
+ir::Node* GetSingleConsumer(const OptKernelOptions& options, edgeid_t edge_id, const char* type_name);
+
+// returns the input of a binary node other than `edge_id`, or INVALID_EDGEID if `edge_id` is not its only input
+edgeid_t GetOtherInput(const ir::Node* node, edgeid_t edge_id);
+
+// fp32 constant with only one element
+bool GetScalarConstant(const ir::GraphData* graph_data, edgeid_t edge_id, float* value);
+
+// Add/Sub/Mul/Div with relu fused by FuseArithmeticReLU
+bool HasFusedReLU(const OptKernelOptions& options, const ir::Node* arithmetic_node);
+
 // replace subgraph with one node
 ppl::common::RetCode ReplaceSubgraphWithOneNode(
     const OptKernelOptions& options, std::vector<ir::Node*>& nodes,
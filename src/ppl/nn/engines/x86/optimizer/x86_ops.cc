@@ -52,6 +52,7 @@ using namespace ppl::common;
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/hard_swish_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/identity_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/if_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/onnx/layer_normalization_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/leaky_relu_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/less_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/onnx/log_op.h"
@@ -111,6 +112,8 @@ using namespace ppl::common;
 #include "ppl/nn/engines/x86/optimizer/ops/pmx/channel_shuffle_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/pmx/shape_operation_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/pmx/swish_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/layer_norm_op.h"
+#include "ppl/nn/engines/x86/optimizer/ops/pmx/gelu_op.h"
 #include "ppl/nn/engines/x86/optimizer/ops/pmx/post_depthwise_conv_op.h"
 
 namespace ppl { namespace nn { namespace x86 {
@@ -185,6 +188,7 @@ void RegisterBuiltinOpImpls() {
     RegisterOptKernelCreator<IdentityOp>("", "Identity", 1, 16);
     RegisterOptKernelCreator<IfOp>("", "If", 1, 12);
     // L
+    RegisterOptKernelCreator<LayerNormalizationOp>("", "LayerNormalization", 17, 17);
     RegisterOptKernelCreator<LeakyReluOp>("", "LeakyRelu", 6, 16);
     RegisterOptKernelCreator<LessOp>("", "Less", 7, 16);
     RegisterOptKernelCreator<LogOp>("", "Log", 6, 16);
@@ -257,6 +261,8 @@ void RegisterBuiltinOpImpls() {
     RegisterOptKernelCreator<ReorderOp>("pmx", "Reorder", 1, 1);
     RegisterOptKernelCreator<ShapeOperationOp>("pmx", "Shape", 1, 1);
     RegisterOptKernelCreator<SwishOp>("pmx", "Swish", 1, 1);
+    RegisterOptKernelCreator<LayerNormOp>("pmx", "LayerNorm", 1, 1);
+    RegisterOptKernelCreator<GeluOp>("pmx", "GELU", 1, 1);
     RegisterOptKernelCreator<PostDepthwiseConvOp>("pmx", "PostDepthwiseConv", 1, 1);
 }
 
@@ -29,6 +29,8 @@ struct GemmParam {
     int32_t trans_b;
     ppl::kernel::x86::gemm_post_t post;
     float *packed_b = nullptr;
+    bool fuse_gelu = false; // applied to output after `post`
+    bool gelu_approximate = false;
 };
 
 }}}; // namespace ppl::nn::x86
@@ -19,11 +19,15 @@
 #define _ST_HPC_PPL_NN_ENGINES_X86_PARAMS_MATMUL_PARAM_H_
 
 #include "ppl/kernel/x86/fp32/matmul.h"
+#include "ppl/kernel/x86/fp32/gemm.h"
 
 namespace ppl { namespace nn { namespace x86 {
 
 struct MatMulParam {
     float *packed_b = nullptr;
+    ppl::kernel::x86::gemm_post_t post = ppl::kernel::x86::gemm_post::NONE;
+    bool fuse_gelu = false; // applied to output after `post`
+    bool gelu_approximate = false;
 };
 
 }}}; // namespace ppl::nn::x86
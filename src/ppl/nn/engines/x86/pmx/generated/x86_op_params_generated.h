@@ -0,0 +1,2696 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_X86OPPARAMS_PPL_NN_PMX_X86_H_
+#define FLATBUFFERS_GENERATED_X86OPPARAMS_PPL_NN_PMX_X86_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 2 &&
+              FLATBUFFERS_VERSION_MINOR == 0 &&
+              FLATBUFFERS_VERSION_REVISION == 8,
+             "Non-compatible flatbuffers version included");
+
+namespace ppl {
+namespace nn {
+namespace pmx {
+namespace x86 {
+
+struct OutputData;
+struct OutputDataBuilder;
+
+struct FusionData;
+struct FusionDataBuilder;
+
+struct ConvAlgoInfo;
+struct ConvAlgoInfoBuilder;
+
+struct ConvParamInfo;
+struct ConvParamInfoBuilder;
+
+struct ConvData;
+struct ConvDataBuilder;
+
+struct GemmData;
+struct GemmDataBuilder;
+
+struct MatMulData;
+struct MatMulDataBuilder;
+
+struct RNNData;
+struct RNNDataBuilder;
+
+struct GRUParam;
+struct GRUParamBuilder;
+
+struct ConstantOfShapeParam;
+struct ConstantOfShapeParamBuilder;
+
+struct EinSumParam;
+struct EinSumParamBuilder;
+
+struct HardSigmoidParam;
+struct HardSigmoidParamBuilder;
+
+struct LayerNormalizationParam;
+struct LayerNormalizationParamBuilder;
+
+struct OneHotParam;
+struct OneHotParamBuilder;
+
+struct RandomUniformParam;
+struct RandomUniformParamBuilder;
+
+struct ReshapeParam;
+struct ReshapeParamBuilder;
+
+struct MMCVGridSampleParam;
+struct MMCVGridSampleParamBuilder;
+
+struct MMCVModulatedDeformConv2dParam;
+struct MMCVModulatedDeformConv2dParamBuilder;
+
+struct MMCVNMSParam;
+struct MMCVNMSParamBuilder;
+
+struct MMCVRoiAlignParam;
+struct MMCVRoiAlignParamBuilder;
+
+struct ChannelShuffleParam;
+struct ChannelShuffleParamBuilder;
+
+struct GELUParam;
+struct GELUParamBuilder;
+
+struct LayerNormParam;
+struct LayerNormParamBuilder;
+
+struct ShapeMatrix;
+struct ShapeMatrixBuilder;
+
+struct ShapeOperationParam;
+struct ShapeOperationParamBuilder;
+
+struct ParamData;
+struct ParamDataBuilder;
+
+struct OpData;
+struct OpDataBuilder;
+
+enum ParamType : uint8_t {
+  ParamType_NONE = 0,
+  ParamType_GRUParam = 1,
+  ParamType_ConstantOfShapeParam = 2,
+  ParamType_EinSumParam = 3,
+  ParamType_HardSigmoidParam = 4,
+  ParamType_LayerNormalizationParam = 5,
+  ParamType_OneHotParam = 6,
+  ParamType_RandomUniformParam = 7,
+  ParamType_ReshapeParam = 8,
+  ParamType_MMCVGridSampleParam = 9,
+  ParamType_MMCVModulatedDeformConv2dParam = 10,
+  ParamType_MMCVNMSParam = 11,
+  ParamType_MMCVRoiAlignParam = 12,
+  ParamType_ChannelShuffleParam = 13,
+  ParamType_GELUParam = 14,
+  ParamType_LayerNormParam = 15,
+  ParamType_ShapeOperationParam = 16,
+  ParamType_MIN = ParamType_NONE,
+  ParamType_MAX = ParamType_ShapeOperationParam
+};
+
+inline const ParamType (&EnumValuesParamType())[17] {
+  static const ParamType values[] = {
+    ParamType_NONE,
+    ParamType_GRUParam,
+    ParamType_ConstantOfShapeParam,
+    ParamType_EinSumParam,
+    ParamType_HardSigmoidParam,
+    ParamType_LayerNormalizationParam,
+    ParamType_OneHotParam,
+    ParamType_RandomUniformParam,
+    ParamType_ReshapeParam,
+    ParamType_MMCVGridSampleParam,
+    ParamType_MMCVModulatedDeformConv2dParam,
+    ParamType_MMCVNMSParam,
+    ParamType_MMCVRoiAlignParam,
+    ParamType_ChannelShuffleParam,
+    ParamType_GELUParam,
+    ParamType_LayerNormParam,
+    ParamType_ShapeOperationParam
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesParamType() {
+  static const char * const names[18] = {
+    "NONE",
+    "GRUParam",
+    "ConstantOfShapeParam",
+    "EinSumParam",
+    "HardSigmoidParam",
+    "LayerNormalizationParam",
+    "OneHotParam",
+    "RandomUniformParam",
+    "ReshapeParam",
+    "MMCVGridSampleParam",
+    "MMCVModulatedDeformConv2dParam",
+    "MMCVNMSParam",
+    "MMCVRoiAlignParam",
+    "ChannelShuffleParam",
+    "GELUParam",
+    "LayerNormParam",
+    "ShapeOperationParam",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameParamType(ParamType e) {
+  if (flatbuffers::IsOutRange(e, ParamType_NONE, ParamType_ShapeOperationParam)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesParamType()[index];
+}
+
+template<typename T> struct ParamTypeTraits {
+  static const ParamType enum_value = ParamType_NONE;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::GRUParam> {
+  static const ParamType enum_value = ParamType_GRUParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::ConstantOfShapeParam> {
+  static const ParamType enum_value = ParamType_ConstantOfShapeParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::EinSumParam> {
+  static const ParamType enum_value = ParamType_EinSumParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::HardSigmoidParam> {
+  static const ParamType enum_value = ParamType_HardSigmoidParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::LayerNormalizationParam> {
+  static const ParamType enum_value = ParamType_LayerNormalizationParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::OneHotParam> {
+  static const ParamType enum_value = ParamType_OneHotParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::RandomUniformParam> {
+  static const ParamType enum_value = ParamType_RandomUniformParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::ReshapeParam> {
+  static const ParamType enum_value = ParamType_ReshapeParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::MMCVGridSampleParam> {
+  static const ParamType enum_value = ParamType_MMCVGridSampleParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam> {
+  static const ParamType enum_value = ParamType_MMCVModulatedDeformConv2dParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::MMCVNMSParam> {
+  static const ParamType enum_value = ParamType_MMCVNMSParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::MMCVRoiAlignParam> {
+  static const ParamType enum_value = ParamType_MMCVRoiAlignParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::ChannelShuffleParam> {
+  static const ParamType enum_value = ParamType_ChannelShuffleParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::GELUParam> {
+  static const ParamType enum_value = ParamType_GELUParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::LayerNormParam> {
+  static const ParamType enum_value = ParamType_LayerNormParam;
+};
+
+template<> struct ParamTypeTraits<ppl::nn::pmx::x86::ShapeOperationParam> {
+  static const ParamType enum_value = ParamType_ShapeOperationParam;
+};
+
+bool VerifyParamType(flatbuffers::Verifier &verifier, const void *obj, ParamType type);
+bool VerifyParamTypeVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+
+enum PrivateDataType : uint8_t {
+  PrivateDataType_NONE = 0,
+  PrivateDataType_OutputData = 1,
+  PrivateDataType_FusionData = 2,
+  PrivateDataType_ConvData = 3,
+  PrivateDataType_GemmData = 4,
+  PrivateDataType_MatMulData = 5,
+  PrivateDataType_RNNData = 6,
+  PrivateDataType_ParamData = 7,
+  PrivateDataType_MIN = PrivateDataType_NONE,
+  PrivateDataType_MAX = PrivateDataType_ParamData
+};
+
+inline const PrivateDataType (&EnumValuesPrivateDataType())[8] {
+  static const PrivateDataType values[] = {
+    PrivateDataType_NONE,
+    PrivateDataType_OutputData,
+    PrivateDataType_FusionData,
+    PrivateDataType_ConvData,
+    PrivateDataType_GemmData,
+    PrivateDataType_MatMulData,
+    PrivateDataType_RNNData,
+    PrivateDataType_ParamData
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesPrivateDataType() {
+  static const char * const names[9] = {
+    "NONE",
+    "OutputData",
+    "FusionData",
+    "ConvData",
+    "GemmData",
+    "MatMulData",
+    "RNNData",
+    "ParamData",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNamePrivateDataType(PrivateDataType e) {
+  if (flatbuffers::IsOutRange(e, PrivateDataType_NONE, PrivateDataType_ParamData)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesPrivateDataType()[index];
+}
+
+template<typename T> struct PrivateDataTypeTraits {
+  static const PrivateDataType enum_value = PrivateDataType_NONE;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::OutputData> {
+  static const PrivateDataType enum_value = PrivateDataType_OutputData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::FusionData> {
+  static const PrivateDataType enum_value = PrivateDataType_FusionData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::ConvData> {
+  static const PrivateDataType enum_value = PrivateDataType_ConvData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::GemmData> {
+  static const PrivateDataType enum_value = PrivateDataType_GemmData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::MatMulData> {
+  static const PrivateDataType enum_value = PrivateDataType_MatMulData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::RNNData> {
+  static const PrivateDataType enum_value = PrivateDataType_RNNData;
+};
+
+template<> struct PrivateDataTypeTraits<ppl::nn::pmx::x86::ParamData> {
+  static const PrivateDataType enum_value = PrivateDataType_ParamData;
+};
+
+bool VerifyPrivateDataType(flatbuffers::Verifier &verifier, const void *obj, PrivateDataType type);
+bool VerifyPrivateDataTypeVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+
+struct OutputData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef OutputDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DFORMAT = 4
+  };
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           verifier.EndTable();
+  }
+};
+
+struct OutputDataBuilder {
+  typedef OutputData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(OutputData::VT_DFORMAT, dformat);
+  }
+  explicit OutputDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<OutputData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<OutputData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<OutputData> CreateOutputData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0) {
+  OutputDataBuilder builder_(_fbb);
+  builder_.add_dformat(dformat);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<OutputData> CreateOutputDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint32_t> *dformat = nullptr) {
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateOutputData(
+      _fbb,
+      dformat__);
+}
+
+struct FusionData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef FusionDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FUSE_RELU = 4,
+    VT_DFORMAT = 6
+  };
+  int8_t fuse_relu() const {
+    return GetField<int8_t>(VT_FUSE_RELU, 0);
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_FUSE_RELU, 1) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           verifier.EndTable();
+  }
+};
+
+struct FusionDataBuilder {
+  typedef FusionData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_fuse_relu(int8_t fuse_relu) {
+    fbb_.AddElement<int8_t>(FusionData::VT_FUSE_RELU, fuse_relu, 0);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(FusionData::VT_DFORMAT, dformat);
+  }
+  explicit FusionDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<FusionData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<FusionData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<FusionData> CreateFusionData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int8_t fuse_relu = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0) {
+  FusionDataBuilder builder_(_fbb);
+  builder_.add_dformat(dformat);
+  builder_.add_fuse_relu(fuse_relu);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<FusionData> CreateFusionDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int8_t fuse_relu = 0,
+    const std::vector<uint32_t> *dformat = nullptr) {
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateFusionData(
+      _fbb,
+      fuse_relu,
+      dformat__);
+}
+
+struct ConvAlgoInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ConvAlgoInfoBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALGO_TYPE = 4,
+    VT_ISA = 6,
+    VT_INPUT_FORMAT = 8,
+    VT_OUTPUT_FORMAT = 10,
+    VT_TUNED_DIMS = 12
+  };
+  uint32_t algo_type() const {
+    return GetField<uint32_t>(VT_ALGO_TYPE, 0);
+  }
+  uint32_t isa() const {
+    return GetField<uint32_t>(VT_ISA, 0);
+  }
+  uint32_t input_format() const {
+    return GetField<uint32_t>(VT_INPUT_FORMAT, 0);
+  }
+  uint32_t output_format() const {
+    return GetField<uint32_t>(VT_OUTPUT_FORMAT, 0);
+  }
+  const flatbuffers::Vector<int64_t> *tuned_dims() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_TUNED_DIMS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_ALGO_TYPE, 4) &&
+           VerifyField<uint32_t>(verifier, VT_ISA, 4) &&
+           VerifyField<uint32_t>(verifier, VT_INPUT_FORMAT, 4) &&
+           VerifyField<uint32_t>(verifier, VT_OUTPUT_FORMAT, 4) &&
+           VerifyOffset(verifier, VT_TUNED_DIMS) &&
+           verifier.VerifyVector(tuned_dims()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ConvAlgoInfoBuilder {
+  typedef ConvAlgoInfo Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_algo_type(uint32_t algo_type) {
+    fbb_.AddElement<uint32_t>(ConvAlgoInfo::VT_ALGO_TYPE, algo_type, 0);
+  }
+  void add_isa(uint32_t isa) {
+    fbb_.AddElement<uint32_t>(ConvAlgoInfo::VT_ISA, isa, 0);
+  }
+  void add_input_format(uint32_t input_format) {
+    fbb_.AddElement<uint32_t>(ConvAlgoInfo::VT_INPUT_FORMAT, input_format, 0);
+  }
+  void add_output_format(uint32_t output_format) {
+    fbb_.AddElement<uint32_t>(ConvAlgoInfo::VT_OUTPUT_FORMAT, output_format, 0);
+  }
+  void add_tuned_dims(flatbuffers::Offset<flatbuffers::Vector<int64_t>> tuned_dims) {
+    fbb_.AddOffset(ConvAlgoInfo::VT_TUNED_DIMS, tuned_dims);
+  }
+  explicit ConvAlgoInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ConvAlgoInfo> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ConvAlgoInfo>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ConvAlgoInfo> CreateConvAlgoInfo(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t algo_type = 0,
+    uint32_t isa = 0,
+    uint32_t input_format = 0,
+    uint32_t output_format = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> tuned_dims = 0) {
+  ConvAlgoInfoBuilder builder_(_fbb);
+  builder_.add_tuned_dims(tuned_dims);
+  builder_.add_output_format(output_format);
+  builder_.add_input_format(input_format);
+  builder_.add_isa(isa);
+  builder_.add_algo_type(algo_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ConvAlgoInfo> CreateConvAlgoInfoDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t algo_type = 0,
+    uint32_t isa = 0,
+    uint32_t input_format = 0,
+    uint32_t output_format = 0,
+    const std::vector<int64_t> *tuned_dims = nullptr) {
+  auto tuned_dims__ = tuned_dims ? _fbb.CreateVector<int64_t>(*tuned_dims) : 0;
+  return ppl::nn::pmx::x86::CreateConvAlgoInfo(
+      _fbb,
+      algo_type,
+      isa,
+      input_format,
+      output_format,
+      tuned_dims__);
+}
+
+struct ConvParamInfo FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ConvParamInfoBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NUM_OUTPUT = 4,
+    VT_CHANNELS = 6,
+    VT_FUSE_FLAG = 8,
+    VT_BIAS_TERM = 10
+  };
+  int64_t num_output() const {
+    return GetField<int64_t>(VT_NUM_OUTPUT, 0);
+  }
+  int64_t channels() const {
+    return GetField<int64_t>(VT_CHANNELS, 0);
+  }
+  uint32_t fuse_flag() const {
+    return GetField<uint32_t>(VT_FUSE_FLAG, 0);
+  }
+  int8_t bias_term() const {
+    return GetField<int8_t>(VT_BIAS_TERM, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int64_t>(verifier, VT_NUM_OUTPUT, 8) &&
+           VerifyField<int64_t>(verifier, VT_CHANNELS, 8) &&
+           VerifyField<uint32_t>(verifier, VT_FUSE_FLAG, 4) &&
+           VerifyField<int8_t>(verifier, VT_BIAS_TERM, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct ConvParamInfoBuilder {
+  typedef ConvParamInfo Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_num_output(int64_t num_output) {
+    fbb_.AddElement<int64_t>(ConvParamInfo::VT_NUM_OUTPUT, num_output, 0);
+  }
+  void add_channels(int64_t channels) {
+    fbb_.AddElement<int64_t>(ConvParamInfo::VT_CHANNELS, channels, 0);
+  }
+  void add_fuse_flag(uint32_t fuse_flag) {
+    fbb_.AddElement<uint32_t>(ConvParamInfo::VT_FUSE_FLAG, fuse_flag, 0);
+  }
+  void add_bias_term(int8_t bias_term) {
+    fbb_.AddElement<int8_t>(ConvParamInfo::VT_BIAS_TERM, bias_term, 0);
+  }
+  explicit ConvParamInfoBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ConvParamInfo> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ConvParamInfo>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ConvParamInfo> CreateConvParamInfo(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t num_output = 0,
+    int64_t channels = 0,
+    uint32_t fuse_flag = 0,
+    int8_t bias_term = 0) {
+  ConvParamInfoBuilder builder_(_fbb);
+  builder_.add_channels(channels);
+  builder_.add_num_output(num_output);
+  builder_.add_fuse_flag(fuse_flag);
+  builder_.add_bias_term(bias_term);
+  return builder_.Finish();
+}
+
+struct ConvData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ConvDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALGO_INFO = 4,
+    VT_PARAM_INFO = 6,
+    VT_DFORMAT = 8,
+    VT_CVT_FILTER = 10,
+    VT_CVT_BIAS = 12,
+    VT_FALLBACK_CVT_FILTER = 14,
+    VT_FALLBACK_CVT_BIAS = 16
+  };
+  const ppl::nn::pmx::x86::ConvAlgoInfo *algo_info() const {
+    return GetPointer<const ppl::nn::pmx::x86::ConvAlgoInfo *>(VT_ALGO_INFO);
+  }
+  const ppl::nn::pmx::x86::ConvParamInfo *param_info() const {
+    return GetPointer<const ppl::nn::pmx::x86::ConvParamInfo *>(VT_PARAM_INFO);
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  const flatbuffers::Vector<float> *cvt_filter() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_CVT_FILTER);
+  }
+  const flatbuffers::Vector<float> *cvt_bias() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_CVT_BIAS);
+  }
+  const flatbuffers::Vector<float> *fallback_cvt_filter() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_FALLBACK_CVT_FILTER);
+  }
+  const flatbuffers::Vector<float> *fallback_cvt_bias() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_FALLBACK_CVT_BIAS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ALGO_INFO) &&
+           verifier.VerifyTable(algo_info()) &&
+           VerifyOffset(verifier, VT_PARAM_INFO) &&
+           verifier.VerifyTable(param_info()) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           VerifyOffset(verifier, VT_CVT_FILTER) &&
+           verifier.VerifyVector(cvt_filter()) &&
+           VerifyOffset(verifier, VT_CVT_BIAS) &&
+           verifier.VerifyVector(cvt_bias()) &&
+           VerifyOffset(verifier, VT_FALLBACK_CVT_FILTER) &&
+           verifier.VerifyVector(fallback_cvt_filter()) &&
+           VerifyOffset(verifier, VT_FALLBACK_CVT_BIAS) &&
+           verifier.VerifyVector(fallback_cvt_bias()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ConvDataBuilder {
+  typedef ConvData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_algo_info(flatbuffers::Offset<ppl::nn::pmx::x86::ConvAlgoInfo> algo_info) {
+    fbb_.AddOffset(ConvData::VT_ALGO_INFO, algo_info);
+  }
+  void add_param_info(flatbuffers::Offset<ppl::nn::pmx::x86::ConvParamInfo> param_info) {
+    fbb_.AddOffset(ConvData::VT_PARAM_INFO, param_info);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(ConvData::VT_DFORMAT, dformat);
+  }
+  void add_cvt_filter(flatbuffers::Offset<flatbuffers::Vector<float>> cvt_filter) {
+    fbb_.AddOffset(ConvData::VT_CVT_FILTER, cvt_filter);
+  }
+  void add_cvt_bias(flatbuffers::Offset<flatbuffers::Vector<float>> cvt_bias) {
+    fbb_.AddOffset(ConvData::VT_CVT_BIAS, cvt_bias);
+  }
+  void add_fallback_cvt_filter(flatbuffers::Offset<flatbuffers::Vector<float>> fallback_cvt_filter) {
+    fbb_.AddOffset(ConvData::VT_FALLBACK_CVT_FILTER, fallback_cvt_filter);
+  }
+  void add_fallback_cvt_bias(flatbuffers::Offset<flatbuffers::Vector<float>> fallback_cvt_bias) {
+    fbb_.AddOffset(ConvData::VT_FALLBACK_CVT_BIAS, fallback_cvt_bias);
+  }
+  explicit ConvDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ConvData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ConvData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ConvData> CreateConvData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<ppl::nn::pmx::x86::ConvAlgoInfo> algo_info = 0,
+    flatbuffers::Offset<ppl::nn::pmx::x86::ConvParamInfo> param_info = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> cvt_filter = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> cvt_bias = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> fallback_cvt_filter = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> fallback_cvt_bias = 0) {
+  ConvDataBuilder builder_(_fbb);
+  builder_.add_fallback_cvt_bias(fallback_cvt_bias);
+  builder_.add_fallback_cvt_filter(fallback_cvt_filter);
+  builder_.add_cvt_bias(cvt_bias);
+  builder_.add_cvt_filter(cvt_filter);
+  builder_.add_dformat(dformat);
+  builder_.add_param_info(param_info);
+  builder_.add_algo_info(algo_info);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ConvData> CreateConvDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<ppl::nn::pmx::x86::ConvAlgoInfo> algo_info = 0,
+    flatbuffers::Offset<ppl::nn::pmx::x86::ConvParamInfo> param_info = 0,
+    const std::vector<uint32_t> *dformat = nullptr,
+    const std::vector<float> *cvt_filter = nullptr,
+    const std::vector<float> *cvt_bias = nullptr,
+    const std::vector<float> *fallback_cvt_filter = nullptr,
+    const std::vector<float> *fallback_cvt_bias = nullptr) {
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  auto cvt_filter__ = cvt_filter ? _fbb.CreateVector<float>(*cvt_filter) : 0;
+  auto cvt_bias__ = cvt_bias ? _fbb.CreateVector<float>(*cvt_bias) : 0;
+  auto fallback_cvt_filter__ = fallback_cvt_filter ? _fbb.CreateVector<float>(*fallback_cvt_filter) : 0;
+  auto fallback_cvt_bias__ = fallback_cvt_bias ? _fbb.CreateVector<float>(*fallback_cvt_bias) : 0;
+  return ppl::nn::pmx::x86::CreateConvData(
+      _fbb,
+      algo_info,
+      param_info,
+      dformat__,
+      cvt_filter__,
+      cvt_bias__,
+      fallback_cvt_filter__,
+      fallback_cvt_bias__);
+}
+
+struct GemmData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef GemmDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POST = 4,
+    VT_ISA = 6,
+    VT_PACKED_B = 8,
+    VT_DFORMAT = 10,
+    VT_GELU = 12
+  };
+  uint32_t post() const {
+    return GetField<uint32_t>(VT_POST, 0);
+  }
+  uint32_t isa() const {
+    return GetField<uint32_t>(VT_ISA, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *packed_b() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PACKED_B);
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  uint32_t gelu() const {
+    return GetField<uint32_t>(VT_GELU, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_POST, 4) &&
+           VerifyField<uint32_t>(verifier, VT_ISA, 4) &&
+           VerifyOffset(verifier, VT_PACKED_B) &&
+           verifier.VerifyVector(packed_b()) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           VerifyField<uint32_t>(verifier, VT_GELU, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct GemmDataBuilder {
+  typedef GemmData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_post(uint32_t post) {
+    fbb_.AddElement<uint32_t>(GemmData::VT_POST, post, 0);
+  }
+  void add_isa(uint32_t isa) {
+    fbb_.AddElement<uint32_t>(GemmData::VT_ISA, isa, 0);
+  }
+  void add_packed_b(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed_b) {
+    fbb_.AddOffset(GemmData::VT_PACKED_B, packed_b);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(GemmData::VT_DFORMAT, dformat);
+  }
+  void add_gelu(uint32_t gelu) {
+    fbb_.AddElement<uint32_t>(GemmData::VT_GELU, gelu, 0);
+  }
+  explicit GemmDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<GemmData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<GemmData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<GemmData> CreateGemmData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t post = 0,
+    uint32_t isa = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed_b = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0,
+    uint32_t gelu = 0) {
+  GemmDataBuilder builder_(_fbb);
+  builder_.add_gelu(gelu);
+  builder_.add_dformat(dformat);
+  builder_.add_packed_b(packed_b);
+  builder_.add_isa(isa);
+  builder_.add_post(post);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<GemmData> CreateGemmDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t post = 0,
+    uint32_t isa = 0,
+    const std::vector<uint8_t> *packed_b = nullptr,
+    const std::vector<uint32_t> *dformat = nullptr,
+    uint32_t gelu = 0) {
+  auto packed_b__ = packed_b ? _fbb.CreateVector<uint8_t>(*packed_b) : 0;
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateGemmData(
+      _fbb,
+      post,
+      isa,
+      packed_b__,
+      dformat__,
+      gelu);
+}
+
+struct MatMulData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef MatMulDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POST = 4,
+    VT_ISA = 6,
+    VT_PACKED_B = 8,
+    VT_DFORMAT = 10,
+    VT_GELU = 12
+  };
+  uint32_t post() const {
+    return GetField<uint32_t>(VT_POST, 0);
+  }
+  uint32_t isa() const {
+    return GetField<uint32_t>(VT_ISA, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *packed_b() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PACKED_B);
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  uint32_t gelu() const {
+    return GetField<uint32_t>(VT_GELU, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_POST, 4) &&
+           VerifyField<uint32_t>(verifier, VT_ISA, 4) &&
+           VerifyOffset(verifier, VT_PACKED_B) &&
+           verifier.VerifyVector(packed_b()) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           VerifyField<uint32_t>(verifier, VT_GELU, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct MatMulDataBuilder {
+  typedef MatMulData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_post(uint32_t post) {
+    fbb_.AddElement<uint32_t>(MatMulData::VT_POST, post, 0);
+  }
+  void add_isa(uint32_t isa) {
+    fbb_.AddElement<uint32_t>(MatMulData::VT_ISA, isa, 0);
+  }
+  void add_packed_b(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed_b) {
+    fbb_.AddOffset(MatMulData::VT_PACKED_B, packed_b);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(MatMulData::VT_DFORMAT, dformat);
+  }
+  void add_gelu(uint32_t gelu) {
+    fbb_.AddElement<uint32_t>(MatMulData::VT_GELU, gelu, 0);
+  }
+  explicit MatMulDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<MatMulData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<MatMulData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<MatMulData> CreateMatMulData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t post = 0,
+    uint32_t isa = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed_b = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0,
+    uint32_t gelu = 0) {
+  MatMulDataBuilder builder_(_fbb);
+  builder_.add_gelu(gelu);
+  builder_.add_dformat(dformat);
+  builder_.add_packed_b(packed_b);
+  builder_.add_isa(isa);
+  builder_.add_post(post);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<MatMulData> CreateMatMulDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t post = 0,
+    uint32_t isa = 0,
+    const std::vector<uint8_t> *packed_b = nullptr,
+    const std::vector<uint32_t> *dformat = nullptr,
+    uint32_t gelu = 0) {
+  auto packed_b__ = packed_b ? _fbb.CreateVector<uint8_t>(*packed_b) : 0;
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateMatMulData(
+      _fbb,
+      post,
+      isa,
+      packed_b__,
+      dformat__,
+      gelu);
+}
+
+struct RNNData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef RNNDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ISA = 4,
+    VT_PACKED_BYTES = 6,
+    VT_PACKED = 8,
+    VT_DFORMAT = 10
+  };
+  uint32_t isa() const {
+    return GetField<uint32_t>(VT_ISA, 0);
+  }
+  const flatbuffers::Vector<uint64_t> *packed_bytes() const {
+    return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_PACKED_BYTES);
+  }
+  const flatbuffers::Vector<uint8_t> *packed() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PACKED);
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_ISA, 4) &&
+           VerifyOffset(verifier, VT_PACKED_BYTES) &&
+           verifier.VerifyVector(packed_bytes()) &&
+           VerifyOffset(verifier, VT_PACKED) &&
+           verifier.VerifyVector(packed()) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           verifier.EndTable();
+  }
+};
+
+struct RNNDataBuilder {
+  typedef RNNData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_isa(uint32_t isa) {
+    fbb_.AddElement<uint32_t>(RNNData::VT_ISA, isa, 0);
+  }
+  void add_packed_bytes(flatbuffers::Offset<flatbuffers::Vector<uint64_t>> packed_bytes) {
+    fbb_.AddOffset(RNNData::VT_PACKED_BYTES, packed_bytes);
+  }
+  void add_packed(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed) {
+    fbb_.AddOffset(RNNData::VT_PACKED, packed);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(RNNData::VT_DFORMAT, dformat);
+  }
+  explicit RNNDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<RNNData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<RNNData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<RNNData> CreateRNNData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t isa = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> packed_bytes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0) {
+  RNNDataBuilder builder_(_fbb);
+  builder_.add_dformat(dformat);
+  builder_.add_packed(packed);
+  builder_.add_packed_bytes(packed_bytes);
+  builder_.add_isa(isa);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<RNNData> CreateRNNDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t isa = 0,
+    const std::vector<uint64_t> *packed_bytes = nullptr,
+    const std::vector<uint8_t> *packed = nullptr,
+    const std::vector<uint32_t> *dformat = nullptr) {
+  auto packed_bytes__ = packed_bytes ? _fbb.CreateVector<uint64_t>(*packed_bytes) : 0;
+  auto packed__ = packed ? _fbb.CreateVector<uint8_t>(*packed) : 0;
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateRNNData(
+      _fbb,
+      isa,
+      packed_bytes__,
+      packed__,
+      dformat__);
+}
+
+struct GRUParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef GRUParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ACTIVATION_ALPHA = 4,
+    VT_ACTIVATION_BETA = 6,
+    VT_ACTIVATIONS = 8,
+    VT_CLIP = 10,
+    VT_DIRECTION = 12,
+    VT_HIDDEN_SIZE = 14,
+    VT_LINEAR_BEFORE_RESET = 16
+  };
+  const flatbuffers::Vector<float> *activation_alpha() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_ACTIVATION_ALPHA);
+  }
+  const flatbuffers::Vector<float> *activation_beta() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_ACTIVATION_BETA);
+  }
+  const flatbuffers::Vector<int32_t> *activations() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_ACTIVATIONS);
+  }
+  float clip() const {
+    return GetField<float>(VT_CLIP, 0.0f);
+  }
+  int32_t direction() const {
+    return GetField<int32_t>(VT_DIRECTION, 0);
+  }
+  int32_t hidden_size() const {
+    return GetField<int32_t>(VT_HIDDEN_SIZE, 0);
+  }
+  int32_t linear_before_reset() const {
+    return GetField<int32_t>(VT_LINEAR_BEFORE_RESET, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ACTIVATION_ALPHA) &&
+           verifier.VerifyVector(activation_alpha()) &&
+           VerifyOffset(verifier, VT_ACTIVATION_BETA) &&
+           verifier.VerifyVector(activation_beta()) &&
+           VerifyOffset(verifier, VT_ACTIVATIONS) &&
+           verifier.VerifyVector(activations()) &&
+           VerifyField<float>(verifier, VT_CLIP, 4) &&
+           VerifyField<int32_t>(verifier, VT_DIRECTION, 4) &&
+           VerifyField<int32_t>(verifier, VT_HIDDEN_SIZE, 4) &&
+           VerifyField<int32_t>(verifier, VT_LINEAR_BEFORE_RESET, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct GRUParamBuilder {
+  typedef GRUParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_activation_alpha(flatbuffers::Offset<flatbuffers::Vector<float>> activation_alpha) {
+    fbb_.AddOffset(GRUParam::VT_ACTIVATION_ALPHA, activation_alpha);
+  }
+  void add_activation_beta(flatbuffers::Offset<flatbuffers::Vector<float>> activation_beta) {
+    fbb_.AddOffset(GRUParam::VT_ACTIVATION_BETA, activation_beta);
+  }
+  void add_activations(flatbuffers::Offset<flatbuffers::Vector<int32_t>> activations) {
+    fbb_.AddOffset(GRUParam::VT_ACTIVATIONS, activations);
+  }
+  void add_clip(float clip) {
+    fbb_.AddElement<float>(GRUParam::VT_CLIP, clip, 0.0f);
+  }
+  void add_direction(int32_t direction) {
+    fbb_.AddElement<int32_t>(GRUParam::VT_DIRECTION, direction, 0);
+  }
+  void add_hidden_size(int32_t hidden_size) {
+    fbb_.AddElement<int32_t>(GRUParam::VT_HIDDEN_SIZE, hidden_size, 0);
+  }
+  void add_linear_before_reset(int32_t linear_before_reset) {
+    fbb_.AddElement<int32_t>(GRUParam::VT_LINEAR_BEFORE_RESET, linear_before_reset, 0);
+  }
+  explicit GRUParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<GRUParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<GRUParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<GRUParam> CreateGRUParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<float>> activation_alpha = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> activation_beta = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> activations = 0,
+    float clip = 0.0f,
+    int32_t direction = 0,
+    int32_t hidden_size = 0,
+    int32_t linear_before_reset = 0) {
+  GRUParamBuilder builder_(_fbb);
+  builder_.add_linear_before_reset(linear_before_reset);
+  builder_.add_hidden_size(hidden_size);
+  builder_.add_direction(direction);
+  builder_.add_clip(clip);
+  builder_.add_activations(activations);
+  builder_.add_activation_beta(activation_beta);
+  builder_.add_activation_alpha(activation_alpha);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<GRUParam> CreateGRUParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<float> *activation_alpha = nullptr,
+    const std::vector<float> *activation_beta = nullptr,
+    const std::vector<int32_t> *activations = nullptr,
+    float clip = 0.0f,
+    int32_t direction = 0,
+    int32_t hidden_size = 0,
+    int32_t linear_before_reset = 0) {
+  auto activation_alpha__ = activation_alpha ? _fbb.CreateVector<float>(*activation_alpha) : 0;
+  auto activation_beta__ = activation_beta ? _fbb.CreateVector<float>(*activation_beta) : 0;
+  auto activations__ = activations ? _fbb.CreateVector<int32_t>(*activations) : 0;
+  return ppl::nn::pmx::x86::CreateGRUParam(
+      _fbb,
+      activation_alpha__,
+      activation_beta__,
+      activations__,
+      clip,
+      direction,
+      hidden_size,
+      linear_before_reset);
+}
+
+struct ConstantOfShapeParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ConstantOfShapeParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DATA_TYPE = 4,
+    VT_DIMS = 6,
+    VT_DATA = 8
+  };
+  uint32_t data_type() const {
+    return GetField<uint32_t>(VT_DATA_TYPE, 0);
+  }
+  const flatbuffers::Vector<int64_t> *dims() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_DIMS);
+  }
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_DATA_TYPE, 4) &&
+           VerifyOffset(verifier, VT_DIMS) &&
+           verifier.VerifyVector(dims()) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ConstantOfShapeParamBuilder {
+  typedef ConstantOfShapeParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_data_type(uint32_t data_type) {
+    fbb_.AddElement<uint32_t>(ConstantOfShapeParam::VT_DATA_TYPE, data_type, 0);
+  }
+  void add_dims(flatbuffers::Offset<flatbuffers::Vector<int64_t>> dims) {
+    fbb_.AddOffset(ConstantOfShapeParam::VT_DIMS, dims);
+  }
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(ConstantOfShapeParam::VT_DATA, data);
+  }
+  explicit ConstantOfShapeParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ConstantOfShapeParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ConstantOfShapeParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ConstantOfShapeParam> CreateConstantOfShapeParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t data_type = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> dims = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  ConstantOfShapeParamBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_dims(dims);
+  builder_.add_data_type(data_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ConstantOfShapeParam> CreateConstantOfShapeParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t data_type = 0,
+    const std::vector<int64_t> *dims = nullptr,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto dims__ = dims ? _fbb.CreateVector<int64_t>(*dims) : 0;
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return ppl::nn::pmx::x86::CreateConstantOfShapeParam(
+      _fbb,
+      data_type,
+      dims__,
+      data__);
+}
+
+struct EinSumParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EinSumParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_EQUATION = 4
+  };
+  const flatbuffers::String *equation() const {
+    return GetPointer<const flatbuffers::String *>(VT_EQUATION);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_EQUATION) &&
+           verifier.VerifyString(equation()) &&
+           verifier.EndTable();
+  }
+};
+
+struct EinSumParamBuilder {
+  typedef EinSumParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_equation(flatbuffers::Offset<flatbuffers::String> equation) {
+    fbb_.AddOffset(EinSumParam::VT_EQUATION, equation);
+  }
+  explicit EinSumParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<EinSumParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<EinSumParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<EinSumParam> CreateEinSumParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> equation = 0) {
+  EinSumParamBuilder builder_(_fbb);
+  builder_.add_equation(equation);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<EinSumParam> CreateEinSumParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *equation = nullptr) {
+  auto equation__ = equation ? _fbb.CreateString(equation) : 0;
+  return ppl::nn::pmx::x86::CreateEinSumParam(
+      _fbb,
+      equation__);
+}
+
+struct HardSigmoidParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef HardSigmoidParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALPHA = 4,
+    VT_BETA = 6
+  };
+  float alpha() const {
+    return GetField<float>(VT_ALPHA, 0.0f);
+  }
+  float beta() const {
+    return GetField<float>(VT_BETA, 0.0f);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<float>(verifier, VT_ALPHA, 4) &&
+           VerifyField<float>(verifier, VT_BETA, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct HardSigmoidParamBuilder {
+  typedef HardSigmoidParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_alpha(float alpha) {
+    fbb_.AddElement<float>(HardSigmoidParam::VT_ALPHA, alpha, 0.0f);
+  }
+  void add_beta(float beta) {
+    fbb_.AddElement<float>(HardSigmoidParam::VT_BETA, beta, 0.0f);
+  }
+  explicit HardSigmoidParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<HardSigmoidParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<HardSigmoidParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<HardSigmoidParam> CreateHardSigmoidParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    float alpha = 0.0f,
+    float beta = 0.0f) {
+  HardSigmoidParamBuilder builder_(_fbb);
+  builder_.add_beta(beta);
+  builder_.add_alpha(alpha);
+  return builder_.Finish();
+}
+
+struct LayerNormalizationParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LayerNormalizationParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_AXIS = 4,
+    VT_EPSILON = 6,
+    VT_STASH_TYPE = 8
+  };
+  int32_t axis() const {
+    return GetField<int32_t>(VT_AXIS, 0);
+  }
+  float epsilon() const {
+    return GetField<float>(VT_EPSILON, 0.0f);
+  }
+  int32_t stash_type() const {
+    return GetField<int32_t>(VT_STASH_TYPE, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_AXIS, 4) &&
+           VerifyField<float>(verifier, VT_EPSILON, 4) &&
+           VerifyField<int32_t>(verifier, VT_STASH_TYPE, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct LayerNormalizationParamBuilder {
+  typedef LayerNormalizationParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_axis(int32_t axis) {
+    fbb_.AddElement<int32_t>(LayerNormalizationParam::VT_AXIS, axis, 0);
+  }
+  void add_epsilon(float epsilon) {
+    fbb_.AddElement<float>(LayerNormalizationParam::VT_EPSILON, epsilon, 0.0f);
+  }
+  void add_stash_type(int32_t stash_type) {
+    fbb_.AddElement<int32_t>(LayerNormalizationParam::VT_STASH_TYPE, stash_type, 0);
+  }
+  explicit LayerNormalizationParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<LayerNormalizationParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LayerNormalizationParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LayerNormalizationParam> CreateLayerNormalizationParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t axis = 0,
+    float epsilon = 0.0f,
+    int32_t stash_type = 0) {
+  LayerNormalizationParamBuilder builder_(_fbb);
+  builder_.add_stash_type(stash_type);
+  builder_.add_epsilon(epsilon);
+  builder_.add_axis(axis);
+  return builder_.Finish();
+}
+
+struct OneHotParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef OneHotParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_AXIS = 4
+  };
+  int32_t axis() const {
+    return GetField<int32_t>(VT_AXIS, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_AXIS, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct OneHotParamBuilder {
+  typedef OneHotParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_axis(int32_t axis) {
+    fbb_.AddElement<int32_t>(OneHotParam::VT_AXIS, axis, 0);
+  }
+  explicit OneHotParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<OneHotParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<OneHotParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<OneHotParam> CreateOneHotParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t axis = 0) {
+  OneHotParamBuilder builder_(_fbb);
+  builder_.add_axis(axis);
+  return builder_.Finish();
+}
+
+struct RandomUniformParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef RandomUniformParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DTYPE = 4,
+    VT_HIGH = 6,
+    VT_LOW = 8,
+    VT_SEED = 10,
+    VT_SHAPE = 12
+  };
+  int32_t dtype() const {
+    return GetField<int32_t>(VT_DTYPE, 0);
+  }
+  float high() const {
+    return GetField<float>(VT_HIGH, 0.0f);
+  }
+  float low() const {
+    return GetField<float>(VT_LOW, 0.0f);
+  }
+  const flatbuffers::Vector<float> *seed() const {
+    return GetPointer<const flatbuffers::Vector<float> *>(VT_SEED);
+  }
+  const flatbuffers::Vector<int32_t> *shape() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_SHAPE);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_DTYPE, 4) &&
+           VerifyField<float>(verifier, VT_HIGH, 4) &&
+           VerifyField<float>(verifier, VT_LOW, 4) &&
+           VerifyOffset(verifier, VT_SEED) &&
+           verifier.VerifyVector(seed()) &&
+           VerifyOffset(verifier, VT_SHAPE) &&
+           verifier.VerifyVector(shape()) &&
+           verifier.EndTable();
+  }
+};
+
+struct RandomUniformParamBuilder {
+  typedef RandomUniformParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_dtype(int32_t dtype) {
+    fbb_.AddElement<int32_t>(RandomUniformParam::VT_DTYPE, dtype, 0);
+  }
+  void add_high(float high) {
+    fbb_.AddElement<float>(RandomUniformParam::VT_HIGH, high, 0.0f);
+  }
+  void add_low(float low) {
+    fbb_.AddElement<float>(RandomUniformParam::VT_LOW, low, 0.0f);
+  }
+  void add_seed(flatbuffers::Offset<flatbuffers::Vector<float>> seed) {
+    fbb_.AddOffset(RandomUniformParam::VT_SEED, seed);
+  }
+  void add_shape(flatbuffers::Offset<flatbuffers::Vector<int32_t>> shape) {
+    fbb_.AddOffset(RandomUniformParam::VT_SHAPE, shape);
+  }
+  explicit RandomUniformParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<RandomUniformParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<RandomUniformParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<RandomUniformParam> CreateRandomUniformParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t dtype = 0,
+    float high = 0.0f,
+    float low = 0.0f,
+    flatbuffers::Offset<flatbuffers::Vector<float>> seed = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> shape = 0) {
+  RandomUniformParamBuilder builder_(_fbb);
+  builder_.add_shape(shape);
+  builder_.add_seed(seed);
+  builder_.add_low(low);
+  builder_.add_high(high);
+  builder_.add_dtype(dtype);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<RandomUniformParam> CreateRandomUniformParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t dtype = 0,
+    float high = 0.0f,
+    float low = 0.0f,
+    const std::vector<float> *seed = nullptr,
+    const std::vector<int32_t> *shape = nullptr) {
+  auto seed__ = seed ? _fbb.CreateVector<float>(*seed) : 0;
+  auto shape__ = shape ? _fbb.CreateVector<int32_t>(*shape) : 0;
+  return ppl::nn::pmx::x86::CreateRandomUniformParam(
+      _fbb,
+      dtype,
+      high,
+      low,
+      seed__,
+      shape__);
+}
+
+struct ReshapeParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ReshapeParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALLOWZERO = 4
+  };
+  int32_t allowzero() const {
+    return GetField<int32_t>(VT_ALLOWZERO, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_ALLOWZERO, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct ReshapeParamBuilder {
+  typedef ReshapeParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_allowzero(int32_t allowzero) {
+    fbb_.AddElement<int32_t>(ReshapeParam::VT_ALLOWZERO, allowzero, 0);
+  }
+  explicit ReshapeParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ReshapeParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ReshapeParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ReshapeParam> CreateReshapeParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t allowzero = 0) {
+  ReshapeParamBuilder builder_(_fbb);
+  builder_.add_allowzero(allowzero);
+  return builder_.Finish();
+}
+
+struct MMCVGridSampleParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef MMCVGridSampleParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALIGN_CORNERS = 4,
+    VT_INTERPOLATION_MODE = 6,
+    VT_PADDING_MODE = 8
+  };
+  int64_t align_corners() const {
+    return GetField<int64_t>(VT_ALIGN_CORNERS, 0);
+  }
+  int64_t interpolation_mode() const {
+    return GetField<int64_t>(VT_INTERPOLATION_MODE, 0);
+  }
+  int64_t padding_mode() const {
+    return GetField<int64_t>(VT_PADDING_MODE, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int64_t>(verifier, VT_ALIGN_CORNERS, 8) &&
+           VerifyField<int64_t>(verifier, VT_INTERPOLATION_MODE, 8) &&
+           VerifyField<int64_t>(verifier, VT_PADDING_MODE, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct MMCVGridSampleParamBuilder {
+  typedef MMCVGridSampleParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_align_corners(int64_t align_corners) {
+    fbb_.AddElement<int64_t>(MMCVGridSampleParam::VT_ALIGN_CORNERS, align_corners, 0);
+  }
+  void add_interpolation_mode(int64_t interpolation_mode) {
+    fbb_.AddElement<int64_t>(MMCVGridSampleParam::VT_INTERPOLATION_MODE, interpolation_mode, 0);
+  }
+  void add_padding_mode(int64_t padding_mode) {
+    fbb_.AddElement<int64_t>(MMCVGridSampleParam::VT_PADDING_MODE, padding_mode, 0);
+  }
+  explicit MMCVGridSampleParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<MMCVGridSampleParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<MMCVGridSampleParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<MMCVGridSampleParam> CreateMMCVGridSampleParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t align_corners = 0,
+    int64_t interpolation_mode = 0,
+    int64_t padding_mode = 0) {
+  MMCVGridSampleParamBuilder builder_(_fbb);
+  builder_.add_padding_mode(padding_mode);
+  builder_.add_interpolation_mode(interpolation_mode);
+  builder_.add_align_corners(align_corners);
+  return builder_.Finish();
+}
+
+struct MMCVModulatedDeformConv2dParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef MMCVModulatedDeformConv2dParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_STRIDE = 4,
+    VT_PADDING = 6,
+    VT_DILATION = 8,
+    VT_GROUPS = 10,
+    VT_DEFORM_GROUPS = 12
+  };
+  const flatbuffers::Vector<int64_t> *stride() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_STRIDE);
+  }
+  const flatbuffers::Vector<int64_t> *padding() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_PADDING);
+  }
+  const flatbuffers::Vector<int64_t> *dilation() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_DILATION);
+  }
+  int64_t groups() const {
+    return GetField<int64_t>(VT_GROUPS, 0);
+  }
+  int64_t deform_groups() const {
+    return GetField<int64_t>(VT_DEFORM_GROUPS, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_STRIDE) &&
+           verifier.VerifyVector(stride()) &&
+           VerifyOffset(verifier, VT_PADDING) &&
+           verifier.VerifyVector(padding()) &&
+           VerifyOffset(verifier, VT_DILATION) &&
+           verifier.VerifyVector(dilation()) &&
+           VerifyField<int64_t>(verifier, VT_GROUPS, 8) &&
+           VerifyField<int64_t>(verifier, VT_DEFORM_GROUPS, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct MMCVModulatedDeformConv2dParamBuilder {
+  typedef MMCVModulatedDeformConv2dParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_stride(flatbuffers::Offset<flatbuffers::Vector<int64_t>> stride) {
+    fbb_.AddOffset(MMCVModulatedDeformConv2dParam::VT_STRIDE, stride);
+  }
+  void add_padding(flatbuffers::Offset<flatbuffers::Vector<int64_t>> padding) {
+    fbb_.AddOffset(MMCVModulatedDeformConv2dParam::VT_PADDING, padding);
+  }
+  void add_dilation(flatbuffers::Offset<flatbuffers::Vector<int64_t>> dilation) {
+    fbb_.AddOffset(MMCVModulatedDeformConv2dParam::VT_DILATION, dilation);
+  }
+  void add_groups(int64_t groups) {
+    fbb_.AddElement<int64_t>(MMCVModulatedDeformConv2dParam::VT_GROUPS, groups, 0);
+  }
+  void add_deform_groups(int64_t deform_groups) {
+    fbb_.AddElement<int64_t>(MMCVModulatedDeformConv2dParam::VT_DEFORM_GROUPS, deform_groups, 0);
+  }
+  explicit MMCVModulatedDeformConv2dParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<MMCVModulatedDeformConv2dParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<MMCVModulatedDeformConv2dParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<MMCVModulatedDeformConv2dParam> CreateMMCVModulatedDeformConv2dParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> stride = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> padding = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> dilation = 0,
+    int64_t groups = 0,
+    int64_t deform_groups = 0) {
+  MMCVModulatedDeformConv2dParamBuilder builder_(_fbb);
+  builder_.add_deform_groups(deform_groups);
+  builder_.add_groups(groups);
+  builder_.add_dilation(dilation);
+  builder_.add_padding(padding);
+  builder_.add_stride(stride);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<MMCVModulatedDeformConv2dParam> CreateMMCVModulatedDeformConv2dParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<int64_t> *stride = nullptr,
+    const std::vector<int64_t> *padding = nullptr,
+    const std::vector<int64_t> *dilation = nullptr,
+    int64_t groups = 0,
+    int64_t deform_groups = 0) {
+  auto stride__ = stride ? _fbb.CreateVector<int64_t>(*stride) : 0;
+  auto padding__ = padding ? _fbb.CreateVector<int64_t>(*padding) : 0;
+  auto dilation__ = dilation ? _fbb.CreateVector<int64_t>(*dilation) : 0;
+  return ppl::nn::pmx::x86::CreateMMCVModulatedDeformConv2dParam(
+      _fbb,
+      stride__,
+      padding__,
+      dilation__,
+      groups,
+      deform_groups);
+}
+
+struct MMCVNMSParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef MMCVNMSParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_IOU_THRESHOLD = 4,
+    VT_OFFSET = 6
+  };
+  float iou_threshold() const {
+    return GetField<float>(VT_IOU_THRESHOLD, 0.0f);
+  }
+  int64_t offset() const {
+    return GetField<int64_t>(VT_OFFSET, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<float>(verifier, VT_IOU_THRESHOLD, 4) &&
+           VerifyField<int64_t>(verifier, VT_OFFSET, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct MMCVNMSParamBuilder {
+  typedef MMCVNMSParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_iou_threshold(float iou_threshold) {
+    fbb_.AddElement<float>(MMCVNMSParam::VT_IOU_THRESHOLD, iou_threshold, 0.0f);
+  }
+  void add_offset(int64_t offset) {
+    fbb_.AddElement<int64_t>(MMCVNMSParam::VT_OFFSET, offset, 0);
+  }
+  explicit MMCVNMSParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<MMCVNMSParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<MMCVNMSParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<MMCVNMSParam> CreateMMCVNMSParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    float iou_threshold = 0.0f,
+    int64_t offset = 0) {
+  MMCVNMSParamBuilder builder_(_fbb);
+  builder_.add_offset(offset);
+  builder_.add_iou_threshold(iou_threshold);
+  return builder_.Finish();
+}
+
+struct MMCVRoiAlignParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef MMCVRoiAlignParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ALIGNED = 4,
+    VT_ALIGNED_HEIGHT = 6,
+    VT_ALIGNED_WIDTH = 8,
+    VT_POOL_MODE = 10,
+    VT_SAMPLING_RATIO = 12,
+    VT_SPATIAL_SCALE = 14
+  };
+  int64_t aligned() const {
+    return GetField<int64_t>(VT_ALIGNED, 0);
+  }
+  int64_t aligned_height() const {
+    return GetField<int64_t>(VT_ALIGNED_HEIGHT, 0);
+  }
+  int64_t aligned_width() const {
+    return GetField<int64_t>(VT_ALIGNED_WIDTH, 0);
+  }
+  const flatbuffers::String *pool_mode() const {
+    return GetPointer<const flatbuffers::String *>(VT_POOL_MODE);
+  }
+  int64_t sampling_ratio() const {
+    return GetField<int64_t>(VT_SAMPLING_RATIO, 0);
+  }
+  float spatial_scale() const {
+    return GetField<float>(VT_SPATIAL_SCALE, 0.0f);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int64_t>(verifier, VT_ALIGNED, 8) &&
+           VerifyField<int64_t>(verifier, VT_ALIGNED_HEIGHT, 8) &&
+           VerifyField<int64_t>(verifier, VT_ALIGNED_WIDTH, 8) &&
+           VerifyOffset(verifier, VT_POOL_MODE) &&
+           verifier.VerifyString(pool_mode()) &&
+           VerifyField<int64_t>(verifier, VT_SAMPLING_RATIO, 8) &&
+           VerifyField<float>(verifier, VT_SPATIAL_SCALE, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct MMCVRoiAlignParamBuilder {
+  typedef MMCVRoiAlignParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_aligned(int64_t aligned) {
+    fbb_.AddElement<int64_t>(MMCVRoiAlignParam::VT_ALIGNED, aligned, 0);
+  }
+  void add_aligned_height(int64_t aligned_height) {
+    fbb_.AddElement<int64_t>(MMCVRoiAlignParam::VT_ALIGNED_HEIGHT, aligned_height, 0);
+  }
+  void add_aligned_width(int64_t aligned_width) {
+    fbb_.AddElement<int64_t>(MMCVRoiAlignParam::VT_ALIGNED_WIDTH, aligned_width, 0);
+  }
+  void add_pool_mode(flatbuffers::Offset<flatbuffers::String> pool_mode) {
+    fbb_.AddOffset(MMCVRoiAlignParam::VT_POOL_MODE, pool_mode);
+  }
+  void add_sampling_ratio(int64_t sampling_ratio) {
+    fbb_.AddElement<int64_t>(MMCVRoiAlignParam::VT_SAMPLING_RATIO, sampling_ratio, 0);
+  }
+  void add_spatial_scale(float spatial_scale) {
+    fbb_.AddElement<float>(MMCVRoiAlignParam::VT_SPATIAL_SCALE, spatial_scale, 0.0f);
+  }
+  explicit MMCVRoiAlignParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<MMCVRoiAlignParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<MMCVRoiAlignParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<MMCVRoiAlignParam> CreateMMCVRoiAlignParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t aligned = 0,
+    int64_t aligned_height = 0,
+    int64_t aligned_width = 0,
+    flatbuffers::Offset<flatbuffers::String> pool_mode = 0,
+    int64_t sampling_ratio = 0,
+    float spatial_scale = 0.0f) {
+  MMCVRoiAlignParamBuilder builder_(_fbb);
+  builder_.add_sampling_ratio(sampling_ratio);
+  builder_.add_aligned_width(aligned_width);
+  builder_.add_aligned_height(aligned_height);
+  builder_.add_aligned(aligned);
+  builder_.add_spatial_scale(spatial_scale);
+  builder_.add_pool_mode(pool_mode);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<MMCVRoiAlignParam> CreateMMCVRoiAlignParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t aligned = 0,
+    int64_t aligned_height = 0,
+    int64_t aligned_width = 0,
+    const char *pool_mode = nullptr,
+    int64_t sampling_ratio = 0,
+    float spatial_scale = 0.0f) {
+  auto pool_mode__ = pool_mode ? _fbb.CreateString(pool_mode) : 0;
+  return ppl::nn::pmx::x86::CreateMMCVRoiAlignParam(
+      _fbb,
+      aligned,
+      aligned_height,
+      aligned_width,
+      pool_mode__,
+      sampling_ratio,
+      spatial_scale);
+}
+
+struct ChannelShuffleParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ChannelShuffleParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_GROUP = 4
+  };
+  int32_t group() const {
+    return GetField<int32_t>(VT_GROUP, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_GROUP, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct ChannelShuffleParamBuilder {
+  typedef ChannelShuffleParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_group(int32_t group) {
+    fbb_.AddElement<int32_t>(ChannelShuffleParam::VT_GROUP, group, 0);
+  }
+  explicit ChannelShuffleParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ChannelShuffleParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ChannelShuffleParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ChannelShuffleParam> CreateChannelShuffleParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t group = 0) {
+  ChannelShuffleParamBuilder builder_(_fbb);
+  builder_.add_group(group);
+  return builder_.Finish();
+}
+
+struct GELUParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef GELUParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_APPROXIMATE = 4
+  };
+  bool approximate() const {
+    return GetField<uint8_t>(VT_APPROXIMATE, 0) != 0;
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_APPROXIMATE, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct GELUParamBuilder {
+  typedef GELUParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_approximate(bool approximate) {
+    fbb_.AddElement<uint8_t>(GELUParam::VT_APPROXIMATE, static_cast<uint8_t>(approximate), 0);
+  }
+  explicit GELUParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<GELUParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<GELUParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<GELUParam> CreateGELUParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    bool approximate = false) {
+  GELUParamBuilder builder_(_fbb);
+  builder_.add_approximate(approximate);
+  return builder_.Finish();
+}
+
+struct LayerNormParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LayerNormParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ELEMENTWISE_AFFINE = 4,
+    VT_AXIS = 6,
+    VT_EPS = 8,
+    VT_SKIP_TERM = 10
+  };
+  bool elementwise_affine() const {
+    return GetField<uint8_t>(VT_ELEMENTWISE_AFFINE, 0) != 0;
+  }
+  int32_t axis() const {
+    return GetField<int32_t>(VT_AXIS, 0);
+  }
+  float eps() const {
+    return GetField<float>(VT_EPS, 0.0f);
+  }
+  bool skip_term() const {
+    return GetField<uint8_t>(VT_SKIP_TERM, 0) != 0;
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_ELEMENTWISE_AFFINE, 1) &&
+           VerifyField<int32_t>(verifier, VT_AXIS, 4) &&
+           VerifyField<float>(verifier, VT_EPS, 4) &&
+           VerifyField<uint8_t>(verifier, VT_SKIP_TERM, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct LayerNormParamBuilder {
+  typedef LayerNormParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_elementwise_affine(bool elementwise_affine) {
+    fbb_.AddElement<uint8_t>(LayerNormParam::VT_ELEMENTWISE_AFFINE, static_cast<uint8_t>(elementwise_affine), 0);
+  }
+  void add_axis(int32_t axis) {
+    fbb_.AddElement<int32_t>(LayerNormParam::VT_AXIS, axis, 0);
+  }
+  void add_eps(float eps) {
+    fbb_.AddElement<float>(LayerNormParam::VT_EPS, eps, 0.0f);
+  }
+  void add_skip_term(bool skip_term) {
+    fbb_.AddElement<uint8_t>(LayerNormParam::VT_SKIP_TERM, static_cast<uint8_t>(skip_term), 0);
+  }
+  explicit LayerNormParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<LayerNormParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LayerNormParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LayerNormParam> CreateLayerNormParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    bool elementwise_affine = false,
+    int32_t axis = 0,
+    float eps = 0.0f,
+    bool skip_term = false) {
+  LayerNormParamBuilder builder_(_fbb);
+  builder_.add_eps(eps);
+  builder_.add_axis(axis);
+  builder_.add_skip_term(skip_term);
+  builder_.add_elementwise_affine(elementwise_affine);
+  return builder_.Finish();
+}
+
+struct ShapeMatrix FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ShapeMatrixBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_EDGE = 4,
+    VT_NUMERATOR = 6,
+    VT_DENOMINATOR = 8,
+    VT_REAL_DIM = 10,
+    VT_SCALAR = 12
+  };
+  uint32_t edge() const {
+    return GetField<uint32_t>(VT_EDGE, 0);
+  }
+  const flatbuffers::Vector<int64_t> *numerator() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_NUMERATOR);
+  }
+  const flatbuffers::Vector<int64_t> *denominator() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_DENOMINATOR);
+  }
+  int64_t real_dim() const {
+    return GetField<int64_t>(VT_REAL_DIM, 0);
+  }
+  bool scalar() const {
+    return GetField<uint8_t>(VT_SCALAR, 0) != 0;
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_EDGE, 4) &&
+           VerifyOffset(verifier, VT_NUMERATOR) &&
+           verifier.VerifyVector(numerator()) &&
+           VerifyOffset(verifier, VT_DENOMINATOR) &&
+           verifier.VerifyVector(denominator()) &&
+           VerifyField<int64_t>(verifier, VT_REAL_DIM, 8) &&
+           VerifyField<uint8_t>(verifier, VT_SCALAR, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct ShapeMatrixBuilder {
+  typedef ShapeMatrix Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_edge(uint32_t edge) {
+    fbb_.AddElement<uint32_t>(ShapeMatrix::VT_EDGE, edge, 0);
+  }
+  void add_numerator(flatbuffers::Offset<flatbuffers::Vector<int64_t>> numerator) {
+    fbb_.AddOffset(ShapeMatrix::VT_NUMERATOR, numerator);
+  }
+  void add_denominator(flatbuffers::Offset<flatbuffers::Vector<int64_t>> denominator) {
+    fbb_.AddOffset(ShapeMatrix::VT_DENOMINATOR, denominator);
+  }
+  void add_real_dim(int64_t real_dim) {
+    fbb_.AddElement<int64_t>(ShapeMatrix::VT_REAL_DIM, real_dim, 0);
+  }
+  void add_scalar(bool scalar) {
+    fbb_.AddElement<uint8_t>(ShapeMatrix::VT_SCALAR, static_cast<uint8_t>(scalar), 0);
+  }
+  explicit ShapeMatrixBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ShapeMatrix> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ShapeMatrix>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ShapeMatrix> CreateShapeMatrix(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t edge = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> numerator = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> denominator = 0,
+    int64_t real_dim = 0,
+    bool scalar = false) {
+  ShapeMatrixBuilder builder_(_fbb);
+  builder_.add_real_dim(real_dim);
+  builder_.add_denominator(denominator);
+  builder_.add_numerator(numerator);
+  builder_.add_edge(edge);
+  builder_.add_scalar(scalar);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ShapeMatrix> CreateShapeMatrixDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t edge = 0,
+    const std::vector<int64_t> *numerator = nullptr,
+    const std::vector<int64_t> *denominator = nullptr,
+    int64_t real_dim = 0,
+    bool scalar = false) {
+  auto numerator__ = numerator ? _fbb.CreateVector<int64_t>(*numerator) : 0;
+  auto denominator__ = denominator ? _fbb.CreateVector<int64_t>(*denominator) : 0;
+  return ppl::nn::pmx::x86::CreateShapeMatrix(
+      _fbb,
+      edge,
+      numerator__,
+      denominator__,
+      real_dim,
+      scalar);
+}
+
+struct ShapeOperationParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ShapeOperationParamBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SHAPE_MATRIX = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>> *shape_matrix() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>> *>(VT_SHAPE_MATRIX);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SHAPE_MATRIX) &&
+           verifier.VerifyVector(shape_matrix()) &&
+           verifier.VerifyVectorOfTables(shape_matrix()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ShapeOperationParamBuilder {
+  typedef ShapeOperationParam Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_shape_matrix(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>>> shape_matrix) {
+    fbb_.AddOffset(ShapeOperationParam::VT_SHAPE_MATRIX, shape_matrix);
+  }
+  explicit ShapeOperationParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ShapeOperationParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ShapeOperationParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ShapeOperationParam> CreateShapeOperationParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>>> shape_matrix = 0) {
+  ShapeOperationParamBuilder builder_(_fbb);
+  builder_.add_shape_matrix(shape_matrix);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ShapeOperationParam> CreateShapeOperationParamDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>> *shape_matrix = nullptr) {
+  auto shape_matrix__ = shape_matrix ? _fbb.CreateVector<flatbuffers::Offset<ppl::nn::pmx::x86::ShapeMatrix>>(*shape_matrix) : 0;
+  return ppl::nn::pmx::x86::CreateShapeOperationParam(
+      _fbb,
+      shape_matrix__);
+}
+
+struct ParamData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ParamDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PARAM_TYPE = 4,
+    VT_PARAM = 6,
+    VT_DFORMAT = 8,
+    VT_RNN_DATA = 10
+  };
+  ppl::nn::pmx::x86::ParamType param_type() const {
+    return static_cast<ppl::nn::pmx::x86::ParamType>(GetField<uint8_t>(VT_PARAM_TYPE, 0));
+  }
+  const void *param() const {
+    return GetPointer<const void *>(VT_PARAM);
+  }
+  template<typename T> const T *param_as() const;
+  const ppl::nn::pmx::x86::GRUParam *param_as_GRUParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_GRUParam ? static_cast<const ppl::nn::pmx::x86::GRUParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ConstantOfShapeParam *param_as_ConstantOfShapeParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_ConstantOfShapeParam ? static_cast<const ppl::nn::pmx::x86::ConstantOfShapeParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::EinSumParam *param_as_EinSumParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_EinSumParam ? static_cast<const ppl::nn::pmx::x86::EinSumParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::HardSigmoidParam *param_as_HardSigmoidParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_HardSigmoidParam ? static_cast<const ppl::nn::pmx::x86::HardSigmoidParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::LayerNormalizationParam *param_as_LayerNormalizationParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_LayerNormalizationParam ? static_cast<const ppl::nn::pmx::x86::LayerNormalizationParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::OneHotParam *param_as_OneHotParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_OneHotParam ? static_cast<const ppl::nn::pmx::x86::OneHotParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::RandomUniformParam *param_as_RandomUniformParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_RandomUniformParam ? static_cast<const ppl::nn::pmx::x86::RandomUniformParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ReshapeParam *param_as_ReshapeParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_ReshapeParam ? static_cast<const ppl::nn::pmx::x86::ReshapeParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::MMCVGridSampleParam *param_as_MMCVGridSampleParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_MMCVGridSampleParam ? static_cast<const ppl::nn::pmx::x86::MMCVGridSampleParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam *param_as_MMCVModulatedDeformConv2dParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_MMCVModulatedDeformConv2dParam ? static_cast<const ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::MMCVNMSParam *param_as_MMCVNMSParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_MMCVNMSParam ? static_cast<const ppl::nn::pmx::x86::MMCVNMSParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::MMCVRoiAlignParam *param_as_MMCVRoiAlignParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_MMCVRoiAlignParam ? static_cast<const ppl::nn::pmx::x86::MMCVRoiAlignParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ChannelShuffleParam *param_as_ChannelShuffleParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_ChannelShuffleParam ? static_cast<const ppl::nn::pmx::x86::ChannelShuffleParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::GELUParam *param_as_GELUParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_GELUParam ? static_cast<const ppl::nn::pmx::x86::GELUParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::LayerNormParam *param_as_LayerNormParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_LayerNormParam ? static_cast<const ppl::nn::pmx::x86::LayerNormParam *>(param()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ShapeOperationParam *param_as_ShapeOperationParam() const {
+    return param_type() == ppl::nn::pmx::x86::ParamType_ShapeOperationParam ? static_cast<const ppl::nn::pmx::x86::ShapeOperationParam *>(param()) : nullptr;
+  }
+  const flatbuffers::Vector<uint32_t> *dformat() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_DFORMAT);
+  }
+  const ppl::nn::pmx::x86::RNNData *rnn_data() const {
+    return GetPointer<const ppl::nn::pmx::x86::RNNData *>(VT_RNN_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_PARAM_TYPE, 1) &&
+           VerifyOffset(verifier, VT_PARAM) &&
+           VerifyParamType(verifier, param(), param_type()) &&
+           VerifyOffset(verifier, VT_DFORMAT) &&
+           verifier.VerifyVector(dformat()) &&
+           VerifyOffset(verifier, VT_RNN_DATA) &&
+           verifier.VerifyTable(rnn_data()) &&
+           verifier.EndTable();
+  }
+};
+
+template<> inline const ppl::nn::pmx::x86::GRUParam *ParamData::param_as<ppl::nn::pmx::x86::GRUParam>() const {
+  return param_as_GRUParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::ConstantOfShapeParam *ParamData::param_as<ppl::nn::pmx::x86::ConstantOfShapeParam>() const {
+  return param_as_ConstantOfShapeParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::EinSumParam *ParamData::param_as<ppl::nn::pmx::x86::EinSumParam>() const {
+  return param_as_EinSumParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::HardSigmoidParam *ParamData::param_as<ppl::nn::pmx::x86::HardSigmoidParam>() const {
+  return param_as_HardSigmoidParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::LayerNormalizationParam *ParamData::param_as<ppl::nn::pmx::x86::LayerNormalizationParam>() const {
+  return param_as_LayerNormalizationParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::OneHotParam *ParamData::param_as<ppl::nn::pmx::x86::OneHotParam>() const {
+  return param_as_OneHotParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::RandomUniformParam *ParamData::param_as<ppl::nn::pmx::x86::RandomUniformParam>() const {
+  return param_as_RandomUniformParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::ReshapeParam *ParamData::param_as<ppl::nn::pmx::x86::ReshapeParam>() const {
+  return param_as_ReshapeParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::MMCVGridSampleParam *ParamData::param_as<ppl::nn::pmx::x86::MMCVGridSampleParam>() const {
+  return param_as_MMCVGridSampleParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam *ParamData::param_as<ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam>() const {
+  return param_as_MMCVModulatedDeformConv2dParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::MMCVNMSParam *ParamData::param_as<ppl::nn::pmx::x86::MMCVNMSParam>() const {
+  return param_as_MMCVNMSParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::MMCVRoiAlignParam *ParamData::param_as<ppl::nn::pmx::x86::MMCVRoiAlignParam>() const {
+  return param_as_MMCVRoiAlignParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::ChannelShuffleParam *ParamData::param_as<ppl::nn::pmx::x86::ChannelShuffleParam>() const {
+  return param_as_ChannelShuffleParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::GELUParam *ParamData::param_as<ppl::nn::pmx::x86::GELUParam>() const {
+  return param_as_GELUParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::LayerNormParam *ParamData::param_as<ppl::nn::pmx::x86::LayerNormParam>() const {
+  return param_as_LayerNormParam();
+}
+
+template<> inline const ppl::nn::pmx::x86::ShapeOperationParam *ParamData::param_as<ppl::nn::pmx::x86::ShapeOperationParam>() const {
+  return param_as_ShapeOperationParam();
+}
+
+struct ParamDataBuilder {
+  typedef ParamData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_param_type(ppl::nn::pmx::x86::ParamType param_type) {
+    fbb_.AddElement<uint8_t>(ParamData::VT_PARAM_TYPE, static_cast<uint8_t>(param_type), 0);
+  }
+  void add_param(flatbuffers::Offset<void> param) {
+    fbb_.AddOffset(ParamData::VT_PARAM, param);
+  }
+  void add_dformat(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat) {
+    fbb_.AddOffset(ParamData::VT_DFORMAT, dformat);
+  }
+  void add_rnn_data(flatbuffers::Offset<ppl::nn::pmx::x86::RNNData> rnn_data) {
+    fbb_.AddOffset(ParamData::VT_RNN_DATA, rnn_data);
+  }
+  explicit ParamDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<ParamData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ParamData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ParamData> CreateParamData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    ppl::nn::pmx::x86::ParamType param_type = ppl::nn::pmx::x86::ParamType_NONE,
+    flatbuffers::Offset<void> param = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> dformat = 0,
+    flatbuffers::Offset<ppl::nn::pmx::x86::RNNData> rnn_data = 0) {
+  ParamDataBuilder builder_(_fbb);
+  builder_.add_rnn_data(rnn_data);
+  builder_.add_dformat(dformat);
+  builder_.add_param(param);
+  builder_.add_param_type(param_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ParamData> CreateParamDataDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    ppl::nn::pmx::x86::ParamType param_type = ppl::nn::pmx::x86::ParamType_NONE,
+    flatbuffers::Offset<void> param = 0,
+    const std::vector<uint32_t> *dformat = nullptr,
+    flatbuffers::Offset<ppl::nn::pmx::x86::RNNData> rnn_data = 0) {
+  auto dformat__ = dformat ? _fbb.CreateVector<uint32_t>(*dformat) : 0;
+  return ppl::nn::pmx::x86::CreateParamData(
+      _fbb,
+      param_type,
+      param,
+      dformat__,
+      rnn_data);
+}
+
+struct OpData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef OpDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VALUE_TYPE = 4,
+    VT_VALUE = 6
+  };
+  ppl::nn::pmx::x86::PrivateDataType value_type() const {
+    return static_cast<ppl::nn::pmx::x86::PrivateDataType>(GetField<uint8_t>(VT_VALUE_TYPE, 0));
+  }
+  const void *value() const {
+    return GetPointer<const void *>(VT_VALUE);
+  }
+  template<typename T> const T *value_as() const;
+  const ppl::nn::pmx::x86::OutputData *value_as_OutputData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_OutputData ? static_cast<const ppl::nn::pmx::x86::OutputData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::FusionData *value_as_FusionData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_FusionData ? static_cast<const ppl::nn::pmx::x86::FusionData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ConvData *value_as_ConvData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_ConvData ? static_cast<const ppl::nn::pmx::x86::ConvData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::GemmData *value_as_GemmData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_GemmData ? static_cast<const ppl::nn::pmx::x86::GemmData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::MatMulData *value_as_MatMulData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_MatMulData ? static_cast<const ppl::nn::pmx::x86::MatMulData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::RNNData *value_as_RNNData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_RNNData ? static_cast<const ppl::nn::pmx::x86::RNNData *>(value()) : nullptr;
+  }
+  const ppl::nn::pmx::x86::ParamData *value_as_ParamData() const {
+    return value_type() == ppl::nn::pmx::x86::PrivateDataType_ParamData ? static_cast<const ppl::nn::pmx::x86::ParamData *>(value()) : nullptr;
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_VALUE_TYPE, 1) &&
+           VerifyOffset(verifier, VT_VALUE) &&
+           VerifyPrivateDataType(verifier, value(), value_type()) &&
+           verifier.EndTable();
+  }
+};
+
+template<> inline const ppl::nn::pmx::x86::OutputData *OpData::value_as<ppl::nn::pmx::x86::OutputData>() const {
+  return value_as_OutputData();
+}
+
+template<> inline const ppl::nn::pmx::x86::FusionData *OpData::value_as<ppl::nn::pmx::x86::FusionData>() const {
+  return value_as_FusionData();
+}
+
+template<> inline const ppl::nn::pmx::x86::ConvData *OpData::value_as<ppl::nn::pmx::x86::ConvData>() const {
+  return value_as_ConvData();
+}
+
+template<> inline const ppl::nn::pmx::x86::GemmData *OpData::value_as<ppl::nn::pmx::x86::GemmData>() const {
+  return value_as_GemmData();
+}
+
+template<> inline const ppl::nn::pmx::x86::MatMulData *OpData::value_as<ppl::nn::pmx::x86::MatMulData>() const {
+  return value_as_MatMulData();
+}
+
+template<> inline const ppl::nn::pmx::x86::RNNData *OpData::value_as<ppl::nn::pmx::x86::RNNData>() const {
+  return value_as_RNNData();
+}
+
+template<> inline const ppl::nn::pmx::x86::ParamData *OpData::value_as<ppl::nn::pmx::x86::ParamData>() const {
+  return value_as_ParamData();
+}
+
+struct OpDataBuilder {
+  typedef OpData Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_value_type(ppl::nn::pmx::x86::PrivateDataType value_type) {
+    fbb_.AddElement<uint8_t>(OpData::VT_VALUE_TYPE, static_cast<uint8_t>(value_type), 0);
+  }
+  void add_value(flatbuffers::Offset<void> value) {
+    fbb_.AddOffset(OpData::VT_VALUE, value);
+  }
+  explicit OpDataBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<OpData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<OpData>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<OpData> CreateOpData(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    ppl::nn::pmx::x86::PrivateDataType value_type = ppl::nn::pmx::x86::PrivateDataType_NONE,
+    flatbuffers::Offset<void> value = 0) {
+  OpDataBuilder builder_(_fbb);
+  builder_.add_value(value);
+  builder_.add_value_type(value_type);
+  return builder_.Finish();
+}
+
+inline bool VerifyParamType(flatbuffers::Verifier &verifier, const void *obj, ParamType type) {
+  switch (type) {
+    case ParamType_NONE: {
+      return true;
+    }
+    case ParamType_GRUParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::GRUParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_ConstantOfShapeParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ConstantOfShapeParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_EinSumParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::EinSumParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_HardSigmoidParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::HardSigmoidParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_LayerNormalizationParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::LayerNormalizationParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_OneHotParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::OneHotParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_RandomUniformParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::RandomUniformParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_ReshapeParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ReshapeParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_MMCVGridSampleParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::MMCVGridSampleParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_MMCVModulatedDeformConv2dParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::MMCVModulatedDeformConv2dParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_MMCVNMSParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::MMCVNMSParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_MMCVRoiAlignParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::MMCVRoiAlignParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_ChannelShuffleParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ChannelShuffleParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_GELUParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::GELUParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_LayerNormParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::LayerNormParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case ParamType_ShapeOperationParam: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ShapeOperationParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    default: return true;
+  }
+}
+
+inline bool VerifyParamTypeVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types) {
+  if (!values || !types) return !values && !types;
+  if (values->size() != types->size()) return false;
+  for (flatbuffers::uoffset_t i = 0; i < values->size(); ++i) {
+    if (!VerifyParamType(
+        verifier,  values->Get(i), types->GetEnum<ParamType>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool VerifyPrivateDataType(flatbuffers::Verifier &verifier, const void *obj, PrivateDataType type) {
+  switch (type) {
+    case PrivateDataType_NONE: {
+      return true;
+    }
+    case PrivateDataType_OutputData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::OutputData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_FusionData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::FusionData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_ConvData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ConvData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_GemmData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::GemmData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_MatMulData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::MatMulData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_RNNData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::RNNData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case PrivateDataType_ParamData: {
+      auto ptr = reinterpret_cast<const ppl::nn::pmx::x86::ParamData *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    default: return true;
+  }
+}
+
+inline bool VerifyPrivateDataTypeVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types) {
+  if (!values || !types) return !values && !types;
+  if (values->size() != types->size()) return false;
+  for (flatbuffers::uoffset_t i = 0; i < values->size(); ++i) {
+    if (!VerifyPrivateDataType(
+        verifier,  values->Get(i), types->GetEnum<PrivateDataType>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline const ppl::nn::pmx::x86::OpData *GetOpData(const void *buf) {
+  return flatbuffers::GetRoot<ppl::nn::pmx::x86::OpData>(buf);
+}
+
+inline const ppl::nn::pmx::x86::OpData *GetSizePrefixedOpData(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<ppl::nn::pmx::x86::OpData>(buf);
+}
+
+inline bool VerifyOpDataBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<ppl::nn::pmx::x86::OpData>(nullptr);
+}
+
+inline bool VerifySizePrefixedOpDataBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<ppl::nn::pmx::x86::OpData>(nullptr);
+}
+
+inline void FinishOpDataBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<ppl::nn::pmx::x86::OpData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedOpDataBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<ppl::nn::pmx::x86::OpData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace x86
+}  // namespace pmx
+}  // namespace nn
+}  // namespace ppl
+
+#endif  // FLATBUFFERS_GENERATED_X86OPPARAMS_PPL_NN_PMX_X86_H_
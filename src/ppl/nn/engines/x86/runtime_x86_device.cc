@@ -36,15 +36,42 @@ RetCode RuntimeX86Device::Init(uint32_t mm_policy) {
         buffer_manager_.reset(new utils::StackBufferManager(allocator_ptr));
     } else if (mm_policy_ == MM_COMPACT) {
         auto allocator = new utils::BufferedCpuAllocator();
-        auto rc = allocator->Init();
+        auto rc = allocator->Init(UINT64_MAX, GetHugePagePolicy());
         if (rc != RC_SUCCESS) {
             LOG(ERROR) << "init allocator failed: " << GetRetCodeStr(rc);
             delete allocator;
             return rc;
         }
+        if (GetNumaNode() >= 0) {
+            auto numa_node_id = GetNumaNode();
+            allocator->SetCommitHandler([numa_node_id](void* addr, uint64_t bytes) -> void {
+                BindMemoryToNumaNode(addr, bytes, numa_node_id);
+            });
+        }
 
         vmr_.reset(allocator);
+        buffered_allocator_ = allocator;
         buffer_manager_.reset(new utils::CompactBufferManager(allocator, alignment_));
+    } else if (mm_policy_ == MM_STATIC_PLAN) {
+        auto allocator = new utils::BufferedCpuAllocator();
+        auto rc = allocator->Init(UINT64_MAX, GetHugePagePolicy());
+        if (rc != RC_SUCCESS) {
+            LOG(ERROR) << "init allocator failed: " << GetRetCodeStr(rc);
+            delete allocator;
+            return rc;
+        }
+        if (GetNumaNode() >= 0) {
+            auto numa_node_id = GetNumaNode();
+            allocator->SetCommitHandler([numa_node_id](void* addr, uint64_t bytes) -> void {
+                BindMemoryToNumaNode(addr, bytes, numa_node_id);
+            });
+        }
+
+        vmr_.reset(allocator);
+        buffered_allocator_ = allocator;
+        auto fallback = new utils::CompactBufferManager(allocator, alignment_);
+        static_plan_manager_ = new utils::StaticPlanBufferManager(X86Device::GetAllocator(), fallback, alignment_);
+        buffer_manager_.reset(static_plan_manager_);
     } else {
         LOG(ERROR) << "unknown mm policy: " << mm_policy;
         return RC_INVALID_VALUE;
@@ -56,40 +83,196 @@ RetCode RuntimeX86Device::Init(uint32_t mm_policy) {
 RuntimeX86Device::~RuntimeX86Device() {
     LOG(DEBUG) << "buffer manager[" << buffer_manager_->GetName() << "] allocates ["
                << buffer_manager_->GetBufferedBytes() << "] bytes.";
-    if (tmp_buffer_size_) {
-        buffer_manager_->Free(&shared_tmp_buffer_);
-    }
+    X86Device::Free(&shared_tmp_buffer_);
     buffer_manager_.reset();
 }
 
 RetCode RuntimeX86Device::AllocTmpBuffer(uint64_t bytes, BufferDesc* buffer) {
-    if (mm_policy_ == MM_COMPACT) {
-        auto ret = buffer_manager_->Realloc(bytes, &shared_tmp_buffer_);
-        if (RC_SUCCESS != ret) {
-            return ret;
-        }
-    } else {
-        if (bytes > tmp_buffer_size_ || bytes <= tmp_buffer_size_ / 2) {
-            auto ret = buffer_manager_->Realloc(bytes, &shared_tmp_buffer_);
-            if (RC_SUCCESS != ret) {
-                return ret;
-            }
-            tmp_buffer_size_ = bytes;
-        }
+    lock_guard<mutex> lck(mutex_);
+
+    if (bytes > max_tmp_buffer_bytes_) {
+        max_tmp_buffer_bytes_ = bytes;
+    }
+    if (bytes > run_max_tmp_buffer_bytes_) {
+        run_max_tmp_buffer_bytes_ = bytes;
+    }
+
+    if (bytes == 0) {
+        buffer->addr = nullptr;
+        return RC_SUCCESS;
     }
+
+    // the shared buffer is too small only in the first run after shapes are changed
+    if (tmp_buffer_in_use_ || bytes > tmp_buffer_size_) {
+        buffer->addr = nullptr;
+        auto rc = buffer_manager_->Realloc(bytes, buffer);
+        UpdatePeakBytes();
+        return rc;
+    }
+
     *buffer = shared_tmp_buffer_;
+    tmp_buffer_in_use_ = true;
     return RC_SUCCESS;
 }
 
 void RuntimeX86Device::FreeTmpBuffer(BufferDesc* buffer) {
-    if (mm_policy_ == MM_COMPACT) {
-        buffer_manager_->Free(&shared_tmp_buffer_);
+    if (!buffer->addr) {
+        return;
+    }
+
+    lock_guard<mutex> lck(mutex_);
+
+    // the shared buffer is kept for following kernels and runs
+    if (tmp_buffer_in_use_ && buffer->addr == shared_tmp_buffer_.addr) {
+        tmp_buffer_in_use_ = false;
+        return;
+    }
+
+    buffer_manager_->Free(buffer);
+}
+
+/*
+  scratch buffers of the next run are likely the same as this run's. the shared one is reserved once to the largest
+  requirement of this run, i.e. the max of `CalcTmpBufferSize()` of kernels, if it is too small or much larger than
+  needed, and is handed to every kernel until shapes change. it is allocated by the device instead of the buffer
+  manager, so that it neither splits buffers of tensors nor appears in plans of MM_STATIC_PLAN.
+*/
+RetCode RuntimeX86Device::ReserveTmpBuffer() {
+    const uint64_t bytes = run_max_tmp_buffer_bytes_;
+    run_max_tmp_buffer_bytes_ = 0;
+
+    if (tmp_buffer_in_use_ || bytes == 0 || (bytes <= tmp_buffer_size_ && bytes > tmp_buffer_size_ / 2)) {
+        return RC_SUCCESS;
+    }
+
+    X86Device::Free(&shared_tmp_buffer_);
+    tmp_buffer_size_ = 0;
+
+    auto rc = X86Device::Realloc(bytes, &shared_tmp_buffer_);
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "reserve [" << bytes << "] bytes for scratch buffers failed: " << GetRetCodeStr(rc);
+        return rc;
+    }
+    tmp_buffer_size_ = bytes;
+    UpdatePeakBytes();
+
+    return RC_SUCCESS;
+}
+
+uint64_t RuntimeX86Device::DoTrimMemory(uint64_t keep_bytes) {
+    // the shared tmp buffer is reserved again at the end of the next run that needs it
+    uint64_t released_bytes = 0;
+    if (tmp_buffer_size_ > 0 && !tmp_buffer_in_use_) {
+        X86Device::Free(&shared_tmp_buffer_);
+        released_bytes = tmp_buffer_size_;
+        tmp_buffer_size_ = 0;
+    }
+
+    released_bytes += buffer_manager_->Trim(keep_bytes);
+    LOG(DEBUG) << "buffer manager[" << buffer_manager_->GetName() << "] released [" << released_bytes
+               << "] bytes. [" << buffer_manager_->GetUsedBytes() << "] of [" << buffer_manager_->GetBufferedBytes()
+               << "] bytes are in use.";
+    return released_bytes;
+}
+
+RetCode RuntimeX86Device::GetMemoryStatistics(DeviceMemoryStatistics* stat) {
+    lock_guard<mutex> lck(mutex_);
+    stat->buffered_bytes = buffer_manager_->GetBufferedBytes() + tmp_buffer_size_;
+    stat->used_bytes = buffer_manager_->GetUsedBytes() + tmp_buffer_size_;
+    stat->peak_used_bytes = peak_used_bytes_;
+    stat->max_tmp_buffer_bytes = max_tmp_buffer_bytes_;
+    stat->largest_free_block_bytes = buffer_manager_->GetLargestFreeBlockBytes();
+    return RC_SUCCESS;
+}
+
+/*
+  memory is kept for the peak of used bytes. a run with a larger peak raises it, and after `auto_trim_runs_`
+  consecutive runs below it, memory is trimmed to the max peak of these runs, which becomes the new peak.
+*/
+void RuntimeX86Device::AutoTrimMemory() {
+    if (run_peak_bytes_ >= peak_bytes_) {
+        peak_bytes_ = run_peak_bytes_;
+        low_runs_ = 0;
+        low_runs_peak_bytes_ = 0;
+    } else {
+        ++low_runs_;
+        if (run_peak_bytes_ > low_runs_peak_bytes_) {
+            low_runs_peak_bytes_ = run_peak_bytes_;
+        }
+        if (low_runs_ >= auto_trim_runs_) {
+            DoTrimMemory(low_runs_peak_bytes_);
+            peak_bytes_ = low_runs_peak_bytes_;
+            low_runs_ = 0;
+            low_runs_peak_bytes_ = 0;
+        }
     }
+
+    // buffers that are still in use, e.g. outputs, are counted in the next run
+    run_peak_bytes_ = buffer_manager_->GetUsedBytes() + tmp_buffer_size_;
+}
+
+RetCode RuntimeX86Device::Synchronize() {
+    lock_guard<mutex> lck(mutex_);
+
+    auto rc = ReserveTmpBuffer();
+    if (rc != RC_SUCCESS) {
+        return rc;
+    }
+
+    if (static_plan_manager_) {
+        static_plan_manager_->EndOfRun();
+    }
+    if (auto_trim_runs_ > 0) {
+        AutoTrimMemory();
+    }
+    return RC_SUCCESS;
 }
 
 /* -------------------------------------------------------------------------- */
 
-RuntimeX86Device::ConfHandlerFunc RuntimeX86Device::conf_handlers_[];
+RetCode RuntimeX86Device::ConfGetHugePageBytes(RuntimeX86Device* dev, va_list args) {
+    auto bytes = va_arg(args, uint64_t*);
+    *bytes = dev->GetHugePageBytes();
+    if (dev->buffered_allocator_) {
+        *bytes += dev->buffered_allocator_->GetHugePageBytes();
+    }
+    return RC_SUCCESS;
+}
+
+RetCode RuntimeX86Device::ConfTrimMemory(RuntimeX86Device* dev, va_list args) {
+    auto keep_bytes = va_arg(args, uint64_t);
+    auto released_bytes = va_arg(args, uint64_t*);
+
+    auto bytes = dev->TrimMemory(keep_bytes);
+    if (released_bytes) {
+        *released_bytes = bytes;
+    }
+    return RC_SUCCESS;
+}
+
+RetCode RuntimeX86Device::ConfSetAutoTrimRuns(RuntimeX86Device* dev, va_list args) {
+    lock_guard<mutex> lck(dev->mutex_);
+    dev->auto_trim_runs_ = va_arg(args, uint32_t);
+    dev->low_runs_ = 0;
+    dev->low_runs_peak_bytes_ = 0;
+    dev->peak_bytes_ = dev->buffer_manager_->GetUsedBytes() + dev->tmp_buffer_size_;
+    dev->run_peak_bytes_ = dev->peak_bytes_;
+    return RC_SUCCESS;
+}
+
+RetCode RuntimeX86Device::ConfSetThreads(RuntimeX86Device* dev, va_list args) {
+    auto thread_num = va_arg(args, uint32_t);
+    auto cpu_ids = va_arg(args, const int32_t*);
+    auto cpu_num = va_arg(args, uint32_t);
+    return dev->SetThreads(thread_num, cpu_ids, cpu_num);
+}
+
+RuntimeX86Device::ConfHandlerFunc RuntimeX86Device::conf_handlers_[] = {
+    RuntimeX86Device::ConfGetHugePageBytes,
+    RuntimeX86Device::ConfTrimMemory,
+    RuntimeX86Device::ConfSetAutoTrimRuns,
+    RuntimeX86Device::ConfSetThreads,
+};
 
 RetCode RuntimeX86Device::Configure(uint32_t option, ...) {
     if (option >= DEV_CONF_MAX) {
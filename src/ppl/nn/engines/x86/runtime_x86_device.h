@@ -21,8 +21,11 @@
 #include "ppl/nn/engines/x86/x86_device.h"
 #include "ppl/nn/engines/x86/options.h"
 #include "ppl/nn/utils/compact_buffer_manager.h"
+#include "ppl/nn/utils/static_plan_buffer_manager.h"
+#include "ppl/nn/utils/buffered_cpu_allocator.h"
 #include "ppl/common/allocator.h"
 #include <memory>
+#include <mutex>
 
 namespace ppl { namespace nn { namespace x86 {
 
@@ -34,32 +37,104 @@ public:
     ppl::common::RetCode Init(uint32_t mm_policy);
 
     ppl::common::RetCode Realloc(uint64_t bytes, BufferDesc* buffer) override {
-        return buffer_manager_->Realloc(bytes, buffer);
+        std::lock_guard<std::mutex> lck(mutex_);
+        auto rc = buffer_manager_->Realloc(bytes, buffer);
+        UpdatePeakBytes();
+        return rc;
     }
 
     void Free(BufferDesc* buffer) override {
+        std::lock_guard<std::mutex> lck(mutex_);
         buffer_manager_->Free(buffer);
     }
 
     ppl::common::RetCode AllocTmpBuffer(uint64_t bytes, BufferDesc* buffer) override;
     void FreeTmpBuffer(BufferDesc* buffer) override;
 
+    /** @note buffer manager and the shared tmp buffer are protected by `mutex_` */
+    bool IsConcurrentSafe() const override {
+        return true;
+    }
+
+    uint64_t TrimMemory(uint64_t keep_bytes) override {
+        std::lock_guard<std::mutex> lck(mutex_);
+        return DoTrimMemory(keep_bytes);
+    }
+
+    ppl::common::RetCode GetMemoryStatistics(DeviceMemoryStatistics*) override;
+
+    /** @note a run is finished. used by MM_STATIC_PLAN to make or check memory plans and by auto trimming. */
+    ppl::common::RetCode Synchronize() override;
+
     // ----- configurations ----- //
 
+    static ppl::common::RetCode ConfGetHugePageBytes(RuntimeX86Device*, va_list);
+    static ppl::common::RetCode ConfTrimMemory(RuntimeX86Device*, va_list);
+    static ppl::common::RetCode ConfSetAutoTrimRuns(RuntimeX86Device*, va_list);
+    static ppl::common::RetCode ConfSetThreads(RuntimeX86Device*, va_list);
+
     typedef ppl::common::RetCode (*ConfHandlerFunc)(RuntimeX86Device*, va_list);
     static ConfHandlerFunc conf_handlers_[DEV_CONF_MAX];
 
     ppl::common::RetCode Configure(uint32_t, ...) override;
 
+private:
+    void UpdatePeakBytes() {
+        auto bytes = buffer_manager_->GetUsedBytes() + tmp_buffer_size_;
+        if (bytes > peak_used_bytes_) {
+            peak_used_bytes_ = bytes;
+        }
+        if (bytes > run_peak_bytes_) {
+            run_peak_bytes_ = bytes;
+        }
+    }
+    /** @note `mutex_` MUST be held */
+    uint64_t DoTrimMemory(uint64_t keep_bytes);
+    /** @note `mutex_` MUST be held */
+    void AutoTrimMemory();
+    /** @note `mutex_` MUST be held */
+    ppl::common::RetCode ReserveTmpBuffer();
+
 private:
     const uint64_t alignment_;
     uint32_t mm_policy_;
+    /**
+       scratch buffer shared by kernels. it is kept between kernels and runs, and is reserved at the end of a run to
+       the largest requirement of that run, so kernels get the same buffer without calling allocators until shapes
+       change. requests that it cannot serve are allocated by `buffer_manager_`.
+    */
     BufferDesc shared_tmp_buffer_;
     uint64_t tmp_buffer_size_ = 0;
+    /** the largest scratch buffer requested in this run */
+    uint64_t run_max_tmp_buffer_bytes_ = 0;
+    /** kernels may be run concurrently by a parallel scheduler and the shared tmp buffer is occupied */
+    bool tmp_buffer_in_use_ = false;
+    /** protects `buffer_manager_` and the shared tmp buffer */
+    std::mutex mutex_;
     std::unique_ptr<utils::BufferManager> buffer_manager_;
+    /** points to `buffer_manager_` if mm policy is MM_STATIC_PLAN */
+    utils::StaticPlanBufferManager* static_plan_manager_ = nullptr;
     std::shared_ptr<ppl::common::CompactAddrManager::VMAllocator> vmr_;
+    /** points to `vmr_` if mm policy is MM_COMPACT or MM_STATIC_PLAN */
+    utils::BufferedCpuAllocator* buffered_allocator_ = nullptr;
     std::shared_ptr<ppl::common::Allocator> allocator_;
 
+    // ----- statistics ----- //
+
+    uint64_t peak_used_bytes_ = 0;
+    uint64_t max_tmp_buffer_bytes_ = 0;
+
+    // ----- auto trimming ----- //
+
+    uint32_t auto_trim_runs_ = 0;
+    /** number of consecutive runs whose peaks are less than `peak_bytes_` */
+    uint32_t low_runs_ = 0;
+    /** peak of used bytes that buffered memory is kept for */
+    uint64_t peak_bytes_ = 0;
+    /** max peak of the last `low_runs_` runs */
+    uint64_t low_runs_peak_bytes_ = 0;
+    uint64_t run_peak_bytes_ = 0;
+
 private:
     RuntimeX86Device(const RuntimeX86Device&) = delete;
     RuntimeX86Device& operator=(const RuntimeX86Device&) = delete;
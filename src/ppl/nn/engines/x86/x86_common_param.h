@@ -18,12 +18,15 @@
 #ifndef _ST_HPC_PPL_NN_ENGINES_X86_X86_COMMON_PARAM_H_
 #define _ST_HPC_PPL_NN_ENGINES_X86_X86_COMMON_PARAM_H_
 
+#include "ppl/nn/engines/x86/constant_cache.h"
 #include <stdint.h>
 
 namespace ppl { namespace nn { namespace x86 {
 
 struct X86CommonParam {
     std::vector<ppl::common::dataformat_t> output_formats;
+    /** indexed by inputs. inputs that are loaded by X86Kernel before execution are not null. */
+    std::vector<std::shared_ptr<ConstantCache::Entry>> lazy_constants;
 };
 
 }}} // namespace ppl::nn::x86
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/x86_cpu_allocator.h"
+#include "ppl/nn/common/logger.h"
+
+#ifdef __linux__
+#include <string.h> // strerror
+#include <errno.h>
+#include <sys/mman.h>
+#endif
+
+#if defined(__linux__) && defined(PPLNN_USE_NUMA)
+#include <numa.h>
+#endif
+
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace x86 {
+
+bool IsNumaNodeAvailable(int32_t numa_node_id) {
+    if (numa_node_id < 0) {
+        return false;
+    }
+#if defined(__linux__) && defined(PPLNN_USE_NUMA)
+    if (numa_available() < 0) {
+        LOG(WARNING) << "NUMA API check failed. current system not support NUMA API. numa node [" << numa_node_id
+                     << "] is ignored.";
+        return false;
+    }
+    const int32_t max_numa_node_id = numa_max_node();
+    if (max_numa_node_id == 0) {
+        LOG(INFO) << "only one numa node is found. numa node [" << numa_node_id << "] is ignored.";
+        return false;
+    }
+    if (numa_node_id > max_numa_node_id) {
+        LOG(WARNING) << "numa node [" << numa_node_id << "] > max numa node [" << max_numa_node_id
+                     << "]. will not bind numa node.";
+        return false;
+    }
+    return true;
+#else
+    LOG(WARNING) << "current build does not support NUMA. numa node [" << numa_node_id << "] is ignored.";
+    return false;
+#endif
+}
+
+RetCode GetNumaNodeCpus(int32_t numa_node_id, vector<int32_t>* cpu_ids) {
+#if defined(__linux__) && defined(PPLNN_USE_NUMA)
+    auto mask = numa_allocate_cpumask();
+    if (!mask) {
+        LOG(ERROR) << "allocate cpu mask failed.";
+        return RC_OUT_OF_MEMORY;
+    }
+
+    if (numa_node_to_cpus(numa_node_id, mask) != 0) {
+        LOG(ERROR) << "get cpus of numa node [" << numa_node_id << "] failed.";
+        numa_free_cpumask(mask);
+        return RC_OTHER_ERROR;
+    }
+
+    for (uint32_t i = 0; i < mask->size; ++i) {
+        if (numa_bitmask_isbitset(mask, i)) {
+            cpu_ids->push_back(i);
+        }
+    }
+
+    numa_free_cpumask(mask);
+    return RC_SUCCESS;
+#else
+    return RC_UNSUPPORTED;
+#endif
+}
+
+void BindMemoryToNumaNode(void* addr, uint64_t bytes, int32_t numa_node_id) {
+#if defined(__linux__) && defined(PPLNN_USE_NUMA)
+    // memory policies are set on whole pages
+    const uintptr_t page_size = numa_pagesize();
+    const uintptr_t begin = (uintptr_t)addr & ~(page_size - 1);
+    const uintptr_t end = ((uintptr_t)addr + bytes + page_size - 1) & ~(page_size - 1);
+    numa_tonode_memory((void*)begin, end - begin, numa_node_id);
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static inline uint64_t Align(uint64_t x, uint64_t n) {
+    return (x + n - 1) & (~(n - 1));
+}
+
+X86CpuAllocator::~X86CpuAllocator() {
+#ifdef __linux__
+    for (auto it = huge_page_blocks_.begin(); it != huge_page_blocks_.end(); ++it) {
+        munmap(it->first, it->second.bytes);
+    }
+#endif
+}
+
+void* X86CpuAllocator::AllocHugePages(uint64_t bytes) {
+#ifdef __linux__
+    bytes = Align(bytes, utils::HUGE_PAGE_SIZE);
+
+#ifdef MAP_HUGETLB
+    if (huge_page_policy_ == HUGE_PAGE_HUGETLB) {
+        auto addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr != MAP_FAILED) {
+            lock_guard<mutex> lck(mutex_);
+            huge_page_blocks_[addr] = HugePageBlock{bytes, true};
+            return addr;
+        }
+        LOG(DEBUG) << "mmap [" << bytes << "] bytes of hugetlb pages failed: " << strerror(errno)
+                   << ". use transparent huge pages instead.";
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    // maps one more huge page to align the block
+    auto addr = mmap(nullptr, bytes + utils::HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                     0);
+    if (addr == MAP_FAILED) {
+        LOG(ERROR) << "mmap [" << bytes + utils::HUGE_PAGE_SIZE << "] bytes failed: " << strerror(errno);
+        return nullptr;
+    }
+
+    auto base = (char*)Align((uintptr_t)addr, utils::HUGE_PAGE_SIZE);
+    const uint64_t head_bytes = base - (char*)addr;
+    if (head_bytes > 0) {
+        munmap(addr, head_bytes);
+    }
+    munmap(base + bytes, utils::HUGE_PAGE_SIZE - head_bytes);
+
+    if (madvise(base, bytes, MADV_HUGEPAGE) != 0) {
+        LOG(DEBUG) << "madvise(MADV_HUGEPAGE) failed: " << strerror(errno);
+    }
+
+    lock_guard<mutex> lck(mutex_);
+    huge_page_blocks_[base] = HugePageBlock{bytes, false};
+    return base;
+#endif
+#endif
+
+    return nullptr;
+}
+
+void* X86CpuAllocator::Alloc(uint64_t bytes) {
+    void* addr = nullptr;
+    if (huge_page_policy_ != HUGE_PAGE_NONE && bytes >= utils::HUGE_PAGE_SIZE) {
+        addr = AllocHugePages(bytes);
+    }
+    if (!addr) {
+        addr = allocator_.Alloc(bytes);
+    }
+
+    if (addr && numa_node_id_ >= 0) {
+        BindMemoryToNumaNode(addr, bytes, numa_node_id_);
+    }
+    return addr;
+}
+
+void X86CpuAllocator::Free(void* addr) {
+#ifdef __linux__
+    if (huge_page_policy_ != HUGE_PAGE_NONE) {
+        unique_lock<mutex> lck(mutex_);
+        auto ref = huge_page_blocks_.find(addr);
+        if (ref != huge_page_blocks_.end()) {
+            const uint64_t bytes = ref->second.bytes;
+            huge_page_blocks_.erase(ref);
+            lck.unlock();
+            munmap(addr, bytes);
+            return;
+        }
+    }
+#endif
+    allocator_.Free(addr);
+}
+
+uint64_t X86CpuAllocator::GetHugePageBytes() const {
+    uint64_t hugetlb_bytes = 0;
+    vector<pair<const void*, uint64_t>> thp_ranges;
+    {
+        lock_guard<mutex> lck(mutex_);
+        for (auto it = huge_page_blocks_.begin(); it != huge_page_blocks_.end(); ++it) {
+            if (it->second.is_hugetlb) {
+                hugetlb_bytes += it->second.bytes;
+            } else {
+                thp_ranges.push_back(make_pair(it->first, it->second.bytes));
+            }
+        }
+    }
+
+    if (thp_ranges.empty()) {
+        return hugetlb_bytes;
+    }
+    return hugetlb_bytes + utils::GetTransparentHugePageBytes(thp_ranges);
+}
+
+}}} // namespace ppl::nn::x86
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_ENGINES_X86_X86_CPU_ALLOCATOR_H_
+#define _ST_HPC_PPL_NN_ENGINES_X86_X86_CPU_ALLOCATOR_H_
+
+#include "ppl/common/retcode.h"
+#include "ppl/common/generic_cpu_allocator.h"
+#include "ppl/nn/utils/huge_page.h"
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace ppl { namespace nn { namespace x86 {
+
+/**
+   @brief tells whether memory and threads can be bound to `numa_node_id`.
+   @note returns false if the system has only one numa node or pplnn is built without `PPLNN_USE_NUMA`.
+*/
+bool IsNumaNodeAvailable(int32_t numa_node_id);
+
+ppl::common::RetCode GetNumaNodeCpus(int32_t numa_node_id, std::vector<int32_t>* cpu_ids);
+
+/** @brief pages in [addr, addr + bytes) that are not touched yet will be allocated on `numa_node_id` */
+void BindMemoryToNumaNode(void* addr, uint64_t bytes, int32_t numa_node_id);
+
+/**
+   @brief allocator of x86 devices. allocated memory is bound to a numa node if it is set, and blocks that are
+   not less than `utils::HUGE_PAGE_SIZE` are backed by huge pages according to the huge page policy.
+*/
+class X86CpuAllocator final : public ppl::common::Allocator {
+public:
+    X86CpuAllocator(uint64_t alignment) : allocator_(alignment) {}
+    ~X86CpuAllocator();
+
+    /** @param numa_node_id should be checked by `IsNumaNodeAvailable()`. -1 means not binding. */
+    void SetNumaNode(int32_t numa_node_id) {
+        numa_node_id_ = numa_node_id;
+    }
+    int32_t GetNumaNode() const {
+        return numa_node_id_;
+    }
+
+    /** @param policy `HUGE_PAGE_*` in `ppl/nn/common/huge_page.h` */
+    void SetHugePagePolicy(uint32_t policy) {
+        huge_page_policy_ = policy;
+    }
+    uint32_t GetHugePagePolicy() const {
+        return huge_page_policy_;
+    }
+
+    /** @brief bytes of blocks in use that are backed by huge pages */
+    uint64_t GetHugePageBytes() const;
+
+    void* Alloc(uint64_t bytes) override;
+    void Free(void* addr) override;
+
+private:
+    void* AllocHugePages(uint64_t bytes);
+
+private:
+    struct HugePageBlock final {
+        uint64_t bytes;
+        bool is_hugetlb;
+    };
+
+    int32_t numa_node_id_ = -1;
+    uint32_t huge_page_policy_ = HUGE_PAGE_NONE;
+    ppl::common::GenericCpuAllocator allocator_;
+
+    mutable std::mutex mutex_;
+    /** blocks mapped by AllocHugePages() */
+    std::map<void*, HugePageBlock> huge_page_blocks_;
+
+private:
+    X86CpuAllocator(const X86CpuAllocator&) = delete;
+    X86CpuAllocator& operator=(const X86CpuAllocator&) = delete;
+};
+
+}}} // namespace ppl::nn::x86
+
+#endif
@@ -16,11 +16,15 @@
 // under the License.
 
 #include "ppl/nn/engines/x86/x86_device.h"
+#include "ppl/nn/engines/x86/options.h"
+#include "ppl/nn/common/logger.h"
 #include "ppl/kernel/x86/common/cast.h"
 #include "ppl/kernel/x86/fp32/reorder.h"
 #include "ppl/kernel/x86/int64/reorder.h"
 #include <cstring> // memcpy
+#include <stdarg.h>
 #include <vector>
+using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace x86 {
@@ -111,4 +115,31 @@ RetCode X86Device::ConvertFromHostAsync(BufferDesc* dst, const TensorShape& dst_
     return ConvertFromHost(dst, dst_desc, src, src_desc, dst_info);
 }
 
+RetCode X86Device::SetThreads(uint32_t thread_num, const int32_t* cpu_ids, uint32_t cpu_num) {
+    if (!thread_pool_) {
+        LOG(ERROR) << "threads of this device cannot be set.";
+        return RC_UNSUPPORTED;
+    }
+    return thread_pool_->Init(thread_num, vector<int32_t>(cpu_ids, cpu_ids + cpu_num));
+}
+
+RetCode X86Device::BindCpus(const uint32_t* cpu_ids, uint32_t cpu_num) {
+    return SetThreads(0, (const int32_t*)cpu_ids, cpu_num);
+}
+
+RetCode X86Device::Configure(uint32_t option, ...) {
+    if (option != DEV_CONF_SET_THREADS) {
+        return RC_UNSUPPORTED;
+    }
+
+    va_list args;
+    va_start(args, option);
+    auto thread_num = va_arg(args, uint32_t);
+    auto cpu_ids = va_arg(args, const int32_t*);
+    auto cpu_num = va_arg(args, uint32_t);
+    va_end(args);
+
+    return SetThreads(thread_num, cpu_ids, cpu_num);
+}
+
 }}} // namespace ppl::nn::x86
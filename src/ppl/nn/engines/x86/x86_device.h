@@ -19,14 +19,15 @@
 #define _ST_HPC_PPL_NN_ENGINES_X86_X86_DEVICE_H_
 
 #include "ppl/nn/common/device.h"
-#include "ppl/common/generic_cpu_allocator.h"
+#include "ppl/nn/engines/x86/omp_thread_pool.h"
+#include "ppl/nn/engines/x86/x86_cpu_allocator.h"
 #include <cstring> // memcpy
 
 namespace ppl { namespace nn { namespace x86 {
 
 class X86Device : public Device {
 public:
-    X86Device(uint64_t alignment, ppl::common::isa_t isa) : isa_(isa), allocator_(alignment) {
+    X86Device(uint64_t alignment, ppl::common::isa_t isa) : alignment_(alignment), isa_(isa), allocator_(alignment) {
         *(uint64_t*)(type_.str) = 0;
         type_.str[0] = 'c';
         type_.str[1] = 'p';
@@ -48,6 +49,36 @@ public:
         Free(buffer);
     }
 
+    /** @brief threads used by kernels running on this device. nullptr means using the global setting. */
+    void SetThreadPool(OmpThreadPool* pool) {
+        thread_pool_ = pool;
+    }
+    const OmpThreadPool* GetThreadPool() const {
+        return thread_pool_;
+    }
+    /** @brief changes threads used by kernels running on this device. see `DEV_CONF_SET_THREADS`. */
+    ppl::common::RetCode SetThreads(uint32_t thread_num, const int32_t* cpu_ids, uint32_t cpu_num);
+    ppl::common::RetCode BindCpus(const uint32_t* cpu_ids, uint32_t cpu_num) override;
+
+    /** @brief memory allocated by this device is bound to `numa_node_id`. -1 means not binding. */
+    void SetNumaNode(int32_t numa_node_id) {
+        allocator_.SetNumaNode(numa_node_id);
+    }
+    int32_t GetNumaNode() const {
+        return allocator_.GetNumaNode();
+    }
+
+    /** @brief huge page policy of memory allocated by this device, see `HUGE_PAGE_*` in `ppl/nn/common/huge_page.h`. */
+    void SetHugePagePolicy(uint32_t policy) {
+        allocator_.SetHugePagePolicy(policy);
+    }
+    uint32_t GetHugePagePolicy() const {
+        return allocator_.GetHugePagePolicy();
+    }
+    uint64_t GetHugePageBytes() const {
+        return allocator_.GetHugePageBytes();
+    }
+
     ppl::common::Allocator* GetAllocator() const {
         return &allocator_;
     }
@@ -78,6 +109,10 @@ public:
         }
     }
 
+    bool CanUseHostBuffer(const void* addr) const override final {
+        return ((uintptr_t)addr % alignment_ == 0);
+    }
+
     ppl::common::RetCode Realloc(const TensorShape& shape, BufferDesc* buffer) override final {
         return Realloc(shape.CalcBytesIncludingPadding(), buffer);
     }
@@ -120,7 +155,7 @@ public:
         return Copy(dst, src, shape.CalcBytesIncludingPadding());
     }
 
-    ppl::common::RetCode Synchronize() override final {
+    ppl::common::RetCode Synchronize() override {
         return ppl::common::RC_SUCCESS;
     }
 
@@ -146,9 +181,8 @@ public:
         return type_;
     }
 
-    ppl::common::RetCode Configure(uint32_t, ...) override {
-        return ppl::common::RC_UNSUPPORTED;
-    }
+    /** @brief only `DEV_CONF_SET_THREADS` is supported */
+    ppl::common::RetCode Configure(uint32_t, ...) override;
 
 private:
     bool MayUseISA(uint32_t flag) const {
@@ -157,8 +191,10 @@ private:
 
 private:
     Type type_;
+    const uint64_t alignment_;
     ppl::common::isa_t isa_;
-    mutable ppl::common::GenericCpuAllocator allocator_;
+    mutable X86CpuAllocator allocator_;
+    OmpThreadPool* thread_pool_ = nullptr;
 };
 
 }}} // namespace ppl::nn::x86
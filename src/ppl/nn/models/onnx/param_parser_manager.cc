@@ -40,6 +40,7 @@
 #include "ppl/nn/models/onnx/parsers/onnx/parse_hard_sigmoid_param.h"
 #include "ppl/nn/models/onnx/parsers/onnx/parse_if_param.h"
 #include "ppl/nn/models/onnx/parsers/onnx/parse_instancenormalization_param.h"
+#include "ppl/nn/models/onnx/parsers/onnx/parse_layer_normalization_param.h"
 #include "ppl/nn/models/onnx/parsers/onnx/parse_leaky_relu_param.h"
 #include "ppl/nn/models/onnx/parsers/onnx/parse_loop_param.h"
 #include "ppl/nn/models/onnx/parsers/onnx/parse_lrn_param.h"
@@ -187,6 +188,8 @@ ParamParserManager::ParamParserManager() {
     PPL_REGISTER_OP_WITH_PARAM("", "InstanceNormalization", 6, 16, InstanceNormalizationParam,
                                ParseInstanceNormalizationParam, PackInstanceNormalizationParam);
     // L
+    PPL_REGISTER_OP_WITH_PARAM("", "LayerNormalization", 17, 17, LayerNormalizationParam, ParseLayerNormalizationParam,
+                               PackLayerNormalizationParam);
     PPL_REGISTER_OP_WITH_PARAM("", "LeakyRelu", 6, 16, LeakyReluParam, ParseLeakyReluParam, PackLeakyReluParam);
     PPL_REGISTER_OP_WITHOUT_PARAM("", "Less", 7, 16, nullptr);
     PPL_REGISTER_OP_WITHOUT_PARAM("", "Log", 6, 16, nullptr);
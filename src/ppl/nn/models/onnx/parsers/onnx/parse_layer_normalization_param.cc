@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/models/onnx/parsers/onnx/parse_layer_normalization_param.h"
+#include "ppl/nn/models/onnx/utils.h"
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace onnx {
+
+RetCode ParseLayerNormalizationParam(const ::onnx::NodeProto& pb_node, const ParamParserExtraArgs& args, ir::Node*,
+                                     ir::Attr* arg) {
+    auto param = static_cast<LayerNormalizationParam*>(arg);
+    utils::GetNodeAttr(pb_node, "axis", &param->axis, -1);
+    utils::GetNodeAttr(pb_node, "epsilon", &param->epsilon, 1e-5);
+    utils::GetNodeAttr(pb_node, "stash_type", &param->stash_type, 1);
+    return RC_SUCCESS;
+}
+
+RetCode PackLayerNormalizationParam(const ir::Node*, const ir::Attr* arg, ::onnx::NodeProto* pb_node) {
+    auto param = static_cast<const LayerNormalizationParam*>(arg);
+    utils::SetNodeAttr(pb_node, "axis", param->axis);
+    utils::SetNodeAttr(pb_node, "epsilon", param->epsilon);
+    utils::SetNodeAttr(pb_node, "stash_type", param->stash_type);
+    return RC_SUCCESS;
+}
+
+}}} // namespace ppl::nn::onnx
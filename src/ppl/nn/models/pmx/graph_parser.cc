@@ -144,14 +144,20 @@ static RetCode ParseGraphDataShapes(const GraphData* fb_data, map<edgeid_t, Tens
 
 class PmxConstantVisitor final : public ConstantVisitor {
 public:
+    /** @param mapped_files keeps mappings of external data files if not null, which means data are persistent. */
     PmxConstantVisitor(const ir::GraphTopo* topo, const uint8_t* shared_data, const RuntimeGraphInfo* info,
                        const flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::Constant>>* fb_constants,
-                       const string& external_data_dir)
+                       const string& external_data_dir, vector<shared_ptr<Mmap>>* mapped_files)
         : topo_(topo)
         , shared_data_(shared_data)
         , info_(info)
         , fb_constants_(fb_constants)
-        , external_data_dir_(external_data_dir) {}
+        , external_data_dir_(external_data_dir)
+        , mapped_files_(mapped_files) {}
+
+    bool IsDataPersistent() const override {
+        return (mapped_files_ != nullptr);
+    }
 
     RetCode ForEach(const function<RetCode(edgeid_t, uint64_t)>& f) const override {
         for (auto fb_constant = fb_constants_->begin(); fb_constant != fb_constants_->end(); ++fb_constant) {
@@ -207,17 +213,20 @@ public:
                         string((const char*)shared_data_ + fb_constant->data_offset(), fb_constant->data_bytes());
                 }
 
-                Mmap fm;
-                auto rc = fm.Init(path.c_str(), Mmap::READ);
+                auto fm = make_shared<Mmap>();
+                auto rc = fm->Init(path.c_str(), Mmap::READ);
                 if (rc != RC_SUCCESS) {
                     LOG(ERROR) << "open external data file [" << path << "] failed.";
                     return rc;
                 }
-                rc = f(edge, fm.GetData(), fm.GetSize(), shape_ref->second);
+                rc = f(edge, fm->GetData(), fm->GetSize(), shape_ref->second);
                 if (rc != RC_SUCCESS) {
                     LOG(ERROR) << "load constant from [" << path << "] failed.";
                     return rc;
                 }
+                if (mapped_files_) {
+                    mapped_files_->push_back(fm);
+                }
             } else {
                 auto rc =
                     f(edge, shared_data_ + fb_constant->data_offset(), fb_constant->data_bytes(), shape_ref->second);
@@ -236,11 +245,12 @@ private:
     const RuntimeGraphInfo* info_;
     const flatbuffers::Vector<flatbuffers::Offset<ppl::nn::pmx::Constant>>* fb_constants_;
     const string& external_data_dir_;
+    vector<shared_ptr<Mmap>>* mapped_files_;
 };
 
 static RetCode ParseGraphDataPartitions(const GraphData* fb_data, const ir::GraphTopo* topo,
                                         const vector<EngineImpl*>& seq2engine, const LoadModelOptions& opt,
-                                        RuntimeGraphInfo* info) {
+                                        bool is_data_persistent, RuntimeGraphInfo* info) {
     auto fb_partitions = fb_data->partitions();
     info->partitions.reserve(fb_partitions->size());
 
@@ -257,7 +267,7 @@ static RetCode ParseGraphDataPartitions(const GraphData* fb_data, const ir::Grap
         partition.engine = engine;
 
         PmxConstantVisitor visitor(topo, fb_data->shared_data()->data(), info, fb_partition->constants(),
-                                   external_data_dir);
+                                   external_data_dir, is_data_persistent ? &info->mapped_files : nullptr);
         auto status = engine->LoadConstants(visitor, &partition.constants);
         if (status != RC_SUCCESS) {
             LOG(ERROR) << "LoadConstants of engine[" << engine->GetName() << "] failed: " << GetRetCodeStr(status);
@@ -298,14 +308,14 @@ static RetCode ParseGraphDataPartitions(const GraphData* fb_data, const ir::Grap
 
 static RetCode ParseGraphData(const GraphData* fb_data, const ir::GraphTopo* topo,
                               const vector<EngineImpl*>& seq2engine, const LoadModelOptions& opt,
-                              RuntimeGraphInfo* info) {
+                              bool is_data_persistent, RuntimeGraphInfo* info) {
     auto status = ParseGraphDataShapes(fb_data, &info->shapes);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "ParseGraphDataShapes failed: " << GetRetCodeStr(status);
         return status;
     }
 
-    status = ParseGraphDataPartitions(fb_data, topo, seq2engine, opt, info);
+    status = ParseGraphDataPartitions(fb_data, topo, seq2engine, opt, is_data_persistent, info);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "ParseGraphDataPartitions failed: " << GetRetCodeStr(status);
         return status;
@@ -315,14 +325,14 @@ static RetCode ParseGraphData(const GraphData* fb_data, const ir::GraphTopo* top
 }
 
 RetCode GraphParser::Parse(const Graph* fb_graph, const vector<EngineImpl*>& seq2engine, const LoadModelOptions& opt,
-                           ir::GraphTopo* topo, RuntimeGraphInfo* info) {
+                           bool is_data_persistent, ir::GraphTopo* topo, RuntimeGraphInfo* info) {
     auto status = ParseGraphTopo(fb_graph->topo(), topo);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "ParseGraphTopo failed: " << GetRetCodeStr(status);
         return status;
     }
 
-    status = ParseGraphData(fb_graph->data(), topo, seq2engine, opt, info);
+    status = ParseGraphData(fb_graph->data(), topo, seq2engine, opt, is_data_persistent, info);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "ParseGraphData failed: " << GetRetCodeStr(status);
         return status;
@@ -28,8 +28,12 @@ namespace ppl { namespace nn { namespace pmx {
 
 class GraphParser final {
 public:
+    /**
+       @param is_data_persistent tells whether data of `Graph` stays valid until all runtimes using `RuntimeGraphInfo`
+       are released. if so, constants may refer to it and external data files instead of making a copy.
+    */
     static ppl::common::RetCode Parse(const Graph*, const std::vector<EngineImpl*>&, const LoadModelOptions&,
-                                      ir::GraphTopo*, RuntimeGraphInfo*);
+                                      bool is_data_persistent, ir::GraphTopo*, RuntimeGraphInfo*);
 };
 
 }}} // namespace ppl::nn::pmx
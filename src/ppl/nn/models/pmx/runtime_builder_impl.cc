@@ -80,6 +80,11 @@ static void SetResources(const RuntimeBuilder::Resources& src, utils::SharedReso
 
 RetCode RuntimeBuilderImpl::LoadModel(const char* model_buf, uint64_t buf_len, const Resources& resources,
                                       const LoadModelOptions& opt) {
+    return DoLoadModel(model_buf, buf_len, resources, opt, false);
+}
+
+RetCode RuntimeBuilderImpl::DoLoadModel(const char* model_buf, uint64_t buf_len, const Resources& resources,
+                                        const LoadModelOptions& opt, bool is_model_buf_persistent) {
     RetCode status;
 
     auto fb_model = pmx::GetModel(model_buf);
@@ -100,7 +105,8 @@ RetCode RuntimeBuilderImpl::LoadModel(const char* model_buf, uint64_t buf_len, c
         return status;
     }
 
-    status = GraphParser::Parse(fb_model->graph(), seq2engine, opt, topo_.get(), graph_info_.get());
+    status = GraphParser::Parse(fb_model->graph(), seq2engine, opt, is_model_buf_persistent, topo_.get(),
+                                graph_info_.get());
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "parse graph failed: " << GetRetCodeStr(status);
         return status;
@@ -110,12 +116,14 @@ RetCode RuntimeBuilderImpl::LoadModel(const char* model_buf, uint64_t buf_len, c
 }
 
 RetCode RuntimeBuilderImpl::LoadModel(const char* model_file, const Resources& resources, const LoadModelOptions& opt) {
-    Mmap fm;
-    auto status = fm.Init(model_file, Mmap::READ);
+    // the mapping is kept by runtimes so that constants can refer to it directly
+    auto fm = make_shared<Mmap>();
+    auto status = fm->Init(model_file, Mmap::READ);
     if (status != RC_SUCCESS) {
         LOG(ERROR) << "mapping file [" << model_file << "] faild.";
         return status;
     }
+    graph_info_->mapped_files.push_back(fm);
 
     string model_dir;
     LoadModelOptions new_opt;
@@ -136,7 +144,7 @@ RetCode RuntimeBuilderImpl::LoadModel(const char* model_file, const Resources& r
         new_opt.external_data_dir = model_dir.c_str();
     }
 
-    return LoadModel(fm.GetData(), fm.GetSize(), resources, *opt_ptr);
+    return DoLoadModel(fm->GetData(), fm->GetSize(), resources, *opt_ptr, true);
 }
 
 RetCode RuntimeBuilderImpl::Preprocess() {
@@ -41,6 +41,11 @@ public:
     Runtime* CreateRuntime() const override;
     ppl::common::RetCode Serialize(const char* fmt, const void* options, utils::DataStream*) const override;
 
+private:
+    /** @param is_model_buf_persistent `model_buf` stays valid until all runtimes are released */
+    ppl::common::RetCode DoLoadModel(const char* model_buf, uint64_t buf_len, const Resources&,
+                                     const LoadModelOptions&, bool is_model_buf_persistent);
+
 private:
     utils::SharedResource resource_;
     std::shared_ptr<ir::GraphTopo> topo_;
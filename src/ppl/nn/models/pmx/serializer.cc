@@ -203,6 +203,16 @@ static RetCode CreateFbShapes(FlatBufferBuilder* builder, const SerializationCon
     return RC_SUCCESS;
 }
 
+/*
+  offsets of constants are aligned to `g_data_alignment` so that constants can be used in place after models are
+  mapped into memory.
+*/
+static constexpr uint64_t g_data_alignment = 64;
+
+static inline uint64_t Align(uint64_t x, uint64_t n) {
+    return (x + n - 1) & (~(n - 1));
+}
+
 // returns data offset
 static uint64_t FindOrInsertData(const vector<uint8_t>& data, vector<uint8_t>* shared_data,
                                  vector<pair<uint64_t, uint64_t>>* shared_data_items) {
@@ -215,8 +225,8 @@ static uint64_t FindOrInsertData(const vector<uint8_t>& data, vector<uint8_t>* s
         }
     }
 
-    auto new_data_item = pair<uint64_t, uint64_t>(shared_data->size(), data.size());
-    shared_data->resize(shared_data->size() + data.size());
+    auto new_data_item = pair<uint64_t, uint64_t>(Align(shared_data->size(), g_data_alignment), data.size());
+    shared_data->resize(new_data_item.first + data.size());
     memcpy(shared_data->data() + new_data_item.first, data.data(), data.size());
     shared_data_items->push_back(new_data_item);
     return new_data_item.first;
@@ -425,6 +435,7 @@ static RetCode CreateFbGraphData(FlatBufferBuilder* builder, const SaveModelOpti
         return RC_UNSUPPORTED;
     }
 
+    builder->ForceVectorAlignment(shared_data.size(), sizeof(uint8_t), g_data_alignment);
     auto fb_shared_data = builder->CreateVector(shared_data);
     *fb_data = CreateGraphData(*builder, fb_shapes, fb_partitions, fb_shared_data);
     return RC_SUCCESS;
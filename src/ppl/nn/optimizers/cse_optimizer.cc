@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/optimizers/cse_optimizer.h"
+#include "ppl/nn/optimizers/utils.h"
+#include "ppl/nn/common/logger.h"
+#include <set>
+#include <map>
+#include <vector>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+/** larger constants are unlikely to be duplicated, and comparing them is costly */
+static constexpr uint64_t MAX_MERGED_CONSTANT_BYTES = 1024;
+
+template <typename T>
+static void AppendValue(const T& value, string* key) {
+    key->append((const char*)&value, sizeof(value));
+}
+
+/** @brief replaces `from` with `to` in consumers of `from` */
+static void ReplaceEdge(ir::GraphTopo* topo, ir::Edge* from, ir::Edge* to) {
+    for (auto it = from->CreateConsumerIter(); it.IsValid(); it.Forward()) {
+        auto consumer = topo->GetNode(it.Get());
+        consumer->ReplaceInput(from->GetId(), to->GetId());
+        consumer->ReplaceExtraInput(from->GetId(), to->GetId());
+        to->AddConsumer(consumer->GetId());
+    }
+}
+
+static uint32_t MergeConstants(ir::Graph* graph, const set<edgeid_t>& graph_outputs) {
+    auto topo = graph->topo.get();
+    auto& constants = graph->data->constants;
+    auto& shapes = graph->data->shapes;
+
+    // shape and data => the first constant
+    map<string, edgeid_t> key2eid;
+    vector<edgeid_t> merged_constants;
+    for (uint32_t i = 0; i < topo->GetConstantCount(); ++i) {
+        auto eid = topo->GetConstant(i);
+        auto constant_ref = constants.find(eid);
+        auto shape_ref = shapes.find(eid);
+        if (constant_ref == constants.end() || shape_ref == shapes.end() ||
+            constant_ref->second.data.GetSize() > MAX_MERGED_CONSTANT_BYTES ||
+            graph_outputs.find(eid) != graph_outputs.end()) {
+            continue;
+        }
+
+        auto& shape = shape_ref->second;
+        string key;
+        AppendValue(shape.data_type, &key);
+        AppendValue(shape.data_format, &key);
+        AppendValue(shape.dims.size(), &key);
+        for (auto d = shape.dims.begin(); d != shape.dims.end(); ++d) {
+            AppendValue(*d, &key);
+        }
+        key.append((const char*)constant_ref->second.data.GetData(), constant_ref->second.data.GetSize());
+
+        auto ret_pair = key2eid.insert(make_pair(key, eid));
+        if (!ret_pair.second) {
+            ReplaceEdge(topo, topo->GetEdge(eid), topo->GetEdge(ret_pair.first->second));
+            merged_constants.push_back(eid);
+        }
+    }
+
+    // constants cannot be deleted when iterating over them
+    for (auto it = merged_constants.begin(); it != merged_constants.end(); ++it) {
+        constants.erase(*it);
+        shapes.erase(*it);
+        topo->DelEdge(*it);
+    }
+
+    return merged_constants.size();
+}
+
+static bool HasSameAttr(const ir::GraphData* data, nodeid_t nid0, nodeid_t nid1) {
+    auto attr_ref0 = data->attrs.find(nid0);
+    auto attr_ref1 = data->attrs.find(nid1);
+    if (attr_ref0 == data->attrs.end() || attr_ref1 == data->attrs.end()) {
+        return (attr_ref0 == data->attrs.end() && attr_ref1 == data->attrs.end());
+    }
+    return attr_ref0->second->Equals(attr_ref1->second.get());
+}
+
+/** @brief `node` is replaced by `target`, which has the same type, attributes and inputs */
+static void MergeNode(ir::Graph* graph, ir::Node* node, ir::Node* target) {
+    auto topo = graph->topo.get();
+
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        auto edge = topo->GetEdge(node->GetInput(i));
+        if (edge) {
+            edge->DelConsumer(node->GetId());
+        }
+    }
+    for (uint32_t i = 0; i < node->GetExtraInputCount(); ++i) {
+        auto edge = topo->GetEdge(node->GetExtraInput(i));
+        if (edge) {
+            edge->DelConsumer(node->GetId());
+        }
+    }
+
+    for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+        auto eid = node->GetOutput(i);
+        ReplaceEdge(topo, topo->GetEdge(eid), topo->GetEdge(target->GetOutput(i)));
+        graph->data->shapes.erase(eid);
+        topo->DelEdge(eid);
+    }
+
+    graph->data->attrs.erase(node->GetId());
+    topo->DelNode(node->GetId());
+}
+
+static uint32_t MergeNodes(ir::Graph* graph, const set<edgeid_t>& graph_outputs) {
+    auto topo = graph->topo.get();
+
+    vector<nodeid_t> sorted_nodes;
+    sorted_nodes.reserve(topo->GetCurrentNodeIdBound());
+    topo->TopologicalSort([&sorted_nodes](nodeid_t nid) -> void {
+        sorted_nodes.push_back(nid);
+    });
+
+    // type and inputs => nodes with different attributes
+    map<string, vector<ir::Node*>> key2nodes;
+    uint32_t merged_count = 0;
+    for (auto nid = sorted_nodes.begin(); nid != sorted_nodes.end(); ++nid) {
+        auto node = topo->GetNode(*nid);
+        auto& type = node->GetType();
+        if (utils::IsRandomOrSubgraphOp(type) || node->GetInputCount() == 0) {
+            continue;
+        }
+
+        string key = type.domain + ":" + type.name + ":";
+        AppendValue(type.version, &key);
+        AppendValue(node->GetInputCount(), &key);
+        for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+            AppendValue(node->GetInput(i), &key);
+        }
+        AppendValue(node->GetExtraInputCount(), &key);
+        for (uint32_t i = 0; i < node->GetExtraInputCount(); ++i) {
+            AppendValue(node->GetExtraInput(i), &key);
+        }
+        AppendValue(node->GetOutputCount(), &key);
+
+        auto& candidates = key2nodes[key];
+
+        ir::Node* target = nullptr;
+        for (auto c = candidates.begin(); c != candidates.end(); ++c) {
+            if (HasSameAttr(graph->data.get(), (*c)->GetId(), node->GetId())) {
+                target = *c;
+                break;
+            }
+        }
+        if (!target) {
+            candidates.push_back(node);
+            continue;
+        }
+
+        bool is_graph_output = false;
+        for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+            if (graph_outputs.find(node->GetOutput(i)) != graph_outputs.end()) {
+                is_graph_output = true;
+                break;
+            }
+        }
+        if (is_graph_output) {
+            continue;
+        }
+
+        MergeNode(graph, node, target);
+        ++merged_count;
+    }
+
+    return merged_count;
+}
+
+RetCode CSEOptimizer::Optimize(ir::Graph* graph) const {
+    set<edgeid_t> graph_outputs;
+    for (uint32_t i = 0; i < graph->topo->GetOutputCount(); ++i) {
+        graph_outputs.insert(graph->topo->GetOutput(i));
+    }
+
+    auto constant_count = MergeConstants(graph, graph_outputs);
+    auto node_count = MergeNodes(graph, graph_outputs);
+    if (constant_count > 0 || node_count > 0) {
+        LOG(DEBUG) << "[" << constant_count << "] constants and [" << node_count << "] nodes of graph["
+                   << graph->topo->GetName() << "] are merged.";
+    }
+
+    return RC_SUCCESS;
+}
+
+}} // namespace ppl::nn
@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_OPTIMIZERS_CSE_OPTIMIZER_H_
+#define _ST_HPC_PPL_NN_OPTIMIZERS_CSE_OPTIMIZER_H_
+
+#include "ppl/nn/optimizers/graph_optimizer.h"
+
+namespace ppl { namespace nn {
+
+/**
+   @brief common subexpression elimination. small constants with the same shape and data are merged first, then
+   nodes with the same type, attributes and inputs are merged in topological order, so that duplicated chains, e.g.
+   Shape->Gather->Unsqueeze, are merged as a whole.
+*/
+class CSEOptimizer final : public GraphOptimizer {
+public:
+    CSEOptimizer() : GraphOptimizer("CSEOptimizer") {}
+    ppl::common::RetCode Optimize(ir::Graph*) const override;
+};
+
+}} // namespace ppl::nn
+
+#endif
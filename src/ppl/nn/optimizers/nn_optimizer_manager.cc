@@ -17,6 +17,8 @@
 
 #include "ppl/nn/optimizers/nn_optimizer_manager.h"
 #include "ppl/nn/optimizers/fuse_parallel_node_optimizer.h"
+#include "ppl/nn/optimizers/cse_optimizer.h"
+#include "ppl/nn/optimizers/transpose_reshape_optimizer.h"
 #include "ppl/nn/optimizers/fuse_bn_optimizer.h"
 #include "ppl/nn/optimizers/fuse_constant_optimizer.h"
 #include "ppl/nn/optimizers/fuse_shape_optimizer.h"
@@ -28,6 +30,8 @@ namespace ppl { namespace nn {
 
 NNOptimizerManager::NNOptimizerManager() {
     optimizer_list_.push_back(make_shared<FuseParallelNodeOptimizer>());
+    optimizer_list_.push_back(make_shared<CSEOptimizer>());
+    optimizer_list_.push_back(make_shared<TransposeReshapeOptimizer>());
     optimizer_list_.push_back(make_shared<FuseBNOptimizer>());
     optimizer_list_.push_back(make_shared<FuseConstantOptimizer>());
     optimizer_list_.push_back(make_shared<FuseShapeOptimizer>());
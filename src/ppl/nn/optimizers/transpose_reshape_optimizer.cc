@@ -0,0 +1,480 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/optimizers/transpose_reshape_optimizer.h"
+#include "ppl/nn/params/onnx/transpose_param.h"
+#include "ppl/nn/params/onnx/reshape_param.h"
+#include "ppl/nn/common/logger.h"
+#include <set>
+#include <vector>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+struct OptimizerContext final {
+    ir::Graph* graph;
+    set<edgeid_t> graph_outputs;
+    uint32_t removed_node_count = 0;
+    uint64_t removed_traffic_bytes = 0;
+};
+
+static inline bool IsOnnxOp(const ir::Node* node, const char* name) {
+    auto& type = node->GetType();
+    return (type.domain.empty() && type.name == name);
+}
+
+static bool IsUnaryElementwiseOp(const ir::Node* node) {
+    static const set<string> unary_ops{
+        "Abs",        "Cast",      "Ceil", "Clip", "Cos",  "Elu",     "Erf",     "Exp",  "Floor", "HardSigmoid",
+        "HardSwish",  "LeakyRelu", "Log",  "Neg",  "Not",  "Reciprocal", "Relu", "Round", "Sigmoid", "Sign",
+        "Sin",        "Softplus",  "Sqrt", "Tanh",
+    };
+    auto& type = node->GetType();
+    return (type.domain.empty() && unary_ops.find(type.name) != unary_ops.end());
+}
+
+static bool IsBinaryElementwiseOp(const ir::Node* node) {
+    static const set<string> binary_ops{
+        "Add", "And", "Div", "Equal", "Greater", "Less", "Max", "Min", "Mul", "Or", "Pow", "Sub", "Xor",
+    };
+    auto& type = node->GetType();
+    return (type.domain.empty() && binary_ops.find(type.name) != binary_ops.end() && node->GetInputCount() == 2);
+}
+
+/** @return shape of `eid` if all of its dims are known, or nullptr */
+static const ir::Shape* GetKnownShape(const ir::Graph* graph, edgeid_t eid) {
+    auto ref = graph->data->shapes.find(eid);
+    if (ref == graph->data->shapes.end() || ref->second.data_type == DATATYPE_UNKNOWN) {
+        return nullptr;
+    }
+    for (auto d = ref->second.dims.begin(); d != ref->second.dims.end(); ++d) {
+        if (*d <= 0) {
+            return nullptr;
+        }
+    }
+    return &ref->second;
+}
+
+/** @brief bytes that are read and written by a Transpose or Reshape that outputs `eid`. 0 if it is unknown. */
+static uint64_t CalcTrafficBytes(const ir::Graph* graph, edgeid_t eid) {
+    auto shape = GetKnownShape(graph, eid);
+    if (!shape) {
+        return 0;
+    }
+
+    uint64_t bytes = GetSizeOfDataType(shape->data_type);
+    for (auto d = shape->dims.begin(); d != shape->dims.end(); ++d) {
+        bytes *= *d;
+    }
+    return bytes * 2;
+}
+
+static bool IsUsedOnlyBy(const OptimizerContext& ctx, const ir::Edge* edge, nodeid_t nid) {
+    return (edge->CalcConsumerCount() == 1 && edge->CreateConsumerIter().Get() == nid &&
+            ctx.graph_outputs.find(edge->GetId()) == ctx.graph_outputs.end());
+}
+
+static bool GetPerm(const ir::Graph* graph, const ir::Node* node, vector<int32_t>* perm) {
+    auto attr_ref = graph->data->attrs.find(node->GetId());
+    if (attr_ref == graph->data->attrs.end()) {
+        return false;
+    }
+
+    auto param = static_cast<const onnx::TransposeParam*>(attr_ref->second.get());
+    if (!param->perm.empty()) {
+        *perm = param->perm;
+        return true;
+    }
+
+    // empty perm reverses dims
+    auto shape_ref = graph->data->shapes.find(node->GetInput(0));
+    if (shape_ref == graph->data->shapes.end()) {
+        return false;
+    }
+    const int32_t dim_count = shape_ref->second.dims.size();
+    perm->resize(dim_count);
+    for (int32_t i = 0; i < dim_count; ++i) {
+        perm->at(i) = dim_count - 1 - i;
+    }
+    return true;
+}
+
+static void SetPerm(ir::Graph* graph, nodeid_t nid, const vector<int32_t>& perm) {
+    // attrs may be shared by other nodes
+    auto param = make_shared<onnx::TransposeParam>();
+    param->perm = perm;
+    graph->data->attrs[nid] = param;
+}
+
+static bool IsIdentityPerm(const vector<int32_t>& perm) {
+    for (uint32_t i = 0; i < perm.size(); ++i) {
+        if (perm[i] != (int32_t)i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @brief sets shape of `eid` to shape of `transposed_eid`, which is transposed from `eid` by `perm` */
+static void SetUntransposedShape(ir::Graph* graph, edgeid_t eid, edgeid_t transposed_eid,
+                                 const vector<int32_t>& perm) {
+    auto& shapes = graph->data->shapes;
+    auto ref = shapes.find(transposed_eid);
+    if (ref == shapes.end() || ref->second.dims.size() != perm.size()) {
+        shapes.erase(eid);
+        return;
+    }
+
+    ir::Shape shape = ref->second;
+    for (uint32_t i = 0; i < perm.size(); ++i) {
+        shape.dims[perm[i]] = ref->second.dims[i];
+    }
+    shapes[eid] = shape;
+}
+
+/** @brief makes `node` use `to` instead of `from` */
+static void MoveConsumer(ir::Node* node, ir::Edge* from, ir::Edge* to) {
+    node->ReplaceInput(from->GetId(), to->GetId());
+    from->DelConsumer(node->GetId());
+    to->AddConsumer(node->GetId());
+}
+
+/** @brief removes `node` whose outputs are not used, and constants that are used only by `node` */
+static void RemoveNode(OptimizerContext* ctx, ir::Node* node) {
+    auto graph = ctx->graph;
+    auto topo = graph->topo.get();
+
+    ctx->removed_traffic_bytes += CalcTrafficBytes(graph, node->GetOutput(0));
+    ++ctx->removed_node_count;
+
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        auto edge = topo->GetEdge(node->GetInput(i));
+        if (!edge) {
+            continue;
+        }
+
+        edge->DelConsumer(node->GetId());
+        if (edge->CalcConsumerCount() == 0 && ctx->graph_outputs.find(edge->GetId()) == ctx->graph_outputs.end() &&
+            graph->data->constants.find(edge->GetId()) != graph->data->constants.end()) {
+            graph->data->constants.erase(edge->GetId());
+            graph->data->shapes.erase(edge->GetId());
+            topo->DelEdge(edge->GetId());
+        }
+    }
+
+    for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+        graph->data->shapes.erase(node->GetOutput(i));
+        topo->DelEdge(node->GetOutput(i));
+    }
+
+    graph->data->attrs.erase(node->GetId());
+    topo->DelNode(node->GetId());
+}
+
+/** @brief consumers of output of `node` use its first input instead, and `node` is removed */
+static bool BypassNode(OptimizerContext* ctx, ir::Node* node) {
+    auto topo = ctx->graph->topo.get();
+    auto input = topo->GetEdge(node->GetInput(0));
+    auto output = topo->GetEdge(node->GetOutput(0));
+    if (ctx->graph_outputs.find(output->GetId()) != ctx->graph_outputs.end()) {
+        return false;
+    }
+
+    for (auto it = output->CreateConsumerIter(); it.IsValid(); it.Forward()) {
+        auto consumer = topo->GetNode(it.Get());
+        consumer->ReplaceInput(output->GetId(), input->GetId());
+        consumer->ReplaceExtraInput(output->GetId(), input->GetId());
+        input->AddConsumer(consumer->GetId());
+    }
+    output->ClearConsumer();
+
+    RemoveNode(ctx, node);
+    return true;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/** @brief Transpose(Transpose(x, p1), p2) => Transpose(x, p1[p2]) */
+static bool ComposeTranspose(OptimizerContext* ctx, ir::Node* node) {
+    auto graph = ctx->graph;
+    auto topo = graph->topo.get();
+
+    auto input = topo->GetEdge(node->GetInput(0));
+    auto producer = topo->GetNode(input->GetProducer());
+    if (!producer || !IsOnnxOp(producer, "Transpose")) {
+        return false;
+    }
+
+    vector<int32_t> perm1, perm2;
+    if (!GetPerm(graph, producer, &perm1) || !GetPerm(graph, node, &perm2) || perm1.size() != perm2.size()) {
+        return false;
+    }
+
+    vector<int32_t> perm(perm2.size());
+    for (uint32_t i = 0; i < perm2.size(); ++i) {
+        perm[i] = perm1[perm2[i]];
+    }
+
+    MoveConsumer(node, input, topo->GetEdge(producer->GetInput(0)));
+    SetPerm(graph, node->GetId(), perm);
+
+    if (input->CalcConsumerCount() == 0 && ctx->graph_outputs.find(input->GetId()) == ctx->graph_outputs.end()) {
+        RemoveNode(ctx, producer);
+    }
+    return true;
+}
+
+static bool RemoveIdentityTranspose(OptimizerContext* ctx, ir::Node* node) {
+    vector<int32_t> perm;
+    if (!GetPerm(ctx->graph, node, &perm) || !IsIdentityPerm(perm)) {
+        return false;
+    }
+    return BypassNode(ctx, node);
+}
+
+/** @brief Op(Transpose(x)) => Transpose(Op(x)) */
+static bool SinkTransposeThroughUnaryOp(OptimizerContext* ctx, ir::Node* node) {
+    auto graph = ctx->graph;
+    auto topo = graph->topo.get();
+
+    auto output = topo->GetEdge(node->GetOutput(0));
+    if (output->CalcConsumerCount() != 1 || ctx->graph_outputs.find(output->GetId()) != ctx->graph_outputs.end()) {
+        return false;
+    }
+
+    auto consumer = topo->GetNode(output->CreateConsumerIter().Get());
+    if (!IsUnaryElementwiseOp(consumer) || consumer->GetInput(0) != output->GetId() ||
+        consumer->GetOutputCount() != 1) {
+        return false;
+    }
+    for (uint32_t i = 1; i < consumer->GetInputCount(); ++i) {
+        if (consumer->GetInput(i) == output->GetId()) {
+            return false;
+        }
+    }
+
+    vector<int32_t> perm;
+    if (!GetPerm(graph, node, &perm)) {
+        return false;
+    }
+
+    // x -> Transpose -> output -> Op -> y  =>  x -> Op -> output -> Transpose -> y
+    auto x = topo->GetEdge(node->GetInput(0));
+    auto y = topo->GetEdge(consumer->GetOutput(0));
+
+    MoveConsumer(consumer, output, x);
+    x->DelConsumer(node->GetId());
+    consumer->ReplaceOutput(y->GetId(), output->GetId());
+    output->SetProducer(consumer->GetId());
+
+    node->ReplaceInput(x->GetId(), output->GetId());
+    output->AddConsumer(node->GetId());
+    node->ReplaceOutput(output->GetId(), y->GetId());
+    y->SetProducer(node->GetId());
+
+    SetPerm(graph, node->GetId(), perm);
+    SetUntransposedShape(graph, output->GetId(), y->GetId(), perm);
+    return true;
+}
+
+/**
+   @brief Op(Transpose(a), Transpose(b)) => Transpose(Op(a, b)) if both Transposes have the same perm, and
+   Op(Transpose(a), c) => Transpose(Op(a, c)) if `c` is a constant with only one element.
+*/
+static bool SinkTransposeThroughBinaryOp(OptimizerContext* ctx, ir::Node* node) {
+    auto graph = ctx->graph;
+    auto topo = graph->topo.get();
+
+    if (node->GetOutputCount() != 1) {
+        return false;
+    }
+
+    ir::Node* transposes[2] = {nullptr, nullptr};
+    vector<int32_t> perm;
+    for (uint32_t i = 0; i < 2; ++i) {
+        auto edge = topo->GetEdge(node->GetInput(i));
+        if (!edge) {
+            return false;
+        }
+        auto producer = topo->GetNode(edge->GetProducer());
+        if (!producer || !IsOnnxOp(producer, "Transpose") || !IsUsedOnlyBy(*ctx, edge, node->GetId())) {
+            continue;
+        }
+
+        vector<int32_t> cur_perm;
+        if (!GetPerm(graph, producer, &cur_perm)) {
+            return false;
+        }
+        if (perm.empty()) {
+            perm = cur_perm;
+        } else if (perm != cur_perm) {
+            return false;
+        }
+        transposes[i] = producer;
+    }
+    if (perm.empty()) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        if (transposes[i]) {
+            continue;
+        }
+
+        // broadcasting a constant with one element does not depend on the order of dims
+        auto eid = node->GetInput(i);
+        auto shape = GetKnownShape(graph, eid);
+        if (graph->data->constants.find(eid) == graph->data->constants.end() || !shape ||
+            shape->dims.size() > perm.size()) {
+            return false;
+        }
+        for (auto d = shape->dims.begin(); d != shape->dims.end(); ++d) {
+            if (*d != 1) {
+                return false;
+            }
+        }
+    }
+
+    auto sinked = (transposes[0] ? transposes[0] : transposes[1]);
+    auto x = topo->GetEdge(sinked->GetInput(0));
+    auto mid = topo->GetEdge(sinked->GetOutput(0));
+    auto y = topo->GetEdge(node->GetOutput(0));
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        // both inputs are replaced at once if they are the same edge
+        if (transposes[i] && node->GetInput(i) == transposes[i]->GetOutput(0)) {
+            MoveConsumer(node, topo->GetEdge(node->GetInput(i)), topo->GetEdge(transposes[i]->GetInput(0)));
+        }
+    }
+    if (transposes[1] && transposes[1] != sinked) {
+        RemoveNode(ctx, transposes[1]);
+    }
+
+    // x -> Transpose -> mid -> Op -> y  =>  x -> Op -> mid -> Transpose -> y
+    x->DelConsumer(sinked->GetId());
+    node->ReplaceOutput(y->GetId(), mid->GetId());
+    mid->SetProducer(node->GetId());
+
+    sinked->ReplaceInput(x->GetId(), mid->GetId());
+    mid->AddConsumer(sinked->GetId());
+    sinked->ReplaceOutput(mid->GetId(), y->GetId());
+    y->SetProducer(sinked->GetId());
+
+    SetPerm(graph, sinked->GetId(), perm);
+    SetUntransposedShape(graph, mid->GetId(), y->GetId(), perm);
+    return true;
+}
+
+/** @brief Reshape(Reshape(x, s1), s2) => Reshape(x, s2) if `s2` is a constant that does not copy dims */
+static bool ComposeReshape(OptimizerContext* ctx, ir::Node* node) {
+    auto graph = ctx->graph;
+    auto topo = graph->topo.get();
+
+    auto input = topo->GetEdge(node->GetInput(0));
+    auto producer = topo->GetNode(input->GetProducer());
+    if (!producer || !IsOnnxOp(producer, "Reshape") || node->GetInputCount() != 2) {
+        return false;
+    }
+
+    auto shape_constant_ref = graph->data->constants.find(node->GetInput(1));
+    auto shape_ref = graph->data->shapes.find(node->GetInput(1));
+    if (shape_constant_ref == graph->data->constants.end() || shape_ref == graph->data->shapes.end() ||
+        shape_ref->second.data_type != DATATYPE_INT64) {
+        return false;
+    }
+
+    // 0 copies the corresponding dim of input unless `allowzero` is set
+    auto attr_ref = graph->data->attrs.find(node->GetId());
+    bool allow_zero = (attr_ref != graph->data->attrs.end() &&
+                       static_cast<const onnx::ReshapeParam*>(attr_ref->second.get())->allowzero != 0);
+    if (!allow_zero) {
+        auto dims = (const int64_t*)shape_constant_ref->second.data.GetData();
+        const uint64_t dim_count = shape_constant_ref->second.data.GetSize() / sizeof(int64_t);
+        for (uint64_t i = 0; i < dim_count; ++i) {
+            if (dims[i] == 0) {
+                return false;
+            }
+        }
+    }
+
+    MoveConsumer(node, input, topo->GetEdge(producer->GetInput(0)));
+    if (input->CalcConsumerCount() == 0 && ctx->graph_outputs.find(input->GetId()) == ctx->graph_outputs.end()) {
+        RemoveNode(ctx, producer);
+    }
+    return true;
+}
+
+static bool RemoveIdentityReshape(OptimizerContext* ctx, ir::Node* node) {
+    auto input_shape = GetKnownShape(ctx->graph, node->GetInput(0));
+    auto output_shape = GetKnownShape(ctx->graph, node->GetOutput(0));
+    if (!input_shape || !output_shape || input_shape->data_type != output_shape->data_type ||
+        input_shape->dims != output_shape->dims) {
+        return false;
+    }
+    return BypassNode(ctx, node);
+}
+
+static bool OptimizeOnce(OptimizerContext* ctx) {
+    auto topo = ctx->graph->topo.get();
+
+    vector<nodeid_t> sorted_nodes;
+    sorted_nodes.reserve(topo->GetCurrentNodeIdBound());
+    topo->TopologicalSort([&sorted_nodes](nodeid_t nid) -> void {
+        sorted_nodes.push_back(nid);
+    });
+
+    bool graph_changed = false;
+    for (auto nid = sorted_nodes.begin(); nid != sorted_nodes.end(); ++nid) {
+        auto node = topo->GetNode(*nid);
+        if (!node) { // removed
+            continue;
+        }
+
+        if (IsOnnxOp(node, "Transpose")) {
+            graph_changed |= (ComposeTranspose(ctx, node) || RemoveIdentityTranspose(ctx, node) ||
+                              SinkTransposeThroughUnaryOp(ctx, node));
+        } else if (IsOnnxOp(node, "Reshape")) {
+            graph_changed |= (ComposeReshape(ctx, node) || RemoveIdentityReshape(ctx, node));
+        } else if (IsBinaryElementwiseOp(node)) {
+            graph_changed |= SinkTransposeThroughBinaryOp(ctx, node);
+        }
+    }
+
+    return graph_changed;
+}
+
+RetCode TransposeReshapeOptimizer::Optimize(ir::Graph* graph) const {
+    OptimizerContext ctx;
+    ctx.graph = graph;
+    for (uint32_t i = 0; i < graph->topo->GetOutputCount(); ++i) {
+        ctx.graph_outputs.insert(graph->topo->GetOutput(i));
+    }
+
+    while (OptimizeOnce(&ctx));
+
+    if (ctx.removed_node_count > 0) {
+        LOG(INFO) << "[" << ctx.removed_node_count << "] Transpose/Reshape nodes of graph[" << graph->topo->GetName()
+                  << "] are removed, which saves [" << ctx.removed_traffic_bytes
+                  << "] bytes of memory traffic per run (ops with unknown shapes are not counted).";
+    }
+
+    return RC_SUCCESS;
+}
+
+}} // namespace ppl::nn
@@ -444,4 +444,17 @@ RetCode ProcessGraph(const utils::SharedResource& resource, ir::Graph* graph, Ru
     return RC_SUCCESS;
 }
 
+bool IsRandomOrSubgraphOp(const ir::Node::Type& type) {
+    if (!type.domain.empty()) {
+        return false;
+    }
+
+    static const set<string> op_types{
+        "If", // has subgraph
+        "Loop", // has subgraph
+        "RandomNormal", "RandomNormalLike", "RandomUniform", "RandomUniformLike", "Multinomial", "Bernoulli",
+    };
+    return (op_types.find(type.name) != op_types.end());
+}
+
 }}} // namespace ppl::nn::utils
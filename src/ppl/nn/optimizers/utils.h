@@ -32,6 +32,12 @@ namespace ppl { namespace nn { namespace utils {
 */
 ppl::common::RetCode ProcessGraph(const utils::SharedResource& resource, ir::Graph* graph, RuntimeGraphInfo* info);
 
+/**
+   @brief tells whether outputs of nodes of `type` are not determined by their inputs, e.g. random ops, or nodes of
+   `type` run subgraphs. such nodes cannot be merged or evaluated when graphs are processed.
+*/
+bool IsRandomOrSubgraphOp(const ir::Node::Type& type);
+
 }}} // namespace ppl::nn::utils
 
 #endif
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/oputils/onnx/reshape_layer_normalization.h"
+#include "ppl/nn/runtime/tensor_impl.h"
+#include "ppl/nn/common/logger.h"
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace onnx {
+
+RetCode ReshapeLayerNormalization(InputOutputInfo* info, const ir::Attr* arg) {
+    auto param = static_cast<const LayerNormalizationParam*>(arg);
+    if (info->GetInputCount() < 2 || info->GetInputCount() > 3) {
+        LOG(DEBUG) << "ERROR: input count[" << info->GetInputCount() << "] is out of range[2, 3].";
+        return RC_INVALID_VALUE;
+    }
+
+    const TensorShape& in_shape0 = *info->GetInput<TensorImpl>(0)->GetShape();
+    const int32_t dim_count = in_shape0.GetDimCount();
+    const int32_t axis = param->axis < 0 ? param->axis + dim_count : param->axis;
+    if (axis < 0 || axis >= dim_count) {
+        LOG(DEBUG) << "ERROR: axis[" << param->axis << "] is out of range[" << -dim_count << ", " << dim_count << ").";
+        return RC_INVALID_VALUE;
+    }
+
+    // Scale and B are not broadcasted. they must have as many elements as the normalized dims.
+    uint64_t normalized_elem_count = 1;
+    for (int32_t i = axis; i < dim_count; ++i) {
+        normalized_elem_count *= in_shape0.GetDim(i);
+    }
+    for (uint32_t i = 1; i < info->GetInputCount(); ++i) {
+        auto input = info->GetInput<TensorImpl>(i);
+        if (!input) {
+            continue;
+        }
+        const uint64_t elem_count = input->GetShape()->CalcElementsExcludingPadding();
+        if (elem_count != normalized_elem_count) {
+            LOG(DEBUG) << "ERROR: element count[" << elem_count << "] of input[" << i
+                       << "] != element count of normalized dims[" << normalized_elem_count << "].";
+            return RC_INVALID_VALUE;
+        }
+    }
+
+    auto out_shape0 = info->GetOutput<TensorImpl>(0)->GetShape();
+    out_shape0->Reshape(in_shape0.GetDims(), dim_count);
+
+    // Mean and InvStdDev keep dims before `axis` and reduce the others to 1
+    for (uint32_t i = 1; i < info->GetOutputCount(); ++i) {
+        auto out_shape = info->GetOutput<TensorImpl>(i)->GetShape();
+        out_shape->Reshape(in_shape0.GetDims(), dim_count);
+        for (int32_t j = axis; j < dim_count; ++j) {
+            out_shape->SetDim(j, 1);
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+}}} // namespace ppl::nn::onnx
@@ -0,0 +1,37 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/runtime/batching_runner_factory.h"
+#include "ppl/nn/runtime/batching_runner_impl.h"
+#include "ppl/nn/common/logger.h"
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+BatchingRunner* BatchingRunnerFactory::Create(RuntimePool* pool, const BatchingRunnerOptions& options) {
+    auto runner = new BatchingRunnerImpl();
+    auto rc = runner->Init(pool, options);
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "init BatchingRunner failed: " << GetRetCodeStr(rc);
+        delete runner;
+        return nullptr;
+    }
+    return runner;
+}
+
+}} // namespace ppl::nn
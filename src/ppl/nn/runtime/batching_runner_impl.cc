@@ -0,0 +1,325 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/runtime/batching_runner_impl.h"
+#include "ppl/nn/common/logger.h"
+#include <cstring> // memcpy
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+BatchingRunnerImpl::~BatchingRunnerImpl() {
+    {
+        lock_guard<mutex> lck(mutex_);
+        is_stopped_ = true;
+    }
+    cond_.notify_all();
+
+    for (auto t = workers_.begin(); t != workers_.end(); ++t) {
+        t->join();
+    }
+}
+
+RetCode BatchingRunnerImpl::Init(RuntimePool* pool, const BatchingRunnerOptions& options) {
+    if (!pool) {
+        LOG(ERROR) << "runtime pool is null.";
+        return RC_INVALID_VALUE;
+    }
+    pool_.reset(pool);
+
+    if (options.max_batch_size == 0) {
+        LOG(ERROR) << "max_batch_size is 0.";
+        return RC_INVALID_VALUE;
+    }
+    options_ = options;
+
+    auto runtime = pool_->TryAcquire();
+    if (!runtime) {
+        LOG(ERROR) << "acquire runtime from pool failed.";
+        return RC_OTHER_ERROR;
+    }
+    input_count_ = runtime->GetInputCount();
+    output_count_ = runtime->GetOutputCount();
+    pool_->Release(runtime);
+
+    if (input_count_ == 0) {
+        LOG(ERROR) << "model without inputs cannot be batched.";
+        return RC_INVALID_VALUE;
+    }
+
+    const uint32_t worker_num = pool_->GetRuntimeCount();
+    workers_.reserve(worker_num);
+    for (uint32_t i = 0; i < worker_num; ++i) {
+        workers_.emplace_back([this]() -> void {
+            auto runtime = pool_->Acquire();
+            WorkerFunc(runtime);
+            pool_->Release(runtime);
+        });
+    }
+
+    return RC_SUCCESS;
+}
+
+RetCode BatchingRunnerImpl::Run(const vector<BatchingInput>& inputs, vector<BatchingOutput>* outputs) {
+    if (inputs.size() != input_count_) {
+        LOG(ERROR) << "number of inputs [" << inputs.size() << "] != number of inputs of model [" << input_count_
+                   << "]";
+        return RC_INVALID_VALUE;
+    }
+
+    const int64_t sample_num = inputs[0].dims.empty() ? 0 : inputs[0].dims[0];
+    if (sample_num <= 0) {
+        LOG(ERROR) << "invalid dim 0 of input[0].";
+        return RC_INVALID_VALUE;
+    }
+    for (uint32_t i = 0; i < inputs.size(); ++i) {
+        auto& input = inputs[i];
+        if (!input.data) {
+            LOG(ERROR) << "data of input[" << i << "] is null.";
+            return RC_INVALID_VALUE;
+        }
+        if (input.dims.empty() || input.dims[0] != sample_num) {
+            LOG(ERROR) << "dim 0 of input[" << i << "] != dim 0 of input[0] [" << sample_num << "]";
+            return RC_INVALID_VALUE;
+        }
+    }
+
+    outputs->resize(output_count_);
+
+    Request req;
+    req.inputs = &inputs;
+    req.outputs = outputs;
+    req.sample_num = sample_num;
+    req.enqueue_ts = std::chrono::steady_clock::now();
+    auto result = req.result.get_future();
+
+    {
+        lock_guard<mutex> lck(mutex_);
+        if (is_stopped_) {
+            LOG(ERROR) << "BatchingRunner is stopped.";
+            return RC_INVALID_VALUE;
+        }
+        queue_.push_back(&req);
+        ++request_count_;
+    }
+    cond_.notify_all();
+
+    return result.get();
+}
+
+bool BatchingRunnerImpl::CanBeBatched(const Request* a, const Request* b) const {
+    for (uint32_t i = 0; i < input_count_; ++i) {
+        auto& dims_a = (*a->inputs)[i].dims;
+        auto& dims_b = (*b->inputs)[i].dims;
+        if (dims_a.size() != dims_b.size()) {
+            return false;
+        }
+        for (uint32_t j = 1; j < dims_a.size(); ++j) {
+            if (dims_a[j] != dims_b[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void BatchingRunnerImpl::CountBatchable(uint32_t* req_num, uint32_t* sample_num) const {
+    auto first = queue_.front();
+    uint32_t req_counter = 1;
+    uint32_t sample_counter = first->sample_num;
+    for (; req_counter < queue_.size(); ++req_counter) {
+        auto req = queue_[req_counter];
+        if (sample_counter + req->sample_num > options_.max_batch_size || !CanBeBatched(first, req)) {
+            break;
+        }
+        sample_counter += req->sample_num;
+    }
+
+    *req_num = req_counter;
+    *sample_num = sample_counter;
+}
+
+bool BatchingRunnerImpl::WaitForBatch(vector<Request*>* batch, uint32_t* sample_num) {
+    unique_lock<mutex> lck(mutex_);
+
+    uint32_t req_num = 0;
+    while (true) {
+        if (queue_.empty()) {
+            if (is_stopped_) {
+                return false;
+            }
+            cond_.wait(lck);
+            continue;
+        }
+
+        /*
+          runs the batch if it is full, the next request cannot join it, or the first request has waited for
+          `max_delay_microseconds`.
+        */
+        CountBatchable(&req_num, sample_num);
+        auto deadline = queue_.front()->enqueue_ts + std::chrono::microseconds(options_.max_delay_microseconds);
+        if (is_stopped_ || req_num < queue_.size() || *sample_num >= options_.max_batch_size ||
+            std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        cond_.wait_until(lck, deadline);
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    batch->clear();
+    for (uint32_t i = 0; i < req_num; ++i) {
+        auto req = queue_.front();
+        queue_.pop_front();
+        batch->push_back(req);
+
+        uint64_t wait_us = std::chrono::duration_cast<std::chrono::microseconds>(now - req->enqueue_ts).count();
+        total_wait_microseconds_ += wait_us;
+        if (wait_us > max_wait_microseconds_) {
+            max_wait_microseconds_ = wait_us;
+        }
+    }
+
+    ++batch_count_;
+    sample_count_ += *sample_num;
+    if (*sample_num > max_samples_in_batch_) {
+        max_samples_in_batch_ = *sample_num;
+    }
+
+    return true;
+}
+
+RetCode BatchingRunnerImpl::RunBatch(Runtime* runtime, const vector<Request*>& batch, uint32_t sample_num,
+                                     WorkerBuffers* buffers) {
+    auto first = batch[0];
+
+    for (uint32_t i = 0; i < input_count_; ++i) {
+        auto tensor = runtime->GetInputTensor(i);
+        auto shape = tensor->GetShape();
+
+        auto& input = (*first->inputs)[i];
+        vector<int64_t> dims = input.dims;
+        dims[0] = sample_num;
+        shape->Reshape(dims);
+
+        TensorShape src_desc = *shape;
+        src_desc.SetDataFormat(DATAFORMAT_NDARRAY);
+
+        const void* src = input.data;
+        if (batch.size() > 1) {
+            const uint64_t bytes = src_desc.CalcBytesExcludingPadding();
+            const uint64_t bytes_per_sample = bytes / sample_num;
+
+            auto& buffer = buffers->inputs[i];
+            buffer.resize(bytes);
+            char* cursor = buffer.data();
+            for (auto r = batch.begin(); r != batch.end(); ++r) {
+                const uint64_t req_bytes = bytes_per_sample * (*r)->sample_num;
+                memcpy(cursor, (*(*r)->inputs)[i].data, req_bytes);
+                cursor += req_bytes;
+            }
+            src = buffer.data();
+        }
+
+        auto rc = tensor->ConvertFromHost(src, src_desc);
+        if (rc != RC_SUCCESS) {
+            LOG(ERROR) << "set data of input[" << tensor->GetName() << "] failed: " << GetRetCodeStr(rc);
+            return rc;
+        }
+    }
+
+    auto rc = runtime->Run();
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "run batch of [" << sample_num << "] samples failed: " << GetRetCodeStr(rc);
+        return rc;
+    }
+
+    for (uint32_t i = 0; i < output_count_; ++i) {
+        auto tensor = runtime->GetOutputTensor(i);
+
+        TensorShape dst_desc = *tensor->GetShape();
+        dst_desc.SetDataFormat(DATAFORMAT_NDARRAY);
+        const uint64_t bytes = dst_desc.CalcBytesExcludingPadding();
+
+        if (batch.size() == 1) {
+            auto& output = (*first->outputs)[i];
+            output.dims.assign(dst_desc.GetDims(), dst_desc.GetDims() + dst_desc.GetDimCount());
+            output.data.resize(bytes);
+            rc = tensor->ConvertToHost(output.data.data(), dst_desc);
+            if (rc != RC_SUCCESS) {
+                LOG(ERROR) << "get data of output[" << tensor->GetName() << "] failed: " << GetRetCodeStr(rc);
+                return rc;
+            }
+            continue;
+        }
+
+        if (dst_desc.IsScalar() || dst_desc.GetDimCount() == 0 || dst_desc.GetDim(0) != sample_num) {
+            LOG(ERROR) << "output[" << tensor->GetName() << "] is not batch-major: dim 0 != batch size ["
+                       << sample_num << "]";
+            return RC_INVALID_VALUE;
+        }
+
+        buffers->output.resize(bytes);
+        rc = tensor->ConvertToHost(buffers->output.data(), dst_desc);
+        if (rc != RC_SUCCESS) {
+            LOG(ERROR) << "get data of output[" << tensor->GetName() << "] failed: " << GetRetCodeStr(rc);
+            return rc;
+        }
+
+        const uint64_t bytes_per_sample = bytes / sample_num;
+        const char* cursor = buffers->output.data();
+        for (auto r = batch.begin(); r != batch.end(); ++r) {
+            auto& output = (*(*r)->outputs)[i];
+            output.dims.assign(dst_desc.GetDims(), dst_desc.GetDims() + dst_desc.GetDimCount());
+            output.dims[0] = (*r)->sample_num;
+
+            const uint64_t req_bytes = bytes_per_sample * (*r)->sample_num;
+            output.data.assign(cursor, cursor + req_bytes);
+            cursor += req_bytes;
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+void BatchingRunnerImpl::WorkerFunc(Runtime* runtime) {
+    WorkerBuffers buffers;
+    buffers.inputs.resize(input_count_);
+
+    vector<Request*> batch;
+    uint32_t sample_num = 0;
+    while (WaitForBatch(&batch, &sample_num)) {
+        auto rc = RunBatch(runtime, batch, sample_num, &buffers);
+        for (auto r = batch.begin(); r != batch.end(); ++r) {
+            (*r)->result.set_value(rc);
+        }
+    }
+}
+
+RetCode BatchingRunnerImpl::GetStatistics(BatchingRunnerStatistics* stat) const {
+    lock_guard<mutex> lck(mutex_);
+    stat->request_count = request_count_;
+    stat->batch_count = batch_count_;
+    stat->sample_count = sample_count_;
+    stat->max_samples_in_batch = max_samples_in_batch_;
+    stat->total_wait_microseconds = total_wait_microseconds_;
+    stat->max_wait_microseconds = max_wait_microseconds_;
+    return RC_SUCCESS;
+}
+
+}} // namespace ppl::nn
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_IMPL_H_
+#define _ST_HPC_PPL_NN_RUNTIME_BATCHING_RUNNER_IMPL_H_
+
+#include "ppl/nn/runtime/batching_runner.h"
+#include "ppl/nn/runtime/runtime_pool.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ppl { namespace nn {
+
+class BatchingRunnerImpl final : public BatchingRunner {
+public:
+    BatchingRunnerImpl() {}
+    ~BatchingRunnerImpl();
+
+    /** @note takes the ownership of `pool` */
+    ppl::common::RetCode Init(RuntimePool* pool, const BatchingRunnerOptions&);
+
+    ppl::common::RetCode Run(const std::vector<BatchingInput>& inputs, std::vector<BatchingOutput>* outputs) override;
+    ppl::common::RetCode GetStatistics(BatchingRunnerStatistics*) const override;
+
+private:
+    struct Request final {
+        const std::vector<BatchingInput>* inputs;
+        std::vector<BatchingOutput>* outputs;
+        uint32_t sample_num;
+        std::chrono::steady_clock::time_point enqueue_ts;
+        std::promise<ppl::common::RetCode> result;
+    };
+
+    /** buffers of a worker used to concatenate inputs and split outputs */
+    struct WorkerBuffers final {
+        std::vector<std::vector<char>> inputs;
+        std::vector<char> output;
+    };
+
+    bool CanBeBatched(const Request* a, const Request* b) const;
+    void CountBatchable(uint32_t* req_num, uint32_t* sample_num) const;
+    /** @brief waits until a batch is ready. returns false if the runner is stopped. */
+    bool WaitForBatch(std::vector<Request*>* batch, uint32_t* sample_num);
+    ppl::common::RetCode RunBatch(Runtime* runtime, const std::vector<Request*>& batch, uint32_t sample_num,
+                                  WorkerBuffers* buffers);
+    void WorkerFunc(Runtime* runtime);
+
+private:
+    BatchingRunnerOptions options_;
+    std::unique_ptr<RuntimePool> pool_;
+    uint32_t input_count_ = 0;
+    uint32_t output_count_ = 0;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<Request*> queue_;
+    bool is_stopped_ = false;
+
+    // ----- statistics ----- //
+
+    uint64_t request_count_ = 0;
+    uint64_t batch_count_ = 0;
+    uint64_t sample_count_ = 0;
+    uint32_t max_samples_in_batch_ = 0;
+    uint64_t total_wait_microseconds_ = 0;
+    uint64_t max_wait_microseconds_ = 0;
+
+private:
+    BatchingRunnerImpl(const BatchingRunnerImpl&) = delete;
+    BatchingRunnerImpl& operator=(const BatchingRunnerImpl&) = delete;
+};
+
+}} // namespace ppl::nn
+
+#endif
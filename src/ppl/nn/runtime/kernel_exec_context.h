@@ -42,9 +42,23 @@ public:
         return (edge_last_consumer_->at(eid) == node_->GetId());
     }
 
+    /** @brief the kernel is run by the `idx`-th of `num` threads that may run kernels at the same time */
+    void SetWorker(uint32_t idx, uint32_t num) {
+        worker_idx_ = idx;
+        worker_num_ = num;
+    }
+    uint32_t GetWorkerIndex() const {
+        return worker_idx_;
+    }
+    uint32_t GetWorkerNum() const {
+        return worker_num_;
+    }
+
 private:
     bool is_profiling_enabled_ = false;
     const std::vector<nodeid_t>* edge_last_consumer_ = nullptr;
+    uint32_t worker_idx_ = 0;
+    uint32_t worker_num_ = 1;
 };
 
 }} // namespace ppl::nn
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/runtime/op_cost.h"
+#include <set>
+#include <string>
+using namespace std;
+
+namespace ppl { namespace nn {
+
+static uint64_t CalcElements(const TensorShape* shape) {
+    return shape ? shape->CalcElementsExcludingPadding() : 0;
+}
+
+static const TensorShape* GetShape(const vector<const TensorShape*>& shapes, uint32_t idx) {
+    return (idx < shapes.size()) ? shapes[idx] : nullptr;
+}
+
+// ops that perform a few operations per output element
+static const set<string> g_elementwise_ops = {
+    "Abs", "Add", "Clip", "Div", "Elu", "Erf", "Exp", "Gelu", "GELU", "HardSigmoid", "LeakyRelu", "Log", "Max", "Mean",
+    "Min", "Mul", "Neg", "Pow", "PRelu", "Reciprocal", "Relu", "Sigmoid", "Sqrt", "Sub", "Sum", "Swish", "Tanh", "Where",
+};
+
+// ops that perform a few operations per input element
+static const set<string> g_reduction_ops = {
+    "ArgMax", "ArgMin", "AveragePool", "GlobalAveragePool", "GlobalMaxPool", "MaxPool", "ReduceL2", "ReduceMax",
+    "ReduceMean", "ReduceMin", "ReduceProd", "ReduceSum",
+};
+
+static uint64_t EstimateFlops(const string& op, const vector<const TensorShape*>& inputs,
+                              const vector<const TensorShape*>& outputs) {
+    auto input0 = GetShape(inputs, 0);
+    auto output0 = GetShape(outputs, 0);
+    if (!input0 || !output0) {
+        return 0;
+    }
+
+    if (op == "Conv") {
+        // weight: [M, C/group, kh, kw]. each output element takes C/group * kh * kw mul-adds.
+        auto weight = GetShape(inputs, 1);
+        if (!weight || weight->GetDimCount() == 0 || weight->GetDim(0) == 0) {
+            return 0;
+        }
+        return 2 * CalcElements(output0) * (CalcElements(weight) / weight->GetDim(0));
+    }
+
+    if (op == "ConvTranspose") {
+        // weight: [C, M/group, kh, kw]. each input element is scattered to M/group * kh * kw outputs.
+        auto weight = GetShape(inputs, 1);
+        if (!weight || weight->GetDimCount() == 0 || weight->GetDim(0) == 0) {
+            return 0;
+        }
+        return 2 * CalcElements(input0) * (CalcElements(weight) / weight->GetDim(0));
+    }
+
+    if (op == "MatMul") {
+        if (input0->GetDimCount() == 0) {
+            return 0;
+        }
+        return 2 * CalcElements(output0) * input0->GetDim(input0->GetDimCount() - 1);
+    }
+
+    if (op == "Gemm") {
+        // A: [M, K] or [K, M], Y: [M, N]
+        if (output0->GetDimCount() != 2 || output0->GetDim(0) == 0) {
+            return 0;
+        }
+        return 2 * CalcElements(output0) * (CalcElements(input0) / output0->GetDim(0));
+    }
+
+    if (op == "BatchNormalization") {
+        return 2 * CalcElements(output0);
+    }
+
+    if (op == "Softmax" || op == "LogSoftmax" || op == "LayerNormalization" || op == "LayerNorm" ||
+        op == "InstanceNormalization") {
+        return 5 * CalcElements(output0);
+    }
+
+    if (g_elementwise_ops.find(op) != g_elementwise_ops.end()) {
+        return CalcElements(output0);
+    }
+
+    if (g_reduction_ops.find(op) != g_reduction_ops.end()) {
+        return CalcElements(input0);
+    }
+
+    // data movement ops like Reshape, Transpose and Concat
+    return 0;
+}
+
+void EstimateOpCost(const ir::Node::Type& type, const vector<const TensorShape*>& inputs,
+                    const vector<const TensorShape*>& outputs, OpCost* cost) {
+    cost->flops = EstimateFlops(type.name, inputs, outputs);
+
+    cost->bytes = 0;
+    for (auto s = inputs.begin(); s != inputs.end(); ++s) {
+        if (*s) {
+            cost->bytes += (*s)->CalcBytesExcludingPadding();
+        }
+    }
+    for (auto s = outputs.begin(); s != outputs.end(); ++s) {
+        if (*s) {
+            cost->bytes += (*s)->CalcBytesExcludingPadding();
+        }
+    }
+}
+
+}} // namespace ppl::nn
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_OP_COST_H_
+#define _ST_HPC_PPL_NN_RUNTIME_OP_COST_H_
+
+#include "ppl/nn/ir/node.h"
+#include "ppl/nn/common/tensor_shape.h"
+#include <vector>
+
+namespace ppl { namespace nn {
+
+struct OpCost final {
+    /** estimated floating point operations. 0 if unknown. */
+    uint64_t flops = 0;
+    /** bytes of inputs and outputs */
+    uint64_t bytes = 0;
+};
+
+/**
+   @brief estimates the cost of an op from shapes of its inputs and outputs, which are computed by the reshape
+   functions in `oputils` before the op is executed.
+   @param inputs nullptr for absent optional inputs
+*/
+void EstimateOpCost(const ir::Node::Type& type, const std::vector<const TensorShape*>& inputs,
+                    const std::vector<const TensorShape*>& outputs, OpCost* cost);
+
+}} // namespace ppl::nn
+
+#endif
@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/common/logger.h"
+#include "ppl/nn/runtime/parallel_scheduler.h"
+#include "ppl/nn/runtime/scheduler_common.h"
+#include <set>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+ParallelScheduler::ParallelScheduler(uint32_t nr_threads) {
+    if (nr_threads == 0) {
+        nr_threads = std::thread::hardware_concurrency();
+    }
+    nr_threads_ = (nr_threads == 0) ? 1 : nr_threads;
+    pools_.mutex = &object_mutex_;
+
+    acquire_object_func_ = [this](edgeid_t eid, uint32_t etype) -> EdgeObject* {
+        return utils::AcquireEdgeObject(eid, etype, &pools_);
+    };
+
+    release_object_func_ = [this](EdgeObject* object, nodeid_t user) -> RetCode {
+        return utils::ReleaseEdgeObject(object, user, &pools_);
+    };
+}
+
+ParallelScheduler::~ParallelScheduler() {
+    {
+        lock_guard<mutex> lck(mutex_);
+        is_exiting_ = true;
+    }
+    start_cond_.notify_all();
+
+    for (auto t = workers_.begin(); t != workers_.end(); ++t) {
+        t->join();
+    }
+}
+
+RetCode ParallelScheduler::InitDependencies() {
+    const nodeid_t max_nid = topo_->GetCurrentNodeIdBound();
+
+    vector<bool> is_scheduled(max_nid, false);
+    for (auto x = sorted_nodes_->begin(); x != sorted_nodes_->end(); ++x) {
+        is_scheduled[*x] = true;
+    }
+
+    vector<set<nodeid_t>> nid2successors(max_nid);
+
+    // data dependencies
+    for (auto x = sorted_nodes_->begin(); x != sorted_nodes_->end(); ++x) {
+        auto prevs = topo_->FindPredecessors(*x);
+        for (auto p = prevs.begin(); p != prevs.end(); ++p) {
+            if (is_scheduled[*p]) {
+                nid2successors[*p].insert(*x);
+            }
+        }
+    }
+
+    /*
+      an edge object is released by its last consumer in `sorted_nodes`. other consumers of this edge
+      must finish before the last one starts, or they may read a released(or reused) buffer.
+      all these dependencies point to nodes that come later in `sorted_nodes`, so no cycle is introduced.
+    */
+    for (auto it = topo_->CreateEdgeIter(); it->IsValid(); it->Forward()) {
+        auto edge = it->Get();
+        auto last_consumer = edge_last_consumer_->at(edge->GetId());
+        if (last_consumer == INVALID_NODEID || !is_scheduled[last_consumer]) {
+            continue;
+        }
+
+        for (auto iter = edge->CreateConsumerIter(); iter.IsValid(); iter.Forward()) {
+            auto consumer = iter.Get();
+            if (consumer != last_consumer && is_scheduled[consumer]) {
+                nid2successors[consumer].insert(last_consumer);
+            }
+        }
+    }
+
+    successors_.clear();
+    successors_.resize(max_nid);
+    dependency_count_.assign(max_nid, 0);
+    for (auto x = sorted_nodes_->begin(); x != sorted_nodes_->end(); ++x) {
+        auto& nexts = nid2successors[*x];
+        successors_[*x].assign(nexts.begin(), nexts.end());
+        for (auto n = nexts.begin(); n != nexts.end(); ++n) {
+            ++dependency_count_[*n];
+        }
+    }
+
+    initial_nodes_.clear();
+    for (auto x = sorted_nodes_->begin(); x != sorted_nodes_->end(); ++x) {
+        if (dependency_count_[*x] == 0) {
+            initial_nodes_.push_back(*x);
+        }
+    }
+
+    pending_count_.reset(new atomic<uint32_t>[max_nid]);
+    if (!pending_count_) {
+        LOG(ERROR) << "allocate pending counters for [" << max_nid << "] nodes failed.";
+        return RC_OUT_OF_MEMORY;
+    }
+
+    return RC_SUCCESS;
+}
+
+RetCode ParallelScheduler::Init(const Options& options) {
+    topo_ = options.topo;
+    sorted_nodes_ = options.sorted_nodes;
+    edge_last_consumer_ = options.edge_last_consumer;
+    edgeid2object_ = options.edgeid2object;
+    nodeid2kernel_ = options.nodeid2kernel;
+
+    pools_.topo = topo_;
+    pools_.edge_last_consumer = edge_last_consumer_;
+    pools_.edgeid2object = edgeid2object_;
+
+    auto rc = InitDependencies();
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "InitDependencies failed: " << GetRetCodeStr(rc);
+        return rc;
+    }
+
+    if (queues_.empty()) {
+        queues_.reserve(nr_threads_);
+        for (uint32_t i = 0; i < nr_threads_; ++i) {
+            queues_.emplace_back(unique_ptr<TaskQueue>(new TaskQueue()));
+        }
+
+        // the caller of `ForEach()` works as worker 0
+        workers_.reserve(nr_threads_ - 1);
+        for (uint32_t i = 1; i < nr_threads_; ++i) {
+            workers_.emplace_back(&ParallelScheduler::WorkerMain, this, i);
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
+void ParallelScheduler::PushTask(uint32_t worker_idx, nodeid_t nid) {
+    auto q = queues_[worker_idx].get();
+    {
+        lock_guard<mutex> lck(q->mutex);
+        q->nodes.push_back(nid);
+    }
+    ++nr_queued_tasks_;
+}
+
+bool ParallelScheduler::PopTask(uint32_t worker_idx, nodeid_t* nid) {
+    if (nr_queued_tasks_.load() == 0) {
+        return false;
+    }
+
+    // the most recently pushed task is likely to use data that is still in cache
+    {
+        auto q = queues_[worker_idx].get();
+        lock_guard<mutex> lck(q->mutex);
+        if (!q->nodes.empty()) {
+            *nid = q->nodes.back();
+            q->nodes.pop_back();
+            --nr_queued_tasks_;
+            return true;
+        }
+    }
+
+    // steals the oldest task from others
+    for (uint32_t i = 1; i < nr_threads_; ++i) {
+        auto q = queues_[(worker_idx + i) % nr_threads_].get();
+        lock_guard<mutex> lck(q->mutex);
+        if (!q->nodes.empty()) {
+            *nid = q->nodes.front();
+            q->nodes.pop_front();
+            --nr_queued_tasks_;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+RetCode ParallelScheduler::ExecNode(nodeid_t nid, KernelExecContext* ctx) {
+    auto kernel = nodeid2kernel_->at(nid).get();
+    ctx->SetNode(kernel->GetNode());
+
+    auto exec_status = (*exec_func_)(kernel, ctx);
+
+#ifdef PPLNN_ENABLE_KERNEL_PROFILING
+    if (profiler_) {
+        profiler_->CollectStatistics(kernel);
+    }
+#endif
+
+    auto status = utils::ReleaseKernelInputOutput(kernel, ctx, release_object_func_);
+
+    if (exec_status != RC_SUCCESS) {
+        auto& type = kernel->GetNode()->GetType();
+        LOG(ERROR) << "exec kernel[" << kernel->GetName() << "] of type[" << type.domain << ":" << type.name << ":"
+                   << type.version << "] failed: " << GetRetCodeStr(exec_status);
+        return exec_status;
+    }
+
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "release resources of kernel[" << kernel->GetName() << "] failed: " << GetRetCodeStr(status);
+        return status;
+    }
+
+    return RC_SUCCESS;
+}
+
+void ParallelScheduler::RunTasks(uint32_t worker_idx) {
+    KernelExecContext ctx;
+    ctx.SetAcquireFunc(acquire_object_func_);
+    ctx.SetProfilingFlag((profiler_ != nullptr));
+    ctx.SetEdgeLastConsumerList(edge_last_consumer_);
+    ctx.SetWorker(worker_idx, nr_threads_);
+
+    while (true) {
+        nodeid_t nid;
+        if (!PopTask(worker_idx, &nid)) {
+            unique_lock<mutex> lck(mutex_);
+            task_cond_.wait(lck, [this]() -> bool {
+                return (nr_queued_tasks_.load() > 0 || nr_remaining_tasks_.load() == 0 || has_error_.load());
+            });
+            if (nr_remaining_tasks_.load() == 0 || has_error_.load()) {
+                return;
+            }
+            continue;
+        }
+
+        auto status = ExecNode(nid, &ctx);
+        if (status != RC_SUCCESS) {
+            {
+                lock_guard<mutex> lck(mutex_);
+                if (run_status_ == RC_SUCCESS) {
+                    run_status_ = status;
+                }
+                has_error_.store(true);
+            }
+            task_cond_.notify_all();
+            return;
+        }
+
+        uint32_t nr_new_tasks = 0;
+        auto& nexts = successors_[nid];
+        for (auto n = nexts.begin(); n != nexts.end(); ++n) {
+            if (pending_count_[*n].fetch_sub(1) == 1) {
+                PushTask(worker_idx, *n);
+                ++nr_new_tasks;
+            }
+        }
+
+        if (nr_remaining_tasks_.fetch_sub(1) == 1) {
+            {
+                lock_guard<mutex> lck(mutex_);
+            }
+            task_cond_.notify_all();
+            return;
+        }
+
+        // this worker will take one of the new tasks. wakes up others for the rest.
+        if (nr_new_tasks > 1) {
+            {
+                lock_guard<mutex> lck(mutex_);
+            }
+            task_cond_.notify_all();
+        }
+    }
+}
+
+void ParallelScheduler::WorkerMain(uint32_t worker_idx) {
+    uint64_t last_run_id = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lck(mutex_);
+            start_cond_.wait(lck, [this, last_run_id]() -> bool {
+                return (is_exiting_ || run_id_ != last_run_id);
+            });
+            if (is_exiting_) {
+                return;
+            }
+            last_run_id = run_id_;
+        }
+
+        RunTasks(worker_idx);
+
+        {
+            lock_guard<mutex> lck(mutex_);
+            --nr_running_workers_;
+        }
+        done_cond_.notify_one();
+    }
+}
+
+RetCode ParallelScheduler::ForEach(const function<RetCode(KernelImpl*, KernelExecContext*)>& exec,
+                                   Profiler* profiler) {
+    if (sorted_nodes_->empty()) {
+        return RC_SUCCESS;
+    }
+
+    exec_func_ = &exec;
+    profiler_ = profiler;
+    run_status_ = RC_SUCCESS;
+    has_error_.store(false);
+
+    // tasks may be left in queues if the previous run failed
+    for (auto q = queues_.begin(); q != queues_.end(); ++q) {
+        (*q)->nodes.clear();
+    }
+
+    for (auto x = sorted_nodes_->begin(); x != sorted_nodes_->end(); ++x) {
+        pending_count_[*x].store(dependency_count_[*x]);
+    }
+    nr_remaining_tasks_.store(sorted_nodes_->size());
+    nr_queued_tasks_.store(0);
+
+    for (uint32_t i = 0; i < initial_nodes_.size(); ++i) {
+        PushTask(i % nr_threads_, initial_nodes_[i]);
+    }
+
+    {
+        lock_guard<mutex> lck(mutex_);
+        nr_running_workers_ = workers_.size();
+        ++run_id_;
+    }
+    start_cond_.notify_all();
+
+    RunTasks(0);
+
+    {
+        unique_lock<mutex> lck(mutex_);
+        done_cond_.wait(lck, [this]() -> bool {
+            return (nr_running_workers_ == 0);
+        });
+    }
+
+    exec_func_ = nullptr;
+    profiler_ = nullptr;
+
+    return run_status_;
+}
+
+}} // namespace ppl::nn
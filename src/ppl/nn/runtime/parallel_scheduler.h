@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_PARALLEL_SCHEDULER_H_
+#define _ST_HPC_PPL_NN_RUNTIME_PARALLEL_SCHEDULER_H_
+
+#include "ppl/nn/runtime/scheduler.h"
+#include "ppl/nn/runtime/scheduler_common.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ppl { namespace nn {
+
+/**
+   @class ParallelScheduler
+   @brief runs kernels whose inputs are ready concurrently on a work-stealing thread pool.
+   @note an edge is still released by its last consumer in `sorted_nodes`. other consumers of
+   that edge are scheduled before the last one so that the release is safe.
+*/
+class ParallelScheduler final : public Scheduler {
+public:
+    /** @param nr_threads number of threads used, including the caller of `ForEach()`. 0 means using all cores. */
+    ParallelScheduler(uint32_t nr_threads = 0);
+    ~ParallelScheduler();
+
+    ppl::common::RetCode Init(const Options&) override;
+    ppl::common::RetCode ForEach(const std::function<ppl::common::RetCode(KernelImpl*, KernelExecContext*)>&,
+                                 Profiler*) override;
+    bool IsConcurrent() const override {
+        return true;
+    }
+
+    uint32_t GetThreadCount() const {
+        return nr_threads_;
+    }
+
+private:
+    struct TaskQueue final {
+        std::mutex mutex;
+        std::deque<nodeid_t> nodes;
+    };
+
+    ppl::common::RetCode InitDependencies();
+    void PushTask(uint32_t worker_idx, nodeid_t);
+    bool PopTask(uint32_t worker_idx, nodeid_t*);
+    ppl::common::RetCode ExecNode(nodeid_t, KernelExecContext*);
+    void RunTasks(uint32_t worker_idx);
+    void WorkerMain(uint32_t worker_idx);
+
+private:
+    const ir::GraphTopo* topo_;
+    const std::vector<nodeid_t>* sorted_nodes_;
+    const std::vector<nodeid_t>* edge_last_consumer_;
+    std::vector<EdgeObject*>* edgeid2object_;
+    std::vector<std::unique_ptr<KernelImpl>>* nodeid2kernel_;
+
+    std::function<EdgeObject*(edgeid_t, uint32_t)> acquire_object_func_;
+    std::function<ppl::common::RetCode(EdgeObject*, nodeid_t)> release_object_func_;
+
+    /** protects object pools and `edgeid2object_` */
+    std::mutex object_mutex_;
+    utils::EdgeObjectPools pools_;
+
+    // ----- dependencies ----- //
+
+    /** nodes that should be notified after a node finishes, indexed by nodeid */
+    std::vector<std::vector<nodeid_t>> successors_;
+    /** number of nodes that must finish before a node can run, indexed by nodeid */
+    std::vector<uint32_t> dependency_count_;
+    /** nodes without any dependency */
+    std::vector<nodeid_t> initial_nodes_;
+
+    // ----- per-run states ----- //
+
+    std::unique_ptr<std::atomic<uint32_t>[]> pending_count_;
+    std::atomic<uint32_t> nr_queued_tasks_;
+    std::atomic<uint32_t> nr_remaining_tasks_;
+    std::atomic<bool> has_error_;
+    ppl::common::RetCode run_status_;
+    const std::function<ppl::common::RetCode(KernelImpl*, KernelExecContext*)>* exec_func_ = nullptr;
+    Profiler* profiler_ = nullptr;
+
+    // ----- workers ----- //
+
+    uint32_t nr_threads_;
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cond_;
+    std::condition_variable task_cond_;
+    std::condition_variable done_cond_;
+    uint64_t run_id_ = 0;
+    uint32_t nr_running_workers_ = 0;
+    bool is_exiting_ = false;
+
+private:
+    ParallelScheduler(const ParallelScheduler&) = delete;
+    ParallelScheduler& operator=(const ParallelScheduler&) = delete;
+};
+
+}} // namespace ppl::nn
+
+#endif
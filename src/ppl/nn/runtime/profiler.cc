@@ -15,32 +15,164 @@
 // specific language governing permissions and limitations
 // under the License.
 
+
 #include "ppl/nn/runtime/profiler.h"
 #include "ppl/nn/common/logger.h"
+
+#ifdef PPLNN_ENABLE_KERNEL_PROFILING
+#include "ppl/nn/runtime/op_cost.h"
+#include "ppl/nn/runtime/tensor_impl.h"
+#include <algorithm>
+#endif
+
 using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn {
 
-void Profiler::Init(const vector<unique_ptr<KernelImpl>>* n2k, const RuntimeAuxInfo* aux_info) {
+void Profiler::Init(const vector<unique_ptr<KernelImpl>>* n2k, const vector<EdgeObject*>* e2o,
+                    const RuntimeAuxInfo* aux_info) {
     nodeid2kernel_ = n2k;
+    edgeid2object_ = e2o;
     aux_info_ = aux_info;
 }
 
 #ifdef PPLNN_ENABLE_KERNEL_PROFILING
+constexpr uint32_t Profiler::MAX_TRACE_EVENT_NUM;
+constexpr uint32_t Profiler::LatencyHistogram::LINEAR_BUCKET_NUM;
+constexpr uint32_t Profiler::LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint32_t Profiler::LatencyHistogram::BUCKET_NUM;
+
+uint32_t Profiler::LatencyHistogram::GetBucketIdx(uint64_t value) {
+    if (value < LINEAR_BUCKET_NUM) {
+        return (uint32_t)value;
+    }
+
+    uint32_t msb = 63;
+    while ((value >> msb) == 0) {
+        --msb;
+    }
+    // msb >= 4 here
+    const uint32_t sub_idx = (uint32_t)(value >> (msb - SUB_BUCKET_BITS)) & ((1 << SUB_BUCKET_BITS) - 1);
+    return LINEAR_BUCKET_NUM + ((msb - 4) << SUB_BUCKET_BITS) + sub_idx;
+}
+
+uint64_t Profiler::LatencyHistogram::GetBucketLowerBound(uint32_t idx) {
+    if (idx < LINEAR_BUCKET_NUM) {
+        return idx;
+    }
+
+    idx -= LINEAR_BUCKET_NUM;
+    const uint32_t msb = (idx >> SUB_BUCKET_BITS) + 4;
+    const uint64_t sub_idx = idx & ((1 << SUB_BUCKET_BITS) - 1);
+    return (uint64_t(1) << msb) + (sub_idx << (msb - SUB_BUCKET_BITS));
+}
+
+void Profiler::LatencyHistogram::Add(uint64_t value) {
+    ++buckets_[GetBucketIdx(value)];
+    ++count_;
+    if (value < min_) {
+        min_ = value;
+    }
+    if (value > max_) {
+        max_ = value;
+    }
+}
+
+uint64_t Profiler::LatencyHistogram::GetPercentile(uint32_t percent) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    if (percent == 0) {
+        return min_;
+    }
+    if (percent >= 100) {
+        return max_;
+    }
+
+    // rank of the value in ascending order, starting from 1
+    const uint64_t rank = (count_ - 1) * percent / 100 + 1;
+    uint64_t acc = 0;
+    for (uint32_t i = 0; i < BUCKET_NUM; ++i) {
+        acc += buckets_[i];
+        if (acc >= rank) {
+            // middle of the bucket, limited to the range of values
+            const uint64_t lower = GetBucketLowerBound(i);
+            const uint64_t upper = (i + 1 < BUCKET_NUM) ? GetBucketLowerBound(i + 1) : max_ + 1;
+            const uint64_t value = lower + (upper - lower - 1) / 2;
+            return std::min<uint64_t>(std::max<uint64_t>(value, min_), max_);
+        }
+    }
+
+    return max_;
+}
+
+static const TensorShape* GetTensorShape(const vector<EdgeObject*>& edgeid2object, edgeid_t eid) {
+    if (eid >= edgeid2object.size()) {
+        return nullptr;
+    }
+    auto obj = edgeid2object[eid];
+    if (!obj || obj->GetObjectType() != EdgeObject::T_TENSOR) {
+        return nullptr;
+    }
+    return static_cast<TensorImpl*>(obj)->GetShape();
+}
+
+uint32_t Profiler::GetThreadIdx() {
+    auto ret_pair = thread2idx_.insert(make_pair(std::this_thread::get_id(), thread2idx_.size()));
+    return ret_pair.first->second;
+}
+
 void Profiler::CollectStatistics(KernelImpl* kernel) {
-    auto info = &nodeid2info_[kernel->GetNode()->GetId()];
+    auto end_ts = std::chrono::steady_clock::now();
+
     InternalProfilingInfo intern_info;
     kernel->GetProfilingInfo(&intern_info);
+
+    // inputs and outputs are still alive here
+    auto node = kernel->GetNode();
+    vector<const TensorShape*> input_shapes(node->GetInputCount());
+    for (uint32_t i = 0; i < node->GetInputCount(); ++i) {
+        input_shapes[i] = GetTensorShape(*edgeid2object_, node->GetInput(i));
+    }
+    vector<const TensorShape*> output_shapes(node->GetOutputCount());
+    for (uint32_t i = 0; i < node->GetOutputCount(); ++i) {
+        output_shapes[i] = GetTensorShape(*edgeid2object_, node->GetOutput(i));
+    }
+    OpCost cost;
+    EstimateOpCost(node->GetType(), input_shapes, output_shapes, &cost);
+
+    lock_guard<mutex> lck(mutex_);
+
+    auto info = &nodeid2info_[node->GetId()];
     info->exec_microseconds += intern_info.exec_microseconds;
     ++info->exec_count;
+    info->total_flops += cost.flops;
+    info->total_bytes += cost.bytes;
+    info->exec_microseconds_hist.Add(intern_info.exec_microseconds);
+
+    if (trace_events_.size() < MAX_TRACE_EVENT_NUM) {
+        uint64_t end_us = std::chrono::duration_cast<std::chrono::microseconds>(end_ts - start_ts_).count();
+
+        TraceEvent event;
+        event.nid = node->GetId();
+        event.thread_idx = GetThreadIdx();
+        event.exec_microseconds = intern_info.exec_microseconds;
+        event.begin_microseconds = (end_us > event.exec_microseconds) ? end_us - event.exec_microseconds : 0;
+        trace_events_.push_back(event);
+    }
 }
 
 void Profiler::StartProfiling(nodeid_t max_node_id) {
     nodeid2info_.resize(max_node_id);
+    start_ts_ = std::chrono::steady_clock::now();
 }
 
 RetCode Profiler::GetProfilingStatistics(ProfilingStatistics* stat) const {
+    lock_guard<mutex> lck(mutex_);
+
+    vector<uint32_t> nid2idx(nodeid2info_.size(), UINT32_MAX);
+
     stat->prof_info.reserve(aux_info_->sorted_nodes.size());
     for (auto x = aux_info_->sorted_nodes.begin(); x != aux_info_->sorted_nodes.end(); ++x) {
         auto nid = *x;
@@ -54,14 +186,36 @@ RetCode Profiler::GetProfilingStatistics(ProfilingStatistics* stat) const {
         kernel_prof_info.type = op_type.name;
         kernel_prof_info.exec_microseconds = info.exec_microseconds;
         kernel_prof_info.exec_count = info.exec_count;
+        kernel_prof_info.total_flops = info.total_flops;
+        kernel_prof_info.total_bytes = info.total_bytes;
+
+        auto& hist = info.exec_microseconds_hist;
+        kernel_prof_info.min_exec_microseconds = hist.GetMin();
+        kernel_prof_info.max_exec_microseconds = hist.GetMax();
+        kernel_prof_info.p50_exec_microseconds = hist.GetPercentile(50);
+        kernel_prof_info.p99_exec_microseconds = hist.GetPercentile(99);
+
+        nid2idx[nid] = stat->prof_info.size();
         stat->prof_info.emplace_back(std::move(kernel_prof_info));
     }
 
+    stat->trace_events.reserve(trace_events_.size());
+    for (auto e = trace_events_.begin(); e != trace_events_.end(); ++e) {
+        KernelTraceEvent event;
+        event.kernel_idx = nid2idx[e->nid];
+        event.thread_idx = e->thread_idx;
+        event.begin_microseconds = e->begin_microseconds;
+        event.exec_microseconds = e->exec_microseconds;
+        stat->trace_events.push_back(event);
+    }
+
     return RC_SUCCESS;
 }
 
 void Profiler::StopProfiling() {
     nodeid2info_.clear();
+    trace_events_.clear();
+    thread2idx_.clear();
 }
 #endif
 
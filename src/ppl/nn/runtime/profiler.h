@@ -24,16 +24,21 @@
 #ifdef PPLNN_ENABLE_KERNEL_PROFILING
 #include "ppl/nn/runtime/profiling_statistics.h"
 #include <chrono>
+#include <mutex>
+#include <thread>
+#include <map>
 #endif
 
 namespace ppl { namespace nn {
 
 class Profiler final {
 public:
-    void Init(const std::vector<std::unique_ptr<KernelImpl>>* n2k, const RuntimeAuxInfo* aux_info);
+    void Init(const std::vector<std::unique_ptr<KernelImpl>>* n2k, const std::vector<EdgeObject*>* e2o,
+              const RuntimeAuxInfo* aux_info);
 
 #ifdef PPLNN_ENABLE_KERNEL_PROFILING
-    void CollectStatistics(KernelImpl*);
+    /** @note MUST be called after `kernel` is executed and before its inputs and outputs are released */
+    void CollectStatistics(KernelImpl* kernel);
 
 public:
     void StartProfiling(nodeid_t max_node_id);
@@ -41,16 +46,67 @@ public:
     void StopProfiling();
 
 private:
+    static constexpr uint32_t MAX_TRACE_EVENT_NUM = 1000000;
+
+    /**
+       fixed-size histogram of execution time. values less than 16 have their own buckets. larger values are split
+       into 8 buckets per power of 2, so percentiles have a relative error less than 1/8.
+    */
+    class LatencyHistogram final {
+    public:
+        void Add(uint64_t value);
+        /** @brief returns the approximate `percent`-th percentile. 0 if there is no value. */
+        uint64_t GetPercentile(uint32_t percent) const;
+        uint64_t GetMin() const {
+            return (count_ == 0) ? 0 : min_;
+        }
+        uint64_t GetMax() const {
+            return max_;
+        }
+
+    private:
+        static constexpr uint32_t LINEAR_BUCKET_NUM = 16;
+        static constexpr uint32_t SUB_BUCKET_BITS = 3;
+        static constexpr uint32_t BUCKET_NUM = LINEAR_BUCKET_NUM + (64 - 4) * (1 << SUB_BUCKET_BITS);
+
+        static uint32_t GetBucketIdx(uint64_t value);
+        static uint64_t GetBucketLowerBound(uint32_t idx);
+
+    private:
+        uint64_t count_ = 0;
+        uint64_t min_ = UINT64_MAX;
+        uint64_t max_ = 0;
+        uint64_t buckets_[BUCKET_NUM] = {0};
+    };
+
     struct KernelExecInfo final {
         uint32_t exec_count = 0;
         uint64_t exec_microseconds = 0;
+        uint64_t total_flops = 0;
+        uint64_t total_bytes = 0;
+        LatencyHistogram exec_microseconds_hist;
+    };
+
+    struct TraceEvent final {
+        nodeid_t nid;
+        uint32_t thread_idx;
+        uint64_t begin_microseconds;
+        uint64_t exec_microseconds;
     };
 
+    uint32_t GetThreadIdx();
+
+    /** kernels may be executed by multiple threads */
+    mutable std::mutex mutex_;
     std::vector<KernelExecInfo> nodeid2info_;
+    std::vector<TraceEvent> trace_events_;
+    std::map<std::thread::id, uint32_t> thread2idx_;
+    std::chrono::time_point<std::chrono::steady_clock> start_ts_;
 #endif
 
 private:
     const std::vector<std::unique_ptr<KernelImpl>>* nodeid2kernel_;
+    const std::vector<EdgeObject*>* edgeid2object_;
     const RuntimeAuxInfo* aux_info_;
 };
 
@@ -21,6 +21,7 @@
 #include "ppl/nn/common/tensor_shape.h"
 #include "ppl/nn/common/buffer_info.h"
 #include "ppl/nn/runtime/opt_kernel.h"
+#include "ppl/common/mmap.h"
 #include <vector>
 #include <map>
 
@@ -45,8 +46,11 @@ struct RuntimeGraphInfo final {
     void Clear() {
         shapes.clear();
         partitions.clear();
+        mapped_files.clear();
     }
 
+    /** model files that constants may refer to directly. it must be destroyed after `partitions`. */
+    std::vector<std::shared_ptr<ppl::common::Mmap>> mapped_files;
     std::map<edgeid_t, TensorShape> shapes;
     std::vector<Partition> partitions;
 };
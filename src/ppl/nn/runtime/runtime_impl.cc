@@ -20,6 +20,7 @@
 #include "ppl/nn/runtime/runtime_impl.h"
 #include "ppl/nn/runtime/partition_runner_impl.h"
 #include "ppl/nn/runtime/sequential_scheduler.h"
+#include "ppl/nn/runtime/parallel_scheduler.h"
 #include "ppl/nn/ir/utils.h"
 #include "ppl/nn/utils/utils.h"
 #include <stdarg.h>
@@ -335,6 +336,72 @@ RetCode RuntimeImpl::GetProfilingStatistics(ProfilingStatistics* stat) const {
 #endif
 }
 
+RetCode RuntimeImpl::GetMemoryStatistics(MemoryStatistics* stat) const {
+    stat->constant_bytes = 0;
+    for (auto p = graph_info_->partitions.begin(); p != graph_info_->partitions.end(); ++p) {
+        for (auto c = p->constants.begin(); c != p->constants.end(); ++c) {
+            auto shape_ref = graph_info_->shapes.find(c->first);
+            if (shape_ref != graph_info_->shapes.end()) {
+                stat->constant_bytes += shape_ref->second.CalcBytesIncludingPadding();
+            }
+        }
+    }
+
+    stat->device_stat.clear();
+    for (auto e = engctx_.begin(); e != engctx_.end(); ++e) {
+        auto dev = e->get()->GetDevice();
+        if (!dev) {
+            continue;
+        }
+
+        DeviceMemoryStatistics dev_stat;
+        dev_stat.buffered_bytes = 0;
+        dev_stat.used_bytes = 0;
+        dev_stat.peak_used_bytes = 0;
+        dev_stat.max_tmp_buffer_bytes = 0;
+        dev_stat.largest_free_block_bytes = 0;
+        auto rc = dev->GetMemoryStatistics(&dev_stat);
+        if (rc != RC_SUCCESS && rc != RC_UNSUPPORTED) {
+            LOG(ERROR) << "get memory statistics of [" << e->get()->GetName() << "] failed: " << GetRetCodeStr(rc);
+            return rc;
+        }
+        dev_stat.name = e->get()->GetName();
+        stat->device_stat.push_back(dev_stat);
+    }
+
+    vector<uint32_t> nid2step(topo_->GetCurrentNodeIdBound(), UINT32_MAX);
+    for (uint32_t i = 0; i < aux_info_->sorted_nodes.size(); ++i) {
+        nid2step[aux_info_->sorted_nodes[i]] = i;
+    }
+
+    stat->edge_info.clear();
+    for (uint32_t i = 0; i < aux_info_->sorted_nodes.size(); ++i) {
+        auto node = topo_->GetNode(aux_info_->sorted_nodes[i]);
+        for (uint32_t j = 0; j < node->GetOutputCount(); ++j) {
+            auto eid = node->GetOutput(j);
+            if (eid == INVALID_EDGEID) {
+                continue;
+            }
+
+            auto obj = edgeid2object_[eid];
+            if (!obj || obj->GetObjectType() != EdgeObject::T_TENSOR) {
+                continue;
+            }
+
+            auto tensor = static_cast<TensorImpl*>(obj);
+            EdgeMemoryInfo info;
+            info.name = tensor->GetName();
+            info.bytes = tensor->GetShape()->CalcBytesIncludingPadding();
+            info.producer_step = i;
+            auto last_consumer = aux_info_->edge_last_consumer[eid];
+            info.last_consumer_step = (last_consumer == INVALID_NODEID) ? UINT32_MAX : nid2step[last_consumer];
+            stat->edge_info.push_back(info);
+        }
+    }
+
+    return RC_SUCCESS;
+}
+
 Tensor* RuntimeImpl::GetTensor(const char* name) const {
     const string name_s(name);
     auto ref = reserved_tensors_.find(name_s);
@@ -455,7 +522,7 @@ RetCode RuntimeImpl::ConfSetProfilingFlag(RuntimeImpl* rt, va_list args) {
     if (profiling_flag) {
         if (!rt->profiler_) {
             rt->profiler_ = make_shared<Profiler>();
-            rt->profiler_->Init(&rt->nodeid2kernel_, rt->aux_info_.get());
+            rt->profiler_->Init(&rt->nodeid2kernel_, &rt->edgeid2object_, rt->aux_info_.get());
             rt->profiler_->StartProfiling(rt->topo_->GetCurrentNodeIdBound());
         }
     } else {
@@ -480,8 +547,27 @@ RetCode RuntimeImpl::ConfInferShapes(RuntimeImpl* rt, va_list) {
         nullptr);
 }
 
+static RetCode CheckConcurrentSafe(const vector<unique_ptr<EngineContext>>& engctx) {
+    for (auto e = engctx.begin(); e != engctx.end(); ++e) {
+        auto dev = e->get()->GetDevice();
+        if (dev && !dev->IsConcurrentSafe()) {
+            LOG(ERROR) << "device of engine context[" << e->get()->GetName()
+                       << "] does not support concurrent allocations. concurrent schedulers are not supported.";
+            return RC_UNSUPPORTED;
+        }
+    }
+    return RC_SUCCESS;
+}
+
 RetCode RuntimeImpl::ConfSetScheduler(RuntimeImpl* rt, va_list args) {
     auto sched = va_arg(args, Scheduler*);
+    if (sched->IsConcurrent()) {
+        auto rc = CheckConcurrentSafe(rt->engctx_);
+        if (rc != RC_SUCCESS) {
+            return rc;
+        }
+    }
+
     auto rc =
         sched->Init(Scheduler::Options(rt->topo_.get(), &rt->aux_info_->sorted_nodes,
                                        &rt->aux_info_->edge_last_consumer, &rt->edgeid2object_, &rt->nodeid2kernel_));
@@ -494,10 +580,74 @@ RetCode RuntimeImpl::ConfSetScheduler(RuntimeImpl* rt, va_list args) {
     return RC_SUCCESS;
 }
 
+RetCode RuntimeImpl::ConfSetParallelScheduler(RuntimeImpl* rt, va_list args) {
+    auto nr_threads = va_arg(args, uint32_t);
+
+    auto rc = CheckConcurrentSafe(rt->engctx_);
+    if (rc != RC_SUCCESS) {
+        return rc;
+    }
+
+    unique_ptr<ParallelScheduler> sched(new ParallelScheduler(nr_threads));
+    rc =
+        sched->Init(Scheduler::Options(rt->topo_.get(), &rt->aux_info_->sorted_nodes,
+                                       &rt->aux_info_->edge_last_consumer, &rt->edgeid2object_, &rt->nodeid2kernel_));
+    if (rc != RC_SUCCESS) {
+        LOG(ERROR) << "init ParallelScheduler failed: " << GetRetCodeStr(rc);
+        return rc;
+    }
+
+    rt->sched_ = std::move(sched);
+    return RC_SUCCESS;
+}
+
+RetCode RuntimeImpl::ConfTrimMemory(RuntimeImpl* rt, va_list args) {
+    auto released_bytes = va_arg(args, uint64_t*);
+
+    uint64_t bytes = 0;
+    for (auto e = rt->engctx_.begin(); e != rt->engctx_.end(); ++e) {
+        auto dev = e->get()->GetDevice();
+        if (dev) {
+            bytes += dev->TrimMemory(0);
+        }
+    }
+
+    if (released_bytes) {
+        *released_bytes = bytes;
+    }
+    return RC_SUCCESS;
+}
+
+RetCode RuntimeImpl::ConfBindCpus(RuntimeImpl* rt, va_list args) {
+    auto cpu_ids = va_arg(args, const uint32_t*);
+    auto cpu_num = va_arg(args, uint32_t);
+
+    bool is_bound = false;
+    for (auto e = rt->engctx_.begin(); e != rt->engctx_.end(); ++e) {
+        auto dev = e->get()->GetDevice();
+        if (!dev) {
+            continue;
+        }
+
+        auto rc = dev->BindCpus(cpu_ids, cpu_num);
+        if (rc == RC_SUCCESS) {
+            is_bound = true;
+        } else if (rc != RC_UNSUPPORTED) {
+            LOG(ERROR) << "bind cpus of engine context[" << e->get()->GetName() << "] failed: " << GetRetCodeStr(rc);
+            return rc;
+        }
+    }
+
+    return is_bound ? RC_SUCCESS : RC_UNSUPPORTED;
+}
+
 RuntimeImpl::ConfHandlerFunc RuntimeImpl::conf_handlers_[] = {
     RuntimeImpl::ConfSetProfilingFlag,
     RuntimeImpl::ConfInferShapes,
     RuntimeImpl::ConfSetScheduler,
+    RuntimeImpl::ConfSetParallelScheduler,
+    RuntimeImpl::ConfTrimMemory,
+    RuntimeImpl::ConfBindCpus,
 };
 
 RetCode RuntimeImpl::Configure(uint32_t option, ...) {
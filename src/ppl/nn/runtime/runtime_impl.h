@@ -95,6 +95,8 @@ public:
 
     ppl::common::RetCode GetProfilingStatistics(ProfilingStatistics* stat) const override;
 
+    ppl::common::RetCode GetMemoryStatistics(MemoryStatistics* stat) const override;
+
 private:
     std::shared_ptr<Scheduler> sched_;
 
@@ -128,6 +130,9 @@ private:
     static ppl::common::RetCode ConfSetProfilingFlag(RuntimeImpl*, va_list);
     static ppl::common::RetCode ConfInferShapes(RuntimeImpl*, va_list);
     static ppl::common::RetCode ConfSetScheduler(RuntimeImpl*, va_list);
+    static ppl::common::RetCode ConfSetParallelScheduler(RuntimeImpl*, va_list);
+    static ppl::common::RetCode ConfTrimMemory(RuntimeImpl*, va_list);
+    static ppl::common::RetCode ConfBindCpus(RuntimeImpl*, va_list);
 
     typedef ppl::common::RetCode (*ConfHandlerFunc)(RuntimeImpl*, va_list);
     static ConfHandlerFunc conf_handlers_[RUNTIME_CONF_MAX];
@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/runtime/runtime_pool_impl.h"
+#include "ppl/nn/runtime/options.h"
+#include "ppl/nn/common/logger.h"
+#include <chrono>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn {
+
+RuntimePoolImpl::~RuntimePoolImpl() {
+    slots_.clear();
+}
+
+RetCode RuntimePoolImpl::Init(Runtime** runtimes, const RuntimePoolOptions& options) {
+    if (options.runtime_num == 0) {
+        LOG(ERROR) << "runtime_num is 0.";
+        return RC_INVALID_VALUE;
+    }
+
+    // takes the ownership first
+    bool has_invalid_runtime = false;
+    slots_.resize(options.runtime_num);
+    for (uint32_t i = 0; i < options.runtime_num; ++i) {
+        if (!runtimes[i]) {
+            LOG(ERROR) << "runtime[" << i << "] is null.";
+            has_invalid_runtime = true;
+            continue;
+        }
+
+        auto ret_pair = runtime2idx_.insert(make_pair(runtimes[i], i));
+        if (!ret_pair.second) {
+            LOG(ERROR) << "runtime[" << i << "] is the same as runtime[" << ret_pair.first->second << "]";
+            has_invalid_runtime = true;
+            continue;
+        }
+
+        slots_[i].runtime.reset(runtimes[i]);
+    }
+    if (has_invalid_runtime) {
+        return RC_INVALID_VALUE;
+    }
+
+    if (!options.cpu_sets.empty()) {
+#ifdef __linux__
+        if (options.cpu_sets.size() != options.runtime_num) {
+            LOG(ERROR) << "number of cpu sets [" << options.cpu_sets.size() << "] != runtime_num ["
+                       << options.runtime_num << "]";
+            return RC_INVALID_VALUE;
+        }
+
+        for (uint32_t i = 0; i < options.runtime_num; ++i) {
+            auto& cpus = options.cpu_sets[i];
+            for (auto c = cpus.begin(); c != cpus.end(); ++c) {
+                if (*c >= CPU_SETSIZE) {
+                    LOG(ERROR) << "cpu id [" << *c << "] of runtime[" << i << "] >= [" << CPU_SETSIZE << "]";
+                    return RC_INVALID_VALUE;
+                }
+            }
+            slots_[i].cpus = cpus;
+
+            // threads used by kernels, e.g. OpenMP threads of x86 kernels, are bound once and kept
+            auto rc = slots_[i].runtime->Configure(RUNTIME_CONF_BIND_CPUS, cpus.data(), (uint32_t)cpus.size());
+            if (rc == RC_UNSUPPORTED) {
+                LOG(WARNING) << "threads used by kernels of runtime[" << i << "] cannot be bound. only the thread "
+                             << "acquiring it is bound.";
+            } else if (rc != RC_SUCCESS) {
+                LOG(ERROR) << "bind cpus of runtime[" << i << "] failed: " << GetRetCodeStr(rc);
+                return rc;
+            }
+        }
+#else
+        LOG(ERROR) << "binding runtimes to cpus is not supported on this platform.";
+        return RC_UNSUPPORTED;
+#endif
+    }
+
+    idle_slots_.reserve(options.runtime_num);
+    for (uint32_t i = options.runtime_num; i > 0; --i) {
+        idle_slots_.push_back(i - 1);
+    }
+
+    return RC_SUCCESS;
+}
+
+Runtime* RuntimePoolImpl::BindSlot(uint32_t idx) {
+    auto& slot = slots_[idx];
+#ifdef __linux__
+    if (!slot.cpus.empty()) {
+        auto thread = pthread_self();
+        slot.is_bound = (pthread_getaffinity_np(thread, sizeof(cpu_set_t), &slot.saved_cpu_set) == 0);
+        if (slot.is_bound) {
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            for (auto c = slot.cpus.begin(); c != slot.cpus.end(); ++c) {
+                CPU_SET(*c, &cpu_set);
+            }
+            if (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpu_set) != 0) {
+                LOG(WARNING) << "bind thread to cpus of runtime[" << idx << "] failed.";
+                slot.is_bound = false;
+            }
+        }
+    }
+#endif
+    return slot.runtime.get();
+}
+
+void RuntimePoolImpl::UnbindSlot(uint32_t idx) {
+#ifdef __linux__
+    auto& slot = slots_[idx];
+    if (slot.is_bound) {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &slot.saved_cpu_set);
+        slot.is_bound = false;
+    }
+#endif
+}
+
+Runtime* RuntimePoolImpl::Acquire() {
+    auto begin_ts = std::chrono::steady_clock::now();
+
+    uint32_t idx;
+    {
+        unique_lock<mutex> lck(mutex_);
+        if (idle_slots_.empty()) {
+            ++queue_depth_;
+            if (queue_depth_ > max_queue_depth_) {
+                max_queue_depth_ = queue_depth_;
+            }
+            cond_.wait(lck, [this]() -> bool {
+                return !idle_slots_.empty();
+            });
+            --queue_depth_;
+        }
+
+        idx = idle_slots_.back();
+        idle_slots_.pop_back();
+        slots_[idx].in_use = true;
+
+        auto end_ts = std::chrono::steady_clock::now();
+        uint64_t wait_us = std::chrono::duration_cast<std::chrono::microseconds>(end_ts - begin_ts).count();
+        ++acquire_count_;
+        total_wait_microseconds_ += wait_us;
+        if (wait_us > max_wait_microseconds_) {
+            max_wait_microseconds_ = wait_us;
+        }
+    }
+
+    return BindSlot(idx);
+}
+
+Runtime* RuntimePoolImpl::TryAcquire() {
+    uint32_t idx;
+    {
+        lock_guard<mutex> lck(mutex_);
+        if (idle_slots_.empty()) {
+            return nullptr;
+        }
+
+        idx = idle_slots_.back();
+        idle_slots_.pop_back();
+        slots_[idx].in_use = true;
+        ++acquire_count_;
+    }
+
+    return BindSlot(idx);
+}
+
+RetCode RuntimePoolImpl::Release(Runtime* runtime) {
+    auto ref = runtime2idx_.find(runtime);
+    if (ref == runtime2idx_.end()) {
+        LOG(ERROR) << "runtime[" << runtime << "] does not belong to this pool.";
+        return RC_NOT_FOUND;
+    }
+
+    {
+        lock_guard<mutex> lck(mutex_);
+        auto& slot = slots_[ref->second];
+        if (!slot.in_use) {
+            LOG(ERROR) << "runtime[" << runtime << "] is not acquired or has already been released.";
+            return RC_INVALID_VALUE;
+        }
+
+        UnbindSlot(ref->second);
+        slot.in_use = false;
+        idle_slots_.push_back(ref->second);
+    }
+    cond_.notify_one();
+
+    return RC_SUCCESS;
+}
+
+RetCode RuntimePoolImpl::GetStatistics(RuntimePoolStatistics* stat) const {
+    lock_guard<mutex> lck(mutex_);
+    stat->runtime_num = slots_.size();
+    stat->idle_runtime_num = idle_slots_.size();
+    stat->queue_depth = queue_depth_;
+    stat->max_queue_depth = max_queue_depth_;
+    stat->acquire_count = acquire_count_;
+    stat->total_wait_microseconds = total_wait_microseconds_;
+    stat->max_wait_microseconds = max_wait_microseconds_;
+    return RC_SUCCESS;
+}
+
+}} // namespace ppl::nn
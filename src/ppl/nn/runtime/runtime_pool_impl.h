@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_IMPL_H_
+#define _ST_HPC_PPL_NN_RUNTIME_RUNTIME_POOL_IMPL_H_
+
+#include "ppl/nn/runtime/runtime_pool.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace ppl { namespace nn {
+
+class RuntimePoolImpl final : public RuntimePool {
+public:
+    RuntimePoolImpl() {}
+    ~RuntimePoolImpl();
+
+    /** @note takes the ownership of `runtimes` */
+    ppl::common::RetCode Init(Runtime** runtimes, const RuntimePoolOptions&);
+
+    uint32_t GetRuntimeCount() const override {
+        return slots_.size();
+    }
+
+    Runtime* Acquire() override;
+    Runtime* TryAcquire() override;
+    ppl::common::RetCode Release(Runtime*) override;
+    ppl::common::RetCode GetStatistics(RuntimePoolStatistics*) const override;
+
+private:
+    struct Slot final {
+        std::unique_ptr<Runtime> runtime;
+        std::vector<uint32_t> cpus;
+        /** whether this runtime is acquired. protected by `mutex_`. */
+        bool in_use = false;
+#ifdef __linux__
+        /** affinity of the thread before acquiring this runtime */
+        cpu_set_t saved_cpu_set;
+        bool is_bound = false;
+#endif
+    };
+
+    Runtime* BindSlot(uint32_t idx);
+    void UnbindSlot(uint32_t idx);
+
+private:
+    std::vector<Slot> slots_;
+    /** not modified after Init() */
+    std::unordered_map<Runtime*, uint32_t> runtime2idx_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    /** the most recently released runtime is used first */
+    std::vector<uint32_t> idle_slots_;
+
+    // ----- statistics ----- //
+
+    uint32_t queue_depth_ = 0;
+    uint32_t max_queue_depth_ = 0;
+    uint64_t acquire_count_ = 0;
+    uint64_t total_wait_microseconds_ = 0;
+    uint64_t max_wait_microseconds_ = 0;
+
+private:
+    RuntimePoolImpl(const RuntimePoolImpl&) = delete;
+    RuntimePoolImpl& operator=(const RuntimePoolImpl&) = delete;
+};
+
+}} // namespace ppl::nn
+
+#endif
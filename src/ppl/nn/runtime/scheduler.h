@@ -41,6 +41,10 @@ public:
     virtual ppl::common::RetCode Init(const Options&) = 0;
     virtual ppl::common::RetCode ForEach(const std::function<ppl::common::RetCode(KernelImpl*, KernelExecContext*)>&,
                                          Profiler*) = 0;
+    /** @brief returns true if kernels may be executed by more than one thread at the same time */
+    virtual bool IsConcurrent() const {
+        return false;
+    }
 };
 
 }} // namespace ppl::nn
@@ -64,4 +64,74 @@ RetCode ReleaseKernelInputOutput(KernelImpl* kernel, InputOutputInfo* ctx,
     return RC_SUCCESS;
 }
 
+EdgeObject* AcquireEdgeObject(edgeid_t eid, uint32_t etype, EdgeObjectPools* pools) {
+    if (eid >= pools->edgeid2object->size()) {
+        return nullptr;
+    }
+
+    unique_lock<mutex> lck;
+    if (pools->mutex) {
+        lck = unique_lock<mutex>(*pools->mutex);
+    }
+
+    auto object = pools->edgeid2object->at(eid);
+    if (!object) {
+        auto edge = pools->topo->GetEdge(eid);
+
+        if (etype == EdgeObject::T_TENSOR) {
+            auto tensor = pools->tensor_pool.Alloc(edge, TENSORTYPE_NORMAL);
+            object = tensor;
+        } else if (etype == EdgeObject::T_TENSOR_SEQUENCE) {
+            object = pools->tensor_sequence_pool.Alloc(edge);
+        } else if (etype == EdgeObject::T_EDGE_OBJECT) {
+            return nullptr;
+        } else {
+            LOG(ERROR) << "invalid object type[" << etype << "] of edge[" << edge->GetName() << "]";
+            return nullptr;
+        }
+
+        if (!object) {
+            LOG(ERROR) << "create output object[" << edge->GetName() << "] failed, oom";
+            return nullptr;
+        }
+        pools->edgeid2object->at(eid) = object;
+    }
+    return object;
+}
+
+RetCode ReleaseEdgeObject(EdgeObject* object, nodeid_t user, EdgeObjectPools* pools) {
+    auto eid = object->GetEdge()->GetId();
+    if (pools->edge_last_consumer->at(eid) != user) {
+        return RC_SUCCESS;
+    }
+
+    auto obj = pools->edgeid2object->at(eid);
+
+    auto barrier = obj->GetBarrier();
+    if (barrier) {
+        auto status = barrier->Sync();
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "sync edge[" << obj->GetEdge()->GetName() << "] failed: " << GetRetCodeStr(status);
+            return status;
+        }
+    }
+
+    unique_lock<mutex> lck;
+    if (pools->mutex) {
+        lck = unique_lock<mutex>(*pools->mutex);
+    }
+
+    if (obj->GetObjectType() == EdgeObject::T_TENSOR) {
+        pools->tensor_pool.Free(static_cast<TensorImpl*>(obj));
+    } else if (obj->GetObjectType() == EdgeObject::T_TENSOR_SEQUENCE) {
+        pools->tensor_sequence_pool.Free(static_cast<TensorSequence*>(obj));
+    } else {
+        LOG(ERROR) << "invalid edge object type[" << obj->GetObjectType() << "]";
+        return RC_INVALID_VALUE;
+    }
+    pools->edgeid2object->at(eid) = nullptr;
+
+    return RC_SUCCESS;
+}
+
 }}} // namespace ppl::nn::utils
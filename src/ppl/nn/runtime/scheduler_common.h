@@ -18,15 +18,41 @@
 #ifndef _ST_HPC_PPL_NN_RUNTIME_SCHEDULER_COMMON_H_
 #define _ST_HPC_PPL_NN_RUNTIME_SCHEDULER_COMMON_H_
 
+#include "ppl/common/object_pool.h"
 #include "ppl/nn/runtime/kernel_impl.h"
 #include "ppl/nn/runtime/edge_object.h"
+#include "ppl/nn/runtime/tensor_impl.h"
+#include "ppl/nn/runtime/tensor_sequence.h"
 #include <functional>
+#include <mutex>
 
 namespace ppl { namespace nn { namespace utils {
 
 ppl::common::RetCode ReleaseKernelInputOutput(KernelImpl*, InputOutputInfo*,
                                               const std::function<ppl::common::RetCode(EdgeObject*, nodeid_t)>&);
 
+/** @brief edge objects created by schedulers and the states needed to manage them */
+struct EdgeObjectPools final {
+    const ir::GraphTopo* topo = nullptr;
+    const std::vector<nodeid_t>* edge_last_consumer = nullptr;
+    std::vector<EdgeObject*>* edgeid2object = nullptr;
+
+    /** used to accelerlate tensor allocations */
+    ppl::common::ObjectPool<TensorImpl> tensor_pool;
+
+    /** used to accelerlate tensor sequence allocations */
+    ppl::common::ObjectPool<TensorSequence> tensor_sequence_pool;
+
+    /** protects object pools and `edgeid2object` if not null. used by schedulers that run kernels concurrently. */
+    std::mutex* mutex = nullptr;
+};
+
+/** @brief returns the object of edge `eid`, creating one of type `etype` if it does not exist. */
+EdgeObject* AcquireEdgeObject(edgeid_t eid, uint32_t etype, EdgeObjectPools*);
+
+/** @brief frees the object of edge `eid` if `user` is its last consumer. */
+ppl::common::RetCode ReleaseEdgeObject(EdgeObject*, nodeid_t user, EdgeObjectPools*);
+
 }}} // namespace ppl::nn::utils
 
 #endif
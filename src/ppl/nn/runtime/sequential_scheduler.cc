@@ -29,60 +29,11 @@ namespace ppl { namespace nn {
 
 SequentialScheduler::SequentialScheduler() {
     acquire_object_func_ = [this](edgeid_t eid, uint32_t etype) -> EdgeObject* {
-        if (eid >= edgeid2object_->size()) {
-            return nullptr;
-        }
-
-        auto object = edgeid2object_->at(eid);
-        if (!object) {
-            auto edge = topo_->GetEdge(eid);
-
-            if (etype == EdgeObject::T_TENSOR) {
-                auto tensor = tensor_pool_.Alloc(edge, TENSORTYPE_NORMAL);
-                object = tensor;
-            } else if (etype == EdgeObject::T_TENSOR_SEQUENCE) {
-                object = tensor_sequence_pool_.Alloc(edge);
-            } else if (etype == EdgeObject::T_EDGE_OBJECT) {
-                return nullptr;
-            } else {
-                LOG(ERROR) << "invalid object type[" << etype << "] of edge[" << edge->GetName() << "]";
-                return nullptr;
-            }
-
-            if (!object) {
-                LOG(ERROR) << "create output object[" << edge->GetName() << "] failed, oom";
-                return nullptr;
-            }
-            edgeid2object_->at(eid) = object;
-        }
-        return object;
+        return utils::AcquireEdgeObject(eid, etype, &pools_);
     };
 
     release_object_func_ = [this](EdgeObject* object, nodeid_t user) -> RetCode {
-        auto eid = object->GetEdge()->GetId();
-        if (edge_last_consumer_->at(eid) == user) {
-            auto obj = edgeid2object_->at(eid);
-
-            auto barrier = obj->GetBarrier();
-            if (barrier) {
-                auto status = barrier->Sync();
-                if (status != RC_SUCCESS) {
-                    LOG(ERROR) << "sync edge[" << obj->GetEdge()->GetName() << "] failed: " << GetRetCodeStr(status);
-                    return status;
-                }
-            }
-
-            if (obj->GetObjectType() == EdgeObject::T_TENSOR) {
-                tensor_pool_.Free(static_cast<TensorImpl*>(obj));
-            } else if (obj->GetObjectType() == EdgeObject::T_TENSOR_SEQUENCE) {
-                tensor_sequence_pool_.Free(static_cast<TensorSequence*>(obj));
-            } else {
-                LOG(ERROR) << "invalid edge object type[" << obj->GetObjectType() << "]";
-                return RC_INVALID_VALUE;
-            }
-            edgeid2object_->at(eid) = nullptr;
-        }
-        return RC_SUCCESS;
+        return utils::ReleaseEdgeObject(object, user, &pools_);
     };
 }
 
@@ -92,6 +43,10 @@ RetCode SequentialScheduler::Init(const Options& options) {
     edge_last_consumer_ = options.edge_last_consumer;
     edgeid2object_ = options.edgeid2object;
     nodeid2kernel_ = options.nodeid2kernel;
+
+    pools_.topo = topo_;
+    pools_.edge_last_consumer = edge_last_consumer_;
+    pools_.edgeid2object = edgeid2object_;
     return RC_SUCCESS;
 }
 
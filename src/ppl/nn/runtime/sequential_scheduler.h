@@ -18,10 +18,8 @@
 #ifndef _ST_HPC_PPL_NN_RUNTIME_SEQUENTIAL_SCHEDULER_H_
 #define _ST_HPC_PPL_NN_RUNTIME_SEQUENTIAL_SCHEDULER_H_
 
-#include "ppl/common/object_pool.h"
 #include "ppl/nn/runtime/scheduler.h"
-#include "ppl/nn/runtime/tensor_impl.h"
-#include "ppl/nn/runtime/tensor_sequence.h"
+#include "ppl/nn/runtime/scheduler_common.h"
 
 namespace ppl { namespace nn {
 
@@ -41,12 +39,7 @@ private:
 
     std::function<EdgeObject*(edgeid_t, uint32_t)> acquire_object_func_;
     std::function<ppl::common::RetCode(EdgeObject*, nodeid_t)> release_object_func_;
-
-    /** used to accelerlate tensor allocations */
-    ppl::common::ObjectPool<TensorImpl> tensor_pool_;
-
-    /** used to accelerlate tensor sequence allocations */
-    ppl::common::ObjectPool<TensorSequence> tensor_sequence_pool_;
+    utils::EdgeObjectPools pools_;
 };
 
 }} // namespace ppl::nn
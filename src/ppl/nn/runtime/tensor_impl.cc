@@ -22,7 +22,66 @@ using namespace ppl::common;
 
 namespace ppl { namespace nn {
 
+RetCode TensorImpl::BindHostBuffer(void* buf, uint64_t bytes) {
+    if (!buf) {
+        LOG(ERROR) << "cannot bind an empty host buffer to tensor[" << GetName() << "]";
+        return RC_INVALID_VALUE;
+    }
+
+    auto dev = buffer_info_.GetDevice();
+    if (!dev || !dev->CanUseHostBuffer(buf)) {
+        LOG(DEBUG) << "host buffer [" << buf << "] cannot be used by tensor[" << GetName() << "] directly.";
+        return RC_UNSUPPORTED;
+    }
+
+    auto shape = buffer_info_.GetShape();
+    if (shape->GetDataFormat() != DATAFORMAT_NDARRAY || shape->CalcBytesIncludingPadding() > bytes) {
+        LOG(DEBUG) << "host buffer of [" << bytes << "] bytes cannot hold data of tensor[" << GetName() << "] in ["
+                   << GetDataFormatStr(shape->GetDataFormat()) << "] of [" << shape->CalcBytesIncludingPadding()
+                   << "] bytes.";
+        return RC_UNSUPPORTED;
+    }
+
+    buffer_info_.SetBuffer(BufferDesc(buf));
+    bound_host_buffer_ = buf;
+    bound_host_buffer_bytes_ = bytes;
+    return RC_SUCCESS;
+}
+
+void TensorImpl::TransferBufferFrom(TensorImpl* another) {
+    if (IsHostBufferBound()) {
+        auto src_shape = another->GetShape();
+        const uint64_t bytes = src_shape->CalcBytesIncludingPadding();
+        if (src_shape->GetDataFormat() == DATAFORMAT_NDARRAY && bytes <= bound_host_buffer_bytes_) {
+            auto rc = buffer_info_.GetDevice()->Copy(&buffer_info_.GetBufferDesc(), another->GetBufferDesc(), bytes);
+            if (rc == RC_SUCCESS) {
+                return;
+            }
+            LOG(WARNING) << "copy data of tensor[" << another->GetName() << "] to the host buffer of tensor["
+                         << GetName() << "] failed: " << GetRetCodeStr(rc);
+        }
+        bound_host_buffer_ = nullptr;
+    }
+
+    buffer_info_.SetBuffer(another->GetBufferDesc(), another->GetDevice(), another->IsBufferOwner());
+    another->DetachBuffer();
+}
+
 RetCode TensorImpl::ReallocBuffer() {
+    if (IsHostBufferBound()) {
+        auto shape = buffer_info_.GetShape();
+        if (shape->GetDataFormat() == DATAFORMAT_NDARRAY &&
+            shape->CalcBytesIncludingPadding() <= bound_host_buffer_bytes_) {
+            return RC_SUCCESS;
+        }
+
+        LOG(WARNING) << "host buffer of [" << bound_host_buffer_bytes_ << "] bytes cannot hold data of tensor["
+                     << GetName() << "] in [" << GetDataFormatStr(shape->GetDataFormat()) << "] of ["
+                     << shape->CalcBytesIncludingPadding() << "] bytes. use an internal buffer instead.";
+        buffer_info_.FreeBuffer();
+        bound_host_buffer_ = nullptr;
+    }
+
     if (!buffer_info_.IsBufferOwner() && buffer_info_.GetBufferPtr()) {
         LOG(DEBUG) << "tensor[" << GetName() << "] is not the buffer owner. ReallocBuffer() does nothing.";
         return RC_SUCCESS;
@@ -81,12 +81,10 @@ public:
 
     /**
        @brief move buffer from tensor `another`. old buffer of this tensor will be freed(or detached).
-       @note this tensor will inherits the ownership of `another`.
+       @note this tensor will inherits the ownership of `another`. if a host buffer is bound to this tensor, data of
+       `another` is copied into it instead and `another` keeps its buffer.
     */
-    void TransferBufferFrom(TensorImpl* another) {
-        buffer_info_.SetBuffer(another->GetBufferDesc(), another->GetDevice(), another->IsBufferOwner());
-        another->DetachBuffer();
-    }
+    void TransferBufferFrom(TensorImpl* another);
 
     BufferDesc DetachBuffer() {
         return buffer_info_.DetachBuffer();
@@ -96,10 +94,20 @@ public:
 
     void FreeBuffer() override {
         buffer_info_.FreeBuffer();
+        bound_host_buffer_ = nullptr;
     }
 
     void SetBufferPtr(void* ptr) override {
         buffer_info_.SetBuffer(BufferDesc(ptr));
+        bound_host_buffer_ = nullptr;
+    }
+
+    ppl::common::RetCode BindHostBuffer(void* buf, uint64_t bytes) override;
+
+    /** @brief tells whether the current buffer is a host buffer set by `BindHostBuffer()` */
+    bool IsHostBufferBound() const {
+        return (bound_host_buffer_ && !buffer_info_.IsBufferOwner() &&
+                buffer_info_.GetBufferPtr() == bound_host_buffer_);
     }
 
     void* GetBufferPtr() const override {
@@ -152,6 +160,9 @@ public:
 private:
     tensortype_t type_;
     TensorBufferInfo buffer_info_;
+    /** host buffer set by `BindHostBuffer()` and its capacity */
+    void* bound_host_buffer_ = nullptr;
+    uint64_t bound_host_buffer_bytes_ = 0;
     void* custom_info_ = nullptr;
     std::function<void(void*)> custom_info_deleter_;
 
@@ -35,6 +35,21 @@ public:
     virtual ppl::common::RetCode Realloc(uint64_t bytes, BufferDesc* buffer) = 0;
     virtual void Free(BufferDesc* buffer) = 0;
     virtual uint64_t GetBufferedBytes() const = 0;
+    /** @brief bytes of buffers that are in use */
+    virtual uint64_t GetUsedBytes() const = 0;
+    /** @brief the largest contiguous free block in buffered memory. 0 if unknown. */
+    virtual uint64_t GetLargestFreeBlockBytes() const {
+        return 0;
+    }
+
+    /**
+       @brief gives cached memory that is not in use back to the system so that about `keep_bytes` bytes remain.
+       buffers that are in use are not affected.
+       @return bytes released
+    */
+    virtual uint64_t Trim(uint64_t keep_bytes) {
+        return 0;
+    }
 
 private:
     const std::string name_;
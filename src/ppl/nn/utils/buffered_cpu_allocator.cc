@@ -17,6 +17,7 @@
 
 #include "ppl/nn/utils/buffered_cpu_allocator.h"
 #include "ppl/nn/common/logger.h"
+#include <algorithm>
 
 #ifdef _MSC_VER
 #include <cstddef>
@@ -37,6 +38,12 @@ namespace ppl { namespace nn { namespace utils {
 static constexpr uint32_t g_max_msg_buf_size = 1024;
 #endif
 
+#define MIN_ALLOC_SIZE 65536
+
+static inline uint64_t Align(uint64_t x, uint64_t n) {
+    return (x + n - 1) & (~(n - 1));
+}
+
 BufferedCpuAllocator::~BufferedCpuAllocator() {
 #ifdef _MSC_VER
     if (base_) {
@@ -44,13 +51,17 @@ BufferedCpuAllocator::~BufferedCpuAllocator() {
     }
 #else
     if (base_ != MAP_FAILED) {
-        munmap(base_, (char*)cursor_ - (char*)base_);
+        munmap(base_, addr_len_);
     }
 #endif
 }
 
-RetCode BufferedCpuAllocator::Init(uint64_t max_mem_bytes) {
+RetCode BufferedCpuAllocator::Init(uint64_t max_mem_bytes, uint32_t huge_page_policy) {
 #ifdef _MSC_VER
+    if (huge_page_policy != HUGE_PAGE_NONE) {
+        LOG(WARNING) << "huge pages are not supported on windows. use normal pages instead.";
+    }
+
     {
         MEMORYSTATUSEX status;
         status.dwLength = sizeof(status);
@@ -86,28 +97,70 @@ RetCode BufferedCpuAllocator::Init(uint64_t max_mem_bytes) {
         }
     }
 
-    base_ = mmap(nullptr, max_mem_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-    if (base_ == MAP_FAILED) {
-        LOG(ERROR) << "mmap reserve [" << max_mem_bytes << "] bytes failed: " << strerror(errno);
-        return RC_OTHER_ERROR;
+#ifndef MAP_HUGETLB
+    if (huge_page_policy == HUGE_PAGE_HUGETLB) {
+        LOG(WARNING) << "MAP_HUGETLB is not supported. use transparent huge pages instead.";
+        huge_page_policy = HUGE_PAGE_TRANSPARENT;
+    }
+#endif
+
+    if (huge_page_policy == HUGE_PAGE_NONE) {
+        base_ = mmap(nullptr, max_mem_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base_ == MAP_FAILED) {
+            LOG(ERROR) << "mmap reserve [" << max_mem_bytes << "] bytes failed: " << strerror(errno);
+            return RC_OTHER_ERROR;
+        }
+    } else {
+        // huge pages can only be used in ranges that are aligned to HUGE_PAGE_SIZE
+        max_mem_bytes &= ~(HUGE_PAGE_SIZE - 1);
+        auto addr = mmap(nullptr, max_mem_bytes + HUGE_PAGE_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            LOG(ERROR) << "mmap reserve [" << max_mem_bytes + HUGE_PAGE_SIZE << "] bytes failed: " << strerror(errno);
+            return RC_OTHER_ERROR;
+        }
+
+        base_ = (void*)Align((uintptr_t)addr, HUGE_PAGE_SIZE);
+        const uint64_t head_bytes = (char*)base_ - (char*)addr;
+        if (head_bytes > 0) {
+            munmap(addr, head_bytes);
+        }
+        munmap((char*)base_ + max_mem_bytes, HUGE_PAGE_SIZE - head_bytes);
+
+#ifdef MADV_HUGEPAGE
+        if (huge_page_policy == HUGE_PAGE_TRANSPARENT && madvise(base_, max_mem_bytes, MADV_HUGEPAGE) != 0) {
+            LOG(WARNING) << "madvise(MADV_HUGEPAGE) failed: " << strerror(errno) << ". use normal pages instead.";
+            huge_page_policy = HUGE_PAGE_NONE;
+        }
+#else
+        if (huge_page_policy == HUGE_PAGE_TRANSPARENT) {
+            LOG(WARNING) << "transparent huge pages are not supported. use normal pages instead.";
+            huge_page_policy = HUGE_PAGE_NONE;
+        }
+#endif
     }
 
     addr_len_ = max_mem_bytes;
-    LOG(DEBUG) << "reserved [" << max_mem_bytes << "] bytes of virtual address from [" << base_ << "].";
+    huge_page_policy_ = huge_page_policy;
+    // releasing part of a huge page splits it, or fails with hugetlb pages
+    page_size_ = (huge_page_policy == HUGE_PAGE_NONE) ? sysconf(_SC_PAGE_SIZE) : HUGE_PAGE_SIZE;
+    LOG(DEBUG) << "reserved [" << max_mem_bytes << "] bytes of virtual address from [" << base_
+               << "] with huge page policy [" << huge_page_policy << "].";
 #endif
 
     cursor_ = base_;
     return RC_SUCCESS;
 }
 
-#define MIN_ALLOC_SIZE 65536
-
-static inline uint64_t Align(uint64_t x, uint64_t n) {
-    return (x + n - 1) & (~(n - 1));
-}
-
 uint64_t BufferedCpuAllocator::Extend(uint64_t bytes) {
-    bytes = Align(bytes, MIN_ALLOC_SIZE);
+    // keeps `cursor_` aligned so that committed memory can be backed by huge pages
+    bytes = Align(bytes, (huge_page_policy_ == HUGE_PAGE_NONE) ? MIN_ALLOC_SIZE : HUGE_PAGE_SIZE);
+
+    // MAP_FIXED silently replaces mappings beyond the reserved range
+    if (bytes > addr_len_ - GetAllocatedSize()) {
+        LOG(ERROR) << "extend [" << bytes << "] bytes failed: exceeds max mem bytes [" << addr_len_
+                   << "], allocated bytes [" << GetAllocatedSize() << "]";
+        return 0;
+    }
 
 #ifdef _MSC_VER
     auto new_addr = VirtualAlloc(cursor_, bytes, MEM_COMMIT, PAGE_READWRITE);
@@ -119,14 +172,136 @@ uint64_t BufferedCpuAllocator::Extend(uint64_t bytes) {
         return 0;
     }
 #else
+#ifdef MAP_HUGETLB
+    if (huge_page_policy_ == HUGE_PAGE_HUGETLB) {
+        auto addr = mmap(cursor_, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB,
+                         -1, 0);
+        if (addr != MAP_FAILED) {
+            if (commit_handler_) {
+                commit_handler_(cursor_, bytes);
+            }
+            hugetlb_bytes_ += bytes;
+            cursor_ = (char*)cursor_ + bytes;
+            return bytes;
+        }
+
+        LOG(WARNING) << "mmap [" << bytes << "] bytes of hugetlb pages failed: " << strerror(errno)
+                     << ". use transparent huge pages instead.";
+
+        // a failed MAP_FIXED mapping may have unmapped the reserved range
+        const uint64_t rest_bytes = addr_len_ - GetAllocatedSize();
+        addr = mmap(cursor_, rest_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+        if (addr == MAP_FAILED) {
+            LOG(ERROR) << "mmap reserve [" << rest_bytes << "] bytes failed: " << strerror(errno);
+            return 0;
+        }
+        madvise(cursor_, rest_bytes, MADV_HUGEPAGE);
+        huge_page_policy_ = HUGE_PAGE_TRANSPARENT;
+    }
+#endif
+
     if (mprotect(cursor_, bytes, PROT_READ | PROT_WRITE) != 0) {
         LOG(ERROR) << "mprotect [" << bytes << "] bytes failed: " << strerror(errno);
         return 0;
     }
 #endif
 
+    if (commit_handler_) {
+        commit_handler_(cursor_, bytes);
+    }
     cursor_ = (char*)cursor_ + bytes;
     return bytes;
 }
 
+uint64_t BufferedCpuAllocator::Release(uintptr_t addr, uint64_t bytes) {
+    const uintptr_t end = std::min(addr + bytes, (uintptr_t)cursor_);
+    addr = Align(std::max(addr, (uintptr_t)base_), page_size_);
+    const uintptr_t aligned_end = end & ~(page_size_ - 1);
+    if (addr >= aligned_end) {
+        return 0;
+    }
+
+    bytes = aligned_end - addr;
+#ifdef _MSC_VER
+    if (!VirtualAlloc((void*)addr, bytes, MEM_RESET, PAGE_READWRITE)) {
+        char errmsg[g_max_msg_buf_size];
+        FormatMessage(FORMAT_MESSAGE_IGNORE_INSERTS | FORMAT_MESSAGE_FROM_SYSTEM, nullptr, GetLastError(), 0, errmsg,
+                      g_max_msg_buf_size, nullptr);
+        LOG(WARNING) << "VirtualAlloc reset [" << bytes << "] bytes failed: " << errmsg;
+        return 0;
+    }
+#else
+    if (madvise((void*)addr, bytes, MADV_DONTNEED) != 0) {
+        LOG(WARNING) << "madvise(MADV_DONTNEED) [" << bytes << "] bytes failed: " << strerror(errno);
+        return 0;
+    }
+#endif
+
+    // merges with released ranges that overlap or are adjacent to [addr, aligned_end)
+    uintptr_t range_begin = addr, range_end = aligned_end;
+    uint64_t merged_bytes = 0;
+    auto it = released_ranges_.upper_bound(range_begin);
+    if (it != released_ranges_.begin()) {
+        auto prev = it;
+        --prev;
+        if (prev->second >= range_begin) {
+            it = prev;
+        }
+    }
+    while (it != released_ranges_.end() && it->first <= range_end) {
+        range_begin = std::min(range_begin, it->first);
+        range_end = std::max(range_end, it->second);
+        merged_bytes += it->second - it->first;
+        it = released_ranges_.erase(it);
+    }
+    released_ranges_.insert(make_pair(range_begin, range_end));
+
+    const uint64_t new_bytes = (range_end - range_begin) - merged_bytes;
+    released_bytes_ += new_bytes;
+    return new_bytes;
+}
+
+void BufferedCpuAllocator::Recommit(uintptr_t addr, uint64_t bytes) {
+    if (released_ranges_.empty()) {
+        return;
+    }
+
+    // pages are committed again once they are touched
+    const uintptr_t begin = addr & ~(page_size_ - 1);
+    const uintptr_t end = Align(addr + bytes, page_size_);
+
+    auto it = released_ranges_.upper_bound(begin);
+    if (it != released_ranges_.begin()) {
+        auto prev = it;
+        --prev;
+        if (prev->second > begin) {
+            it = prev;
+        }
+    }
+    while (it != released_ranges_.end() && it->first < end) {
+        const uintptr_t range_begin = it->first;
+        const uintptr_t range_end = it->second;
+        it = released_ranges_.erase(it);
+        released_bytes_ -= (range_end - range_begin);
+
+        if (range_begin < begin) {
+            released_ranges_.insert(make_pair(range_begin, begin));
+            released_bytes_ += (begin - range_begin);
+        }
+        if (range_end > end) {
+            released_ranges_.insert(make_pair(end, range_end));
+            released_bytes_ += (range_end - end);
+        }
+    }
+}
+
+uint64_t BufferedCpuAllocator::GetHugePageBytes() const {
+    uint64_t bytes = hugetlb_bytes_;
+    if (huge_page_policy_ == HUGE_PAGE_TRANSPARENT) {
+        vector<pair<const void*, uint64_t>> ranges(1, make_pair(base_, GetAllocatedSize()));
+        bytes += GetTransparentHugePageBytes(ranges);
+    }
+    return bytes;
+}
+
 }}} // namespace ppl::nn::utils
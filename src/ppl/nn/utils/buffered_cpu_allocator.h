@@ -20,6 +20,9 @@
 
 #include "ppl/common/compact_addr_manager.h"
 #include "ppl/common/retcode.h"
+#include "ppl/nn/utils/huge_page.h"
+#include <functional>
+#include <map>
 
 namespace ppl { namespace nn { namespace utils {
 
@@ -27,19 +30,56 @@ class BufferedCpuAllocator final : public ppl::common::CompactAddrManager::VMAll
 public:
     BufferedCpuAllocator() {}
     ~BufferedCpuAllocator();
-    ppl::common::RetCode Init(uint64_t max_mem_bytes = UINT64_MAX);
+    /**
+       @param huge_page_policy `HUGE_PAGE_*` in `ppl/nn/common/huge_page.h`. the reserved range is aligned to and
+       extended by `HUGE_PAGE_SIZE` if huge pages are used.
+    */
+    ppl::common::RetCode Init(uint64_t max_mem_bytes = UINT64_MAX, uint32_t huge_page_policy = HUGE_PAGE_NONE);
     uint64_t Extend(uint64_t bytes) override;
+    /**
+       @brief `handler` is called with every range committed by `Extend()` before it is used, e.g. to set its numa
+       memory policy. policies set on the reserved range do not apply to ranges that are mapped again, which happens
+       when huge pages are used.
+    */
+    void SetCommitHandler(const std::function<void(void*, uint64_t)>& handler) {
+        commit_handler_ = handler;
+    }
     uintptr_t GetReservedBase() const override {
         return (uintptr_t)base_;
     }
+    uint64_t GetReservedSize() const {
+        return addr_len_;
+    }
+    /** @brief bytes of allocated memory that are backed by huge pages */
+    uint64_t GetHugePageBytes() const;
     uint64_t GetAllocatedSize() const override {
         return (uintptr_t)cursor_ - (uintptr_t)base_;
     }
+    /** @brief bytes of allocated memory except those given back by `Release()` and not used again */
+    uint64_t GetCommittedBytes() const {
+        return GetAllocatedSize() - released_bytes_;
+    }
+    /**
+       @brief gives physical pages that are fully covered by [addr, addr + bytes) back to the os. the range is still
+       usable and reads as zeros, so it MUST NOT contain any buffer that is in use.
+       @return bytes released, excluding pages that have already been released
+    */
+    uint64_t Release(uintptr_t addr, uint64_t bytes);
+    /** @brief [addr, addr + bytes) is going to be used. pages released in this range are counted as committed again. */
+    void Recommit(uintptr_t addr, uint64_t bytes);
 
 private:
     void* base_ = nullptr;
     void* cursor_ = nullptr;
     uint64_t addr_len_ = 0;
+    uint32_t huge_page_policy_ = HUGE_PAGE_NONE;
+    uint64_t hugetlb_bytes_ = 0;
+    /** granularity of `Release()` */
+    uint64_t page_size_ = 4096;
+    std::function<void(void*, uint64_t)> commit_handler_;
+    /** begin => end of ranges given back by `Release()`, aligned to `page_size_` */
+    std::map<uintptr_t, uintptr_t> released_ranges_;
+    uint64_t released_bytes_ = 0;
 
 private:
     BufferedCpuAllocator(const BufferedCpuAllocator&) = delete;
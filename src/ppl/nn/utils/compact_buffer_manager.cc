@@ -17,6 +17,7 @@
 
 #include "ppl/nn/utils/compact_buffer_manager.h"
 #include "ppl/nn/common/logger.h"
+#include <algorithm>
 using namespace std;
 using namespace ppl::common;
 
@@ -27,9 +28,7 @@ static inline uint64_t Align(uint64_t x, uint64_t n) {
 }
 
 RetCode CompactBufferManager::Realloc(uint64_t bytes, BufferDesc* buffer) {
-    if (buffer->addr) {
-        mgr_.Free((uintptr_t)buffer->addr, buffer->desc);
-    }
+    Free(buffer);
 
     if (bytes == 0) {
         buffer->addr = nullptr;
@@ -45,14 +44,79 @@ RetCode CompactBufferManager::Realloc(uint64_t bytes, BufferDesc* buffer) {
     }
 
     buffer->desc = bytes;
+    used_bytes_ += bytes;
+    if (buffered_allocator_) {
+        blocks_in_use_.insert(make_pair((uintptr_t)buffer->addr, bytes));
+        buffered_allocator_->Recommit((uintptr_t)buffer->addr, bytes);
+    }
     return RC_SUCCESS;
 }
 
 void CompactBufferManager::Free(BufferDesc* buffer) {
     if (buffer->addr) {
         mgr_.Free((uintptr_t)buffer->addr, buffer->desc);
+        used_bytes_ -= buffer->desc;
+        if (buffered_allocator_) {
+            blocks_in_use_.erase((uintptr_t)buffer->addr);
+        }
         buffer->addr = nullptr;
     }
 }
 
+uint64_t CompactBufferManager::GetLargestFreeBlockBytes() const {
+    if (!buffered_allocator_) {
+        return 0;
+    }
+
+    uintptr_t free_begin = buffered_allocator_->GetReservedBase();
+    uint64_t max_bytes = 0;
+    for (auto it = blocks_in_use_.begin(); it != blocks_in_use_.end(); ++it) {
+        if (it->first > free_begin) {
+            max_bytes = std::max(max_bytes, it->first - free_begin);
+        }
+        free_begin = std::max(free_begin, it->first + it->second);
+    }
+
+    const uintptr_t end = buffered_allocator_->GetReservedBase() + buffered_allocator_->GetAllocatedSize();
+    if (end > free_begin) {
+        max_bytes = std::max(max_bytes, end - free_begin);
+    }
+    return max_bytes;
+}
+
+uint64_t CompactBufferManager::Trim(uint64_t keep_bytes) {
+    if (!buffered_allocator_) {
+        return 0;
+    }
+
+    const uintptr_t base = buffered_allocator_->GetReservedBase();
+    const uintptr_t end = base + buffered_allocator_->GetAllocatedSize();
+    uintptr_t free_begin = base + std::min(keep_bytes, end - base);
+
+    auto it = blocks_in_use_.lower_bound(free_begin);
+    if (it != blocks_in_use_.begin()) {
+        auto prev = it;
+        --prev;
+        free_begin = std::max(free_begin, prev->first + prev->second);
+    }
+
+    uint64_t released_bytes = 0;
+    for (; free_begin < end; ++it) {
+        uintptr_t free_end = end;
+        if (it != blocks_in_use_.end()) {
+            free_end = it->first;
+        }
+
+        if (free_end > free_begin) {
+            released_bytes += buffered_allocator_->Release(free_begin, free_end - free_begin);
+        }
+        if (it == blocks_in_use_.end()) {
+            break;
+        }
+        free_begin = std::max(free_begin, it->first + it->second);
+    }
+
+    return released_bytes;
+}
+
 }}} // namespace ppl::nn::utils
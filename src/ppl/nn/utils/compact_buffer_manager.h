@@ -20,7 +20,9 @@
 
 #include "ppl/common/compact_addr_manager.h"
 #include "ppl/nn/utils/buffer_manager.h"
+#include "ppl/nn/utils/buffered_cpu_allocator.h"
 #include <functional>
+#include <map>
 
 namespace ppl { namespace nn { namespace utils {
 
@@ -40,17 +42,43 @@ public:
         };
     }
 
+    /**
+       @note `Trim()` is available only if buffers are allocated from a `BufferedCpuAllocator`. memory given back by
+       `Trim()` is not counted in `GetBufferedBytes()` until it is used again.
+    */
+    CompactBufferManager(BufferedCpuAllocator* vmr, uint64_t alignment)
+        : BufferManager("CompactBufferManager"), alignment_(alignment), mgr_(vmr), buffered_allocator_(vmr) {
+        get_buffered_bytes_ = [vmr]() -> uint64_t {
+            return vmr->GetCommittedBytes();
+        };
+    }
+
     uint64_t GetBufferedBytes() const override {
         return get_buffered_bytes_();
     }
+    uint64_t GetUsedBytes() const override {
+        return used_bytes_;
+    }
+    /** @note available only if buffers are allocated from a `BufferedCpuAllocator` */
+    uint64_t GetLargestFreeBlockBytes() const override;
 
     ppl::common::RetCode Realloc(uint64_t bytes, BufferDesc* buffer) override;
     void Free(BufferDesc* buffer) override;
 
+    /**
+       @brief releases physical pages of free ranges beyond the first `keep_bytes` bytes. the address space is kept
+       so that buffers allocated later may take these ranges again.
+    */
+    uint64_t Trim(uint64_t keep_bytes) override;
+
 private:
     uint64_t alignment_;
     ppl::common::CompactAddrManager mgr_;
     std::function<uint64_t()> get_buffered_bytes_;
+    BufferedCpuAllocator* buffered_allocator_ = nullptr;
+    uint64_t used_bytes_ = 0;
+    /** addr => bytes of buffers that are in use. used by `Trim()` to find free ranges. */
+    std::map<uintptr_t, uint64_t> blocks_in_use_;
 };
 
 }}} // namespace ppl::nn::utils
@@ -25,7 +25,7 @@ namespace ppl { namespace nn { namespace utils {
 
 class GenericCpuDevice final : public Device {
 public:
-    GenericCpuDevice(uint64_t alignment = 64) : allocator_(alignment) {
+    GenericCpuDevice(uint64_t alignment = 64) : alignment_(alignment), allocator_(alignment) {
         *(uint64_t*)(type_.str) = 0;
         type_.str[0] = 'c';
         type_.str[1] = 'p';
@@ -35,6 +35,9 @@ public:
     ppl::common::RetCode Realloc(uint64_t bytes, BufferDesc*) override;
     ppl::common::RetCode Realloc(const TensorShape&, BufferDesc*) override final;
     void Free(BufferDesc*) override;
+    bool CanUseHostBuffer(const void* addr) const override {
+        return ((uintptr_t)addr % alignment_ == 0);
+    }
 
     ppl::common::RetCode CopyFromHost(BufferDesc* dst, const void* src, uint64_t bytes) const override;
     ppl::common::RetCode CopyFromHostAsync(BufferDesc* dst, const void* src, uint64_t bytes) const override;
@@ -77,6 +80,7 @@ public:
 
 private:
     Type type_;
+    const uint64_t alignment_;
     mutable ppl::common::GenericCpuAllocator allocator_;
 };
 
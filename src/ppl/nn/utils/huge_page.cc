@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/utils/huge_page.h"
+#include <algorithm>
+#include <stdio.h>
+using namespace std;
+
+namespace ppl { namespace nn { namespace utils {
+
+uint64_t GetTransparentHugePageBytes(const vector<pair<const void*, uint64_t>>& ranges) {
+#ifdef __linux__
+    FILE* fp = fopen("/proc/self/smaps", "r");
+    if (!fp) {
+        return 0;
+    }
+
+    uint64_t total_bytes = 0;
+    uint64_t overlapped_bytes = 0; // bytes of `ranges` in the current vma
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        unsigned long long vma_begin, vma_end;
+        if (sscanf(line, "%llx-%llx ", &vma_begin, &vma_end) == 2) {
+            overlapped_bytes = 0;
+            for (auto r = ranges.begin(); r != ranges.end(); ++r) {
+                const uint64_t begin = std::max((uint64_t)(uintptr_t)r->first, (uint64_t)vma_begin);
+                const uint64_t end = std::min((uint64_t)(uintptr_t)r->first + r->second, (uint64_t)vma_end);
+                if (begin < end) {
+                    overlapped_bytes += end - begin;
+                }
+            }
+            continue;
+        }
+
+        unsigned long long kb;
+        if (overlapped_bytes > 0 && sscanf(line, "AnonHugePages: %llu kB", &kb) == 1) {
+            total_bytes += std::min((uint64_t)kb * 1024, overlapped_bytes);
+        }
+    }
+
+    fclose(fp);
+    return total_bytes;
+#else
+    return 0;
+#endif
+}
+
+}}} // namespace ppl::nn::utils
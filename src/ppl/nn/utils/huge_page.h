@@ -0,0 +1,36 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_UTILS_HUGE_PAGE_H_
+#define _ST_HPC_PPL_NN_UTILS_HUGE_PAGE_H_
+
+#include "ppl/nn/common/huge_page.h"
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace ppl { namespace nn { namespace utils {
+
+static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+/** @brief bytes of transparent huge pages that back `ranges` of [addr, addr + bytes). linux only. */
+uint64_t GetTransparentHugePageBytes(const std::vector<std::pair<const void*, uint64_t>>& ranges);
+
+}}} // namespace ppl::nn::utils
+
+#endif
@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/utils/min_cut_solver.h"
+#include <algorithm>
+#include <queue>
+using namespace std;
+
+namespace ppl { namespace nn { namespace utils {
+
+void MinCutSolver::AddUnary(uint32_t v, uint64_t cost0, uint64_t cost1) {
+    Unary u;
+    u.v = v;
+    u.cost[0] = cost0;
+    u.cost[1] = cost1;
+    unaries_.push_back(u);
+}
+
+void MinCutSolver::AddPairwise(uint32_t a, uint32_t b, uint64_t e00, uint64_t e01, uint64_t e10, uint64_t e11) {
+    Pairwise p;
+    p.a = a;
+    p.b = b;
+    p.cost[0][0] = e00;
+    p.cost[0][1] = e01;
+    p.cost[1][0] = e10;
+    p.cost[1][1] = e11;
+    pairwises_.push_back(p);
+}
+
+uint64_t MinCutSolver::Evaluate(const vector<uint8_t>& labels) const {
+    uint64_t cost = 0;
+    for (auto u = unaries_.begin(); u != unaries_.end(); ++u) {
+        cost += u->cost[labels[u->v]];
+    }
+    for (auto p = pairwises_.begin(); p != pairwises_.end(); ++p) {
+        cost += p->cost[labels[p->a]][labels[p->b]];
+    }
+    return cost;
+}
+
+namespace {
+
+class MaxFlowGraph final {
+public:
+    MaxFlowGraph(uint32_t node_count) : adj_(node_count), level_(node_count), iter_(node_count) {}
+
+    void AddEdge(uint32_t from, uint32_t to, int64_t cap) {
+        adj_[from].push_back(edges_.size());
+        edges_.push_back(Edge{to, cap});
+        adj_[to].push_back(edges_.size());
+        edges_.push_back(Edge{from, 0});
+    }
+
+    // dinic
+    void Run(uint32_t s, uint32_t t) {
+        while (Bfs(s, t)) {
+            std::fill(iter_.begin(), iter_.end(), 0);
+            while (Dfs(s, t, INT64_MAX) > 0) {
+            }
+        }
+    }
+
+    /** @brief nodes that are reachable from `s` in the residual graph after `Run()` */
+    bool IsOnSourceSide(uint32_t v) const {
+        return (level_[v] >= 0);
+    }
+
+private:
+    struct Edge final {
+        uint32_t to;
+        int64_t cap;
+    };
+
+    bool Bfs(uint32_t s, uint32_t t) {
+        std::fill(level_.begin(), level_.end(), -1);
+        level_[s] = 0;
+        queue<uint32_t> q;
+        q.push(s);
+        while (!q.empty()) {
+            auto v = q.front();
+            q.pop();
+            for (auto eid : adj_[v]) {
+                auto& e = edges_[eid];
+                if (e.cap > 0 && level_[e.to] < 0) {
+                    level_[e.to] = level_[v] + 1;
+                    q.push(e.to);
+                }
+            }
+        }
+        return (level_[t] >= 0);
+    }
+
+    int64_t Dfs(uint32_t v, uint32_t t, int64_t f) {
+        if (v == t) {
+            return f;
+        }
+        for (; iter_[v] < adj_[v].size(); ++iter_[v]) {
+            auto eid = adj_[v][iter_[v]];
+            auto& e = edges_[eid];
+            if (e.cap > 0 && level_[v] < level_[e.to]) {
+                auto d = Dfs(e.to, t, std::min(f, e.cap));
+                if (d > 0) {
+                    e.cap -= d;
+                    edges_[eid ^ 1].cap += d;
+                    return d;
+                }
+            }
+        }
+        return 0;
+    }
+
+private:
+    vector<Edge> edges_;
+    vector<vector<uint32_t>> adj_;
+    vector<int32_t> level_;
+    vector<uint32_t> iter_;
+};
+
+} // namespace
+
+/*
+  a pairwise term is decomposed into
+    e00 + (e10 - e00) * a + (e11 - e10) * b + (e01 + e10 - e00 - e11) * (1 - a) * b
+  variables labeled 0 are on the source side of the cut. a positive coefficient of a variable becomes an edge
+  from the source, a negative one an edge to the sink, and the last term an edge from `a` to `b`.
+*/
+void MinCutSolver::Solve(vector<uint8_t>* labels) const {
+    const uint32_t s = var_count_;
+    const uint32_t t = var_count_ + 1;
+    MaxFlowGraph graph(var_count_ + 2);
+
+    vector<int64_t> coeffs(var_count_, 0);
+    for (auto u = unaries_.begin(); u != unaries_.end(); ++u) {
+        coeffs[u->v] += (int64_t)u->cost[1] - (int64_t)u->cost[0];
+    }
+    for (auto p = pairwises_.begin(); p != pairwises_.end(); ++p) {
+        const int64_t e00 = p->cost[0][0], e01 = p->cost[0][1], e10 = p->cost[1][0], e11 = p->cost[1][1];
+        coeffs[p->a] += e10 - e00;
+        coeffs[p->b] += e11 - e10;
+        const int64_t w = e01 + e10 - e00 - e11;
+        if (w > 0) {
+            graph.AddEdge(p->a, p->b, w);
+        }
+    }
+    for (uint32_t v = 0; v < var_count_; ++v) {
+        if (coeffs[v] > 0) {
+            graph.AddEdge(s, v, coeffs[v]);
+        } else if (coeffs[v] < 0) {
+            graph.AddEdge(v, t, -coeffs[v]);
+        }
+    }
+
+    graph.Run(s, t);
+
+    labels->resize(var_count_);
+    for (uint32_t v = 0; v < var_count_; ++v) {
+        labels->at(v) = graph.IsOnSourceSide(v) ? 0 : 1;
+    }
+}
+
+}}} // namespace ppl::nn::utils
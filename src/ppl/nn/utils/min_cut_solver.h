@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#ifndef _ST_HPC_PPL_NN_UTILS_MIN_CUT_SOLVER_H_
+#define _ST_HPC_PPL_NN_UTILS_MIN_CUT_SOLVER_H_
+
+#include <stdint.h>
+#include <vector>
+
+namespace ppl { namespace nn { namespace utils {
+
+/**
+   @class MinCutSolver
+   @brief minimizes a sum of unary and pairwise costs of binary variables by an s-t minimum cut.
+   @note the result is optimal if every pairwise term satisfies `e01 + e10 >= e00 + e11`. other pairwise
+   terms are truncated and the result is an approximation. use `Evaluate()` to get the exact cost.
+*/
+class MinCutSolver final {
+public:
+    MinCutSolver(uint32_t var_count) : var_count_(var_count) {}
+
+    void AddUnary(uint32_t v, uint64_t cost0, uint64_t cost1);
+    /** @brief `eXY` is the cost when `a` is labeled `X` and `b` is labeled `Y` */
+    void AddPairwise(uint32_t a, uint32_t b, uint64_t e00, uint64_t e01, uint64_t e10, uint64_t e11);
+
+    /** @brief labels of variables, each of which is 0 or 1, with the minimum cost */
+    void Solve(std::vector<uint8_t>* labels) const;
+    uint64_t Evaluate(const std::vector<uint8_t>& labels) const;
+
+private:
+    struct Unary final {
+        uint32_t v;
+        uint64_t cost[2];
+    };
+
+    struct Pairwise final {
+        uint32_t a;
+        uint32_t b;
+        uint64_t cost[2][2];
+    };
+
+private:
+    const uint32_t var_count_;
+    std::vector<Unary> unaries_;
+    std::vector<Pairwise> pairwises_;
+};
+
+}}} // namespace ppl::nn::utils
+
+#endif
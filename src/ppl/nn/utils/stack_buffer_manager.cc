@@ -16,6 +16,8 @@
 // under the License.
 
 #include "ppl/nn/utils/stack_buffer_manager.h"
+#include <algorithm>
+using namespace std;
 using namespace ppl::common;
 
 namespace ppl { namespace nn { namespace utils {
@@ -51,6 +53,7 @@ RetCode StackBufferManager::Realloc(uint64_t bytes, BufferDesc* buffer) {
             }
             buffer->addr = managed_buffer.addr;
             buffer->desc = managed_buffer_id;
+            used_bytes_ += managed_buffer.size;
         } else {
             BufferAddrAndSize managed_buffer;
             AllocManagedBuffer(bytes, &managed_buffer);
@@ -60,17 +63,20 @@ RetCode StackBufferManager::Realloc(uint64_t bytes, BufferDesc* buffer) {
             buffer->addr = managed_buffer.addr;
             buffer->desc = buffer_list_.size();
             buffer_list_.push_back(managed_buffer);
+            used_bytes_ += managed_buffer.size;
         }
     } else {
         if (buffer->desc >= buffer_list_.size()) {
             return RC_INVALID_VALUE;
         }
         BufferAddrAndSize& managed_buffer = buffer_list_[buffer->desc];
+        used_bytes_ -= managed_buffer.size;
         ReallocManagedBuffer(bytes, &managed_buffer);
         if (managed_buffer.addr == nullptr) {
             buffer->addr = nullptr;
             return RC_OUT_OF_MEMORY;
         }
+        used_bytes_ += managed_buffer.size;
         buffer->addr = managed_buffer.addr;
     }
 
@@ -82,7 +88,29 @@ void StackBufferManager::Free(BufferDesc* buffer) {
         return;
     }
     buffer_stack_.push_back(buffer->desc);
+    used_bytes_ -= buffer_list_[buffer->desc].size;
     buffer->addr = nullptr;
 }
 
+uint64_t StackBufferManager::Trim(uint64_t keep_bytes) {
+    vector<int64_t> free_buffers(buffer_stack_);
+    std::sort(free_buffers.begin(), free_buffers.end(), [this](int64_t a, int64_t b) -> bool {
+        return (buffer_list_[a].size > buffer_list_[b].size);
+    });
+
+    uint64_t released_bytes = 0;
+    for (auto id = free_buffers.begin(); id != free_buffers.end() && buffered_bytes_ > keep_bytes; ++id) {
+        BufferAddrAndSize& managed_buffer = buffer_list_[*id];
+        if (managed_buffer.addr) {
+            allocator_->Free(managed_buffer.addr);
+            buffered_bytes_ -= managed_buffer.size;
+            released_bytes += managed_buffer.size;
+            managed_buffer.addr = nullptr;
+            managed_buffer.size = 0;
+        }
+    }
+
+    return released_bytes;
+}
+
 }}} // namespace ppl::nn::utils
@@ -38,6 +38,21 @@ public:
     uint64_t GetBufferedBytes() const override {
         return buffered_bytes_;
     }
+    uint64_t GetUsedBytes() const override {
+        return used_bytes_;
+    }
+    uint64_t GetLargestFreeBlockBytes() const override {
+        uint64_t max_bytes = 0;
+        for (auto id = buffer_stack_.begin(); id != buffer_stack_.end(); ++id) {
+            if (buffer_list_[*id].size > max_bytes) {
+                max_bytes = buffer_list_[*id].size;
+            }
+        }
+        return max_bytes;
+    }
+
+    /** @brief frees buffers that are not in use, from the largest to the smallest. */
+    uint64_t Trim(uint64_t keep_bytes) override;
 
 private:
     struct BufferAddrAndSize {
@@ -57,7 +72,10 @@ private:
 
     inline void ReallocManagedBuffer(uint64_t bytes, BufferAddrAndSize* managed_buffer) {
         if (bytes > managed_buffer->size) {
-            allocator_->Free(managed_buffer->addr);
+            // buffers released by `Trim()` are empty
+            if (managed_buffer->addr) {
+                allocator_->Free(managed_buffer->addr);
+            }
             buffered_bytes_ -= managed_buffer->size;
             AllocManagedBuffer(bytes, managed_buffer);
         }
@@ -90,6 +108,7 @@ private:
 private:
     const bool use_bestfit_;
     uint64_t buffered_bytes_ = 0;
+    uint64_t used_bytes_ = 0;
     ppl::common::Allocator* allocator_;
     std::vector<int64_t> buffer_stack_;
     std::vector<BufferAddrAndSize> buffer_list_;
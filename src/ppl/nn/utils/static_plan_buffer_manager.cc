@@ -0,0 +1,278 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/utils/static_plan_buffer_manager.h"
+#include "ppl/nn/common/logger.h"
+#include <algorithm>
+using namespace std;
+using namespace ppl::common;
+
+namespace ppl { namespace nn { namespace utils {
+
+constexpr uint64_t StaticPlanBufferManager::UNPLANNED;
+constexpr uint32_t StaticPlanBufferManager::NOT_FREED;
+
+static inline uint64_t Align(uint64_t x, uint64_t n) {
+    return (x + n - 1) & (~(n - 1));
+}
+
+StaticPlanBufferManager::~StaticPlanBufferManager() {
+    if (arena_) {
+        arena_allocator_->Free(arena_);
+    }
+}
+
+bool StaticPlanBufferManager::AcquireArenaBlock(uint64_t offset, uint64_t bytes) {
+    const uint64_t end = offset + bytes;
+
+    // blocks may be allocated in a different order, e.g. by a parallel scheduler
+    auto next = arena_blocks_in_use_.lower_bound(offset);
+    if (next != arena_blocks_in_use_.end() && next->first < end) {
+        return false;
+    }
+    if (next != arena_blocks_in_use_.begin()) {
+        auto prev = next;
+        --prev;
+        if (prev->second > offset) {
+            return false;
+        }
+    }
+
+    arena_blocks_in_use_.insert(next, make_pair(offset, end));
+    arena_used_bytes_ += bytes;
+    return true;
+}
+
+RetCode StaticPlanBufferManager::Realloc(uint64_t bytes, BufferDesc* buffer) {
+    Free(buffer);
+
+    if (bytes == 0) {
+        buffer->addr = nullptr;
+        buffer->desc = 0;
+        return RC_SUCCESS;
+    }
+
+    bytes = Align(bytes, alignment_);
+    const uint32_t idx = cursor_;
+    ++cursor_;
+    ++ts_;
+
+    if (state_ == STATE_REPLAYING && !is_diverged_) {
+        if (idx < plan_.size() && plan_[idx].bytes == bytes) {
+            auto offset = plan_[idx].offset;
+            if (offset != UNPLANNED && AcquireArenaBlock(offset, bytes)) {
+                buffer->addr = arena_ + offset;
+                buffer->desc = bytes;
+                return RC_SUCCESS;
+            }
+        } else {
+            LOG(DEBUG) << "allocation [" << idx << "] of [" << bytes << "] bytes mismatches the plan. use dynamic "
+                       << "allocation until a new plan is made.";
+            is_diverged_ = true;
+        }
+    }
+
+    auto rc = fallback_->Realloc(bytes, buffer);
+    if (rc != RC_SUCCESS) {
+        is_diverged_ = true;
+        return rc;
+    }
+
+    if (state_ == STATE_RECORDING && !is_diverged_) {
+        recorded_addr2idx_[buffer->addr] = recorded_blocks_.size();
+
+        RecordedBlock block;
+        block.bytes = bytes;
+        block.alloc_ts = ts_;
+        block.free_ts = NOT_FREED;
+        recorded_blocks_.push_back(block);
+    }
+
+    return RC_SUCCESS;
+}
+
+void StaticPlanBufferManager::Free(BufferDesc* buffer) {
+    if (!buffer->addr) {
+        return;
+    }
+
+    ++ts_;
+
+    if (IsInArena(buffer->addr)) {
+        auto ref = arena_blocks_in_use_.find((char*)buffer->addr - arena_);
+        if (ref != arena_blocks_in_use_.end()) {
+            arena_used_bytes_ -= (ref->second - ref->first);
+            arena_blocks_in_use_.erase(ref);
+        }
+        buffer->addr = nullptr;
+        return;
+    }
+
+    if (state_ == STATE_RECORDING) {
+        auto ref = recorded_addr2idx_.find(buffer->addr);
+        if (ref != recorded_addr2idx_.end()) {
+            recorded_blocks_[ref->second].free_ts = ts_;
+            recorded_addr2idx_.erase(ref);
+        }
+    }
+
+    fallback_->Free(buffer);
+}
+
+/*
+  blocks are placed in the arena greedily from the largest to the smallest. each block takes the best-fit gap among
+  blocks that are alive at the same time. blocks that are still alive at the end of the run, e.g. inputs and outputs,
+  are kept across runs and are treated as alive during the whole run, so that they never share space with others.
+*/
+RetCode StaticPlanBufferManager::BuildPlan() {
+    vector<uint32_t> sorted_idx(recorded_blocks_.size());
+    for (uint32_t i = 0; i < recorded_blocks_.size(); ++i) {
+        sorted_idx[i] = i;
+    }
+    std::stable_sort(sorted_idx.begin(), sorted_idx.end(), [this](uint32_t a, uint32_t b) -> bool {
+        return (recorded_blocks_[a].bytes > recorded_blocks_[b].bytes);
+    });
+
+    vector<PlannedBlock> plan(recorded_blocks_.size());
+    for (uint32_t i = 0; i < recorded_blocks_.size(); ++i) {
+        plan[i].bytes = recorded_blocks_[i].bytes;
+        plan[i].offset = UNPLANNED;
+    }
+
+    uint64_t arena_size = 0;
+    vector<pair<uint64_t, uint64_t>> overlapped; // [offset, end)
+    for (uint32_t i = 0; i < sorted_idx.size(); ++i) {
+        auto& cur = recorded_blocks_[sorted_idx[i]];
+
+        overlapped.clear();
+        for (uint32_t j = 0; j < i; ++j) {
+            auto& placed = recorded_blocks_[sorted_idx[j]];
+            if (GetAllocTs(placed) < cur.free_ts && GetAllocTs(cur) < placed.free_ts) {
+                auto offset = plan[sorted_idx[j]].offset;
+                overlapped.push_back(make_pair(offset, offset + placed.bytes));
+            }
+        }
+        std::sort(overlapped.begin(), overlapped.end());
+
+        uint64_t best_offset = UNPLANNED;
+        uint64_t best_gap = UINT64_MAX;
+        uint64_t prev_end = 0;
+        for (auto o = overlapped.begin(); o != overlapped.end(); ++o) {
+            if (o->first > prev_end) {
+                uint64_t gap = o->first - prev_end;
+                if (gap >= cur.bytes && gap < best_gap) {
+                    best_gap = gap;
+                    best_offset = prev_end;
+                }
+            }
+            prev_end = std::max(prev_end, o->second);
+        }
+        if (best_offset == UNPLANNED) {
+            best_offset = prev_end;
+        }
+
+        plan[sorted_idx[i]].offset = best_offset;
+        arena_size = std::max(arena_size, best_offset + cur.bytes);
+    }
+
+    if (arena_size > arena_size_) {
+        // blocks kept from the previous plan, e.g. inputs that are not set again, are still in the arena
+        if (!arena_blocks_in_use_.empty()) {
+            LOG(DEBUG) << "arena of [" << arena_size_ << "] bytes is in use and cannot be enlarged to [" << arena_size
+                       << "] bytes. record the next run.";
+            return RC_SUCCESS;
+        }
+
+        if (arena_) {
+            arena_allocator_->Free(arena_);
+            arena_ = nullptr;
+            arena_size_ = 0;
+        }
+
+        arena_ = (char*)arena_allocator_->Alloc(arena_size);
+        if (!arena_) {
+            LOG(ERROR) << "allocate arena of [" << arena_size << "] bytes failed.";
+            return RC_OUT_OF_MEMORY;
+        }
+        arena_size_ = arena_size;
+    }
+
+    plan_ = std::move(plan);
+    LOG(DEBUG) << "static plan: [" << sorted_idx.size() << "] of [" << plan_.size() << "] buffers in an arena of ["
+               << arena_size << "] bytes.";
+    return RC_SUCCESS;
+}
+
+void StaticPlanBufferManager::EndOfRun() {
+    if (cursor_ == 0) {
+        return;
+    }
+
+    if (state_ == STATE_RECORDING) {
+        if (!is_diverged_) {
+            auto rc = BuildPlan();
+            if (rc == RC_SUCCESS) {
+                if (!plan_.empty()) {
+                    state_ = STATE_REPLAYING;
+                }
+            } else {
+                LOG(WARNING) << "build static memory plan failed: " << GetRetCodeStr(rc);
+            }
+        }
+    } else if (is_diverged_ || cursor_ != plan_.size()) {
+        // shapes are changed. records the next run to make a new plan.
+        state_ = STATE_RECORDING;
+        plan_.clear();
+    }
+
+    is_diverged_ = false;
+    cursor_ = 0;
+    ts_ = 0;
+    recorded_blocks_.clear();
+    recorded_addr2idx_.clear();
+}
+
+uint64_t StaticPlanBufferManager::GetLargestFreeBlockBytes() const {
+    uint64_t max_bytes = fallback_->GetLargestFreeBlockBytes();
+    uint64_t free_begin = 0;
+    for (auto it = arena_blocks_in_use_.begin(); it != arena_blocks_in_use_.end(); ++it) {
+        if (it->first > free_begin) {
+            max_bytes = std::max(max_bytes, it->first - free_begin);
+        }
+        free_begin = std::max(free_begin, it->second);
+    }
+    if (arena_size_ > free_begin) {
+        max_bytes = std::max(max_bytes, arena_size_ - free_begin);
+    }
+    return max_bytes;
+}
+
+uint64_t StaticPlanBufferManager::Trim(uint64_t keep_bytes) {
+    uint64_t released_bytes = 0;
+    if (arena_ && arena_blocks_in_use_.empty() && arena_size_ > keep_bytes) {
+        arena_allocator_->Free(arena_);
+        released_bytes = arena_size_;
+        arena_ = nullptr;
+        arena_size_ = 0;
+        state_ = STATE_RECORDING;
+        plan_.clear();
+    }
+
+    return released_bytes + fallback_->Trim((keep_bytes > arena_size_) ? keep_bytes - arena_size_ : 0);
+}
+
+}}} // namespace ppl::nn::utils
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _ST_HPC_PPL_NN_UTILS_STATIC_PLAN_BUFFER_MANAGER_H_
+#define _ST_HPC_PPL_NN_UTILS_STATIC_PLAN_BUFFER_MANAGER_H_
+
+#include "ppl/common/allocator.h"
+#include "ppl/nn/utils/buffer_manager.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace ppl { namespace nn { namespace utils {
+
+/**
+   @class StaticPlanBufferManager
+   @brief records allocations of a run, computes fixed offsets of all buffers, and serves following runs from a
+   single arena without calling any allocator. buffers that are not freed within a run, e.g. outputs, keep their
+   places in the arena and are reallocated in place by the next run.
+   @note the n-th allocation of a run is matched with the n-th allocation of the recorded run. a mismatched
+   size means that shapes are changed and buffers are allocated by `fallback` until a new plan is made.
+*/
+class StaticPlanBufferManager final : public BufferManager {
+public:
+    /**
+       @param arena_allocator used to allocate the arena
+       @param fallback used when no plan is available. takes the ownership.
+    */
+    StaticPlanBufferManager(ppl::common::Allocator* arena_allocator, BufferManager* fallback, uint64_t alignment)
+        : BufferManager("StaticPlanBufferManager")
+        , alignment_(alignment)
+        , arena_allocator_(arena_allocator)
+        , fallback_(fallback) {}
+    ~StaticPlanBufferManager();
+
+    ppl::common::RetCode Realloc(uint64_t bytes, BufferDesc* buffer) override;
+    void Free(BufferDesc* buffer) override;
+    uint64_t GetBufferedBytes() const override {
+        return arena_size_ + fallback_->GetBufferedBytes();
+    }
+    uint64_t GetUsedBytes() const override {
+        return arena_used_bytes_ + fallback_->GetUsedBytes();
+    }
+    uint64_t GetLargestFreeBlockBytes() const override;
+
+    /**
+       @brief trims `fallback`. the arena is also freed if it is not in use and exceeds `keep_bytes`. the current plan
+       is dropped and a new one, fitting current shapes, is made from the next run. outputs that are not freed keep
+       the arena in use.
+       @note MUST NOT be called during a run.
+    */
+    uint64_t Trim(uint64_t keep_bytes) override;
+
+    /**
+       @brief marks the end of a run. a new plan is made from the recorded run, or the current plan is
+       dropped if allocations of this run mismatch.
+    */
+    void EndOfRun();
+
+    bool HasPlan() const {
+        return (state_ == STATE_REPLAYING);
+    }
+    uint64_t GetArenaSize() const {
+        return arena_size_;
+    }
+
+private:
+    static constexpr uint64_t UNPLANNED = UINT64_MAX;
+    static constexpr uint32_t NOT_FREED = UINT32_MAX;
+
+    enum {
+        STATE_RECORDING,
+        STATE_REPLAYING,
+    };
+
+    struct RecordedBlock final {
+        uint64_t bytes;
+        uint32_t alloc_ts;
+        uint32_t free_ts;
+    };
+
+    struct PlannedBlock final {
+        uint64_t bytes;
+        uint64_t offset;
+    };
+
+    bool IsInArena(const void* addr) const {
+        return (arena_ && addr >= arena_ && addr < arena_ + arena_size_);
+    }
+    /** @brief blocks that are not freed within the run are alive from the beginning of the run */
+    static uint32_t GetAllocTs(const RecordedBlock& block) {
+        return (block.free_ts == NOT_FREED) ? 0 : block.alloc_ts;
+    }
+    bool AcquireArenaBlock(uint64_t offset, uint64_t bytes);
+    /** @note `plan_` is left empty if the arena needs to be enlarged while some blocks are still in use */
+    ppl::common::RetCode BuildPlan();
+
+private:
+    const uint64_t alignment_;
+    ppl::common::Allocator* arena_allocator_;
+    std::unique_ptr<BufferManager> fallback_;
+
+    uint32_t state_ = STATE_RECORDING;
+    /** set if allocations of this run cannot be recorded or replayed */
+    bool is_diverged_ = false;
+    /** index of the next allocation in this run */
+    uint32_t cursor_ = 0;
+    /** logical time of allocations and frees in this run */
+    uint32_t ts_ = 0;
+
+    // ----- recording ----- //
+
+    std::vector<RecordedBlock> recorded_blocks_;
+    /** addr => index of `recorded_blocks_` */
+    std::map<const void*, uint32_t> recorded_addr2idx_;
+
+    // ----- replaying ----- //
+
+    std::vector<PlannedBlock> plan_;
+    char* arena_ = nullptr;
+    uint64_t arena_size_ = 0;
+    /** offset => end of blocks in arena that are in use */
+    std::map<uint64_t, uint64_t> arena_blocks_in_use_;
+    uint64_t arena_used_bytes_ = 0;
+
+private:
+    StaticPlanBufferManager(const StaticPlanBufferManager&) = delete;
+    StaticPlanBufferManager& operator=(const StaticPlanBufferManager&) = delete;
+};
+
+}}} // namespace ppl::nn::utils
+
+#endif
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/constant_cache.h"
+#include "ppl/nn/utils/generic_cpu_device.h"
+#include "gtest/gtest.h"
+#include <vector>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::nn::x86;
+using namespace ppl::common;
+
+class ConstantCacheTest : public testing::Test {
+protected:
+    void SetUp() override {
+        shape_.SetDataType(DATATYPE_FLOAT32);
+        shape_.SetDataFormat(DATAFORMAT_NDARRAY);
+        shape_.Reshape({ELEM_COUNT});
+        bytes_ = shape_.CalcBytesIncludingPadding();
+
+        for (uint32_t i = 0; i < 3; ++i) {
+            data_[i].resize(ELEM_COUNT, (float)(i + 1));
+        }
+    }
+
+    shared_ptr<ConstantCache::Entry> Register(ConstantCache* cache, uint32_t idx) {
+        return cache->Register("c" + std::to_string(idx), data_[idx].data(), shape_, shared_ptr<void>());
+    }
+
+    static bool IsLoaded(const ConstantCache& cache, uint32_t idx) {
+        ConstantCacheStatistics stat;
+        cache.GetStatistics(&stat);
+        return (stat.constant_info[idx].misses > stat.constant_info[idx].evictions);
+    }
+
+protected:
+    static constexpr int64_t ELEM_COUNT = ConstantCache::MIN_CONSTANT_BYTES / sizeof(float);
+    utils::GenericCpuDevice device_;
+    TensorShape shape_;
+    uint64_t bytes_;
+    vector<float> data_[3];
+};
+
+constexpr int64_t ConstantCacheTest::ELEM_COUNT;
+
+TEST_F(ConstantCacheTest, acquire_copies_data) {
+    ConstantCache cache(&device_);
+    cache.SetBudget(bytes_);
+
+    auto entry = Register(&cache, 1);
+    BufferDesc buffer;
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(entry.get(), &buffer));
+    EXPECT_NE(data_[1].data(), buffer.addr);
+    EXPECT_EQ(2.0f, ((const float*)buffer.addr)[ELEM_COUNT - 1]);
+    cache.Release(entry.get());
+
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(entry.get(), &buffer));
+    cache.Release(entry.get());
+
+    ConstantCacheStatistics stat;
+    cache.GetStatistics(&stat);
+    EXPECT_EQ(bytes_, stat.used_bytes);
+    EXPECT_EQ(1, stat.constant_info[0].misses);
+    EXPECT_EQ(1, stat.constant_info[0].hits);
+}
+
+TEST_F(ConstantCacheTest, evicts_least_recently_used) {
+    ConstantCache cache(&device_);
+    cache.SetBudget(2 * bytes_);
+
+    shared_ptr<ConstantCache::Entry> entries[3];
+    BufferDesc buffer;
+    for (uint32_t i = 0; i < 2; ++i) {
+        entries[i] = Register(&cache, i);
+        EXPECT_EQ(RC_SUCCESS, cache.Acquire(entries[i].get(), &buffer));
+        cache.Release(entries[i].get());
+    }
+
+    // c0 becomes the most recently used one
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(entries[0].get(), &buffer));
+    cache.Release(entries[0].get());
+
+    entries[2] = Register(&cache, 2);
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(entries[2].get(), &buffer));
+    cache.Release(entries[2].get());
+
+    EXPECT_TRUE(IsLoaded(cache, 0));
+    EXPECT_FALSE(IsLoaded(cache, 1));
+    EXPECT_TRUE(IsLoaded(cache, 2));
+
+    ConstantCacheStatistics stat;
+    cache.GetStatistics(&stat);
+    EXPECT_EQ(2 * bytes_, stat.used_bytes);
+    EXPECT_EQ(2 * bytes_, stat.peak_used_bytes);
+    EXPECT_EQ(1, stat.constant_info[1].evictions);
+}
+
+TEST_F(ConstantCacheTest, pinned_entries_are_not_evicted) {
+    ConstantCache cache(&device_);
+    cache.SetBudget(bytes_);
+
+    auto e0 = Register(&cache, 0);
+    auto e1 = Register(&cache, 1);
+
+    BufferDesc b0, b1;
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(e0.get(), &b0));
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(e1.get(), &b1));
+
+    // both are in use and the budget is exceeded
+    EXPECT_TRUE(IsLoaded(cache, 0));
+    EXPECT_TRUE(IsLoaded(cache, 1));
+    EXPECT_EQ(1.0f, ((const float*)b0.addr)[0]);
+    EXPECT_EQ(2.0f, ((const float*)b1.addr)[0]);
+
+    // c0 is the least recently used one and is evicted once it is released
+    cache.Release(e0.get());
+    EXPECT_FALSE(IsLoaded(cache, 0));
+    EXPECT_TRUE(IsLoaded(cache, 1));
+    cache.Release(e1.get());
+
+    ConstantCacheStatistics stat;
+    cache.GetStatistics(&stat);
+    EXPECT_EQ(bytes_, stat.used_bytes);
+    EXPECT_EQ(2 * bytes_, stat.peak_used_bytes);
+}
+
+TEST_F(ConstantCacheTest, unregister_frees_buffer) {
+    ConstantCache cache(&device_);
+    cache.SetBudget(bytes_);
+
+    auto entry = Register(&cache, 0);
+    BufferDesc buffer;
+    EXPECT_EQ(RC_SUCCESS, cache.Acquire(entry.get(), &buffer));
+    cache.Release(entry.get());
+    entry.reset();
+
+    ConstantCacheStatistics stat;
+    cache.GetStatistics(&stat);
+    EXPECT_EQ(0, stat.used_bytes);
+    EXPECT_TRUE(stat.constant_info.empty());
+}
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/optimizer/opt_graph.h"
+#include "ppl/nn/engines/x86/engine_context.h"
+#include "ppl/nn/engines/x86/engine_factory.h"
+#include "ppl/nn/params/onnx/random_uniform_param.h"
+#include "ppl/nn/utils/shared_resource.h"
+#include "ppl/kernel/x86/common/general_include.h"
+#include "tests/ir/graph_builder.h"
+#include "gtest/gtest.h"
+#include <memory>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::nn::test;
+using namespace ppl::common;
+
+static const int64_t g_elem_count = 4;
+
+class ConstantFoldingTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // registers x86 ops
+        engine_.reset(x86::EngineFactory::Create(x86::EngineOptions()));
+    }
+
+    static void AddConstant(const string& name, const vector<float>& values, GraphBuilder* builder) {
+        builder->AddConstant(name);
+
+        auto graph = builder->GetGraph();
+        auto eid = graph->topo->GetEdge(name)->GetId();
+
+        ir::Constant constant;
+        constant.data.Init(values.size() * sizeof(float));
+        memcpy(constant.data.GetData(), values.data(), values.size() * sizeof(float));
+        graph->data->constants.emplace(eid, std::move(constant));
+    }
+
+    static void SetShapes(ir::Graph* graph) {
+        ir::Shape shape;
+        shape.data_type = DATATYPE_FLOAT32;
+        shape.data_format = DATAFORMAT_NDARRAY;
+        shape.dims.push_back(g_elem_count);
+
+        for (auto it = graph->topo->CreateEdgeIter(); it->IsValid(); it->Forward()) {
+            auto edge = it->Get();
+            bool is_input = (edge->GetProducer() == INVALID_NODEID);
+            if (is_input) {
+                graph->data->shapes.insert(make_pair(edge->GetId(), shape));
+            }
+        }
+    }
+
+protected:
+    unique_ptr<Engine> engine_;
+};
+
+/*
+  a, b: constants
+  c = Add(a, b); d = Relu(c); y = Mul(x, d)     -> Add and Relu are folded
+  z = Add(a, b)                                 -> z is an output of the graph and is kept
+  r = RandomUniform(); s = Add(r, a); w = Mul(x, s) -> RandomUniform and its consumer are kept
+*/
+TEST_F(ConstantFoldingTest, fold_chain) {
+    GraphBuilder builder("constant_folding");
+    AddConstant("a", {1, -2, 3, -4}, &builder);
+    AddConstant("b", {1, 1, 1, 1}, &builder);
+    builder.AddNode("add", ir::Node::Type("", "Add", 14), {"a", "b"}, {"c"});
+    builder.AddNode("relu", ir::Node::Type("", "Relu", 14), {"c"}, {"d"});
+    builder.AddNode("mul", ir::Node::Type("", "Mul", 14), {"x", "d"}, {"y"});
+    builder.AddNode("add_out", ir::Node::Type("", "Add", 14), {"a", "b"}, {"z"});
+    builder.AddNode("random", ir::Node::Type("", "RandomUniform", 1), {}, {"r"});
+    builder.AddNode("add_r", ir::Node::Type("", "Add", 14), {"r", "a"}, {"s"});
+    builder.AddNode("mul_r", ir::Node::Type("", "Mul", 14), {"x", "s"}, {"w"});
+    EXPECT_EQ(RC_SUCCESS, builder.Finalize());
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetShapes(graph);
+
+    auto random_param = make_shared<ppl::nn::onnx::RandomUniformParam>();
+    random_param->dtype = DATATYPE_FLOAT32;
+    random_param->high = 1;
+    random_param->low = 0;
+    random_param->shape.push_back(g_elem_count);
+    graph->data->attrs.insert(make_pair(topo->GetNode("random")->GetId(), random_param));
+
+    utils::SharedResource resource;
+    RuntimePartitionInfo info;
+    x86::EngineConfig config;
+    x86::X86Device device(X86_DEFAULT_ALIGNMENT, GetCpuISA());
+
+    x86::OptGraph opt_graph;
+    EXPECT_EQ(RC_SUCCESS, opt_graph.Init(resource, graph, &info));
+    EXPECT_EQ(RC_SUCCESS, opt_graph.DoOptimize(resource, config, &device));
+
+    EXPECT_EQ(nullptr, topo->GetNode("add"));
+    EXPECT_EQ(nullptr, topo->GetNode("relu"));
+    EXPECT_NE(nullptr, topo->GetNode("mul"));
+
+    auto d = topo->GetEdge("d");
+    ASSERT_NE(nullptr, d);
+    EXPECT_EQ(INVALID_NODEID, d->GetProducer());
+    auto d_ref = graph->data->constants.find(d->GetId());
+    ASSERT_NE(graph->data->constants.end(), d_ref);
+    const float expected[] = {2, 0, 4, 0};
+    ASSERT_EQ(sizeof(expected), d_ref->second.data.GetSize());
+    EXPECT_EQ(0, memcmp(expected, d_ref->second.data.GetData(), sizeof(expected)));
+
+    // outputs of the graph are not folded
+    EXPECT_NE(nullptr, topo->GetNode("add_out"));
+    EXPECT_EQ(graph->data->constants.end(), graph->data->constants.find(topo->GetEdge("z")->GetId()));
+
+    // random ops and their consumers are not folded
+    EXPECT_NE(nullptr, topo->GetNode("random"));
+    EXPECT_NE(nullptr, topo->GetNode("add_r"));
+    EXPECT_EQ(graph->data->constants.end(), graph->data->constants.find(topo->GetEdge("s")->GetId()));
+}
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/engines/x86/runtime_x86_device.h"
+#include "gtest/gtest.h"
+using namespace ppl::nn;
+using namespace ppl::nn::x86;
+using namespace ppl::common;
+
+static constexpr uint64_t TEST_ALIGNMENT = 64;
+
+TEST(RuntimeX86DeviceTest, shared_tmp_buffer_is_kept) {
+    const uint32_t policies[] = {MM_COMPACT, MM_MRU, MM_STATIC_PLAN};
+    for (auto policy : policies) {
+        RuntimeX86Device dev(TEST_ALIGNMENT, 0);
+        EXPECT_EQ(RC_SUCCESS, dev.Init(policy));
+
+        // the first run collects requirements of kernels, and the shared buffer is reserved at the end of it
+        BufferDesc small, large;
+        EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &small));
+        dev.FreeTmpBuffer(&small);
+        EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(4096, &large));
+        dev.FreeTmpBuffer(&large);
+        EXPECT_EQ(RC_SUCCESS, dev.Synchronize());
+
+        DeviceMemoryStatistics stat;
+        EXPECT_EQ(RC_SUCCESS, dev.GetMemoryStatistics(&stat));
+        const uint64_t buffered_bytes = stat.buffered_bytes;
+
+        void* addr = nullptr;
+        for (uint32_t i = 0; i < 3; ++i) {
+            EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &small));
+            if (addr) {
+                EXPECT_EQ(addr, small.addr);
+            }
+            addr = small.addr;
+            dev.FreeTmpBuffer(&small);
+
+            EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(4096, &large));
+            EXPECT_EQ(addr, large.addr);
+            dev.FreeTmpBuffer(&large);
+            EXPECT_EQ(RC_SUCCESS, dev.Synchronize());
+        }
+
+        EXPECT_EQ(RC_SUCCESS, dev.GetMemoryStatistics(&stat));
+        EXPECT_EQ(buffered_bytes, stat.buffered_bytes);
+        EXPECT_EQ(4096, stat.max_tmp_buffer_bytes);
+    }
+}
+
+TEST(RuntimeX86DeviceTest, concurrent_tmp_buffers) {
+    RuntimeX86Device dev(TEST_ALIGNMENT, 0);
+    EXPECT_EQ(RC_SUCCESS, dev.Init(MM_COMPACT));
+
+    BufferDesc b0, b1;
+    EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &b0));
+    dev.FreeTmpBuffer(&b0);
+    EXPECT_EQ(RC_SUCCESS, dev.Synchronize());
+
+    // the shared buffer is occupied by another kernel
+    EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &b0));
+    EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &b1));
+    EXPECT_NE(b0.addr, b1.addr);
+    dev.FreeTmpBuffer(&b1);
+    dev.FreeTmpBuffer(&b0);
+
+    EXPECT_EQ(RC_SUCCESS, dev.AllocTmpBuffer(1024, &b1));
+    EXPECT_EQ(b0.addr, b1.addr);
+    dev.FreeTmpBuffer(&b1);
+}
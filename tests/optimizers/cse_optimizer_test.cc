@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gtest/gtest.h"
+#include "tests/ir/graph_builder.h"
+#include "ppl/nn/optimizers/cse_optimizer.h"
+#include <cstring>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::nn::test;
+using namespace ppl::common;
+
+class CSEOptimizerTest : public testing::Test {
+protected:
+    void SetConstant(ir::Graph* graph, const string& name, int64_t value) {
+        auto eid = graph->topo->GetEdge(name)->GetId();
+
+        auto& constant = graph->data->constants[eid];
+        constant.data.Init(sizeof(value));
+        memcpy(constant.data.GetData(), &value, sizeof(value));
+
+        auto& shape = graph->data->shapes[eid];
+        shape.data_type = DATATYPE_INT64;
+        shape.data_format = DATAFORMAT_NDARRAY;
+        shape.dims = {1};
+    }
+};
+
+TEST_F(CSEOptimizerTest, merge_chains) {
+    GraphBuilder builder;
+    builder.AddNode("a", ir::Node::Type("test", "op1", 1), {"in"}, {"out_a"});
+    builder.AddNode("b", ir::Node::Type("test", "op1", 1), {"in"}, {"out_b"});
+    builder.AddNode("c", ir::Node::Type("test", "op2", 1), {"out_a"}, {"out_c"});
+    builder.AddNode("d", ir::Node::Type("test", "op2", 1), {"out_b"}, {"out_d"});
+    builder.AddNode("e", ir::Node::Type("test", "op3", 1), {"out_c", "out_d"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+
+    CSEOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    // either of the duplicated chains is kept
+    EXPECT_TRUE((topo->GetNode("a") == nullptr) != (topo->GetNode("b") == nullptr));
+    EXPECT_TRUE((topo->GetNode("c") == nullptr) != (topo->GetNode("d") == nullptr));
+    EXPECT_EQ(1, topo->GetEdge("in")->CalcConsumerCount());
+
+    auto e = topo->GetNode("e");
+    EXPECT_EQ(e->GetInput(0), e->GetInput(1));
+    auto merged_edge = topo->GetEdge(e->GetInput(0));
+    ASSERT_NE(nullptr, merged_edge);
+    EXPECT_EQ(1, merged_edge->CalcConsumerCount());
+}
+
+TEST_F(CSEOptimizerTest, merge_constants) {
+    GraphBuilder builder;
+    builder.AddConstant("c1");
+    builder.AddConstant("c2");
+    builder.AddConstant("c3");
+    builder.AddNode("a", ir::Node::Type("test", "op1", 1), {"in", "c1"}, {"out_a"});
+    builder.AddNode("b", ir::Node::Type("test", "op1", 1), {"in", "c2"}, {"out_b"});
+    builder.AddNode("c", ir::Node::Type("test", "op1", 1), {"in", "c3"}, {"out_c"});
+    builder.AddNode("d", ir::Node::Type("test", "op3", 1), {"out_a", "out_b", "out_c"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetConstant(graph, "c1", 1);
+    SetConstant(graph, "c2", 1);
+    SetConstant(graph, "c3", 2);
+
+    CSEOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    EXPECT_EQ(2, topo->GetConstantCount());
+    EXPECT_EQ(nullptr, topo->GetEdge("c2"));
+    EXPECT_EQ(2, graph->data->constants.size());
+    EXPECT_TRUE((topo->GetNode("a") == nullptr) != (topo->GetNode("b") == nullptr));
+    EXPECT_NE(nullptr, topo->GetNode("c"));
+}
+
+TEST_F(CSEOptimizerTest, keep_graph_outputs) {
+    GraphBuilder builder;
+    builder.AddNode("a", ir::Node::Type("test", "op1", 1), {"in"}, {"out_a"});
+    builder.AddNode("b", ir::Node::Type("test", "op1", 1), {"in"}, {"out_b"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    CSEOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    EXPECT_NE(nullptr, graph->topo->GetNode("a"));
+    EXPECT_NE(nullptr, graph->topo->GetNode("b"));
+}
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "gtest/gtest.h"
+#include "tests/ir/graph_builder.h"
+#include "ppl/nn/optimizers/transpose_reshape_optimizer.h"
+#include "ppl/nn/params/onnx/transpose_param.h"
+#include <cstring>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::nn::test;
+using namespace ppl::common;
+
+class TransposeReshapeOptimizerTest : public testing::Test {
+protected:
+    void SetPerm(ir::Graph* graph, const string& name, const vector<int32_t>& perm) {
+        auto param = make_shared<onnx::TransposeParam>();
+        param->perm = perm;
+        graph->data->attrs[graph->topo->GetNode(name)->GetId()] = param;
+    }
+    void SetShape(ir::Graph* graph, const string& name, const vector<int64_t>& dims) {
+        auto& shape = graph->data->shapes[graph->topo->GetEdge(name)->GetId()];
+        shape.data_type = DATATYPE_FLOAT32;
+        shape.data_format = DATAFORMAT_NDARRAY;
+        shape.dims = dims;
+    }
+    void SetInt64Constant(ir::Graph* graph, const string& name, const vector<int64_t>& values) {
+        auto eid = graph->topo->GetEdge(name)->GetId();
+
+        auto& constant = graph->data->constants[eid];
+        constant.data.Init(values.size() * sizeof(int64_t));
+        memcpy(constant.data.GetData(), values.data(), values.size() * sizeof(int64_t));
+
+        auto& shape = graph->data->shapes[eid];
+        shape.data_type = DATATYPE_INT64;
+        shape.data_format = DATAFORMAT_NDARRAY;
+        shape.dims = {(int64_t)values.size()};
+    }
+};
+
+TEST_F(TransposeReshapeOptimizerTest, cancel_transposes) {
+    GraphBuilder builder;
+    builder.AddNode("t1", ir::Node::Type("", "Transpose", 1), {"in"}, {"out_t1"});
+    builder.AddNode("t2", ir::Node::Type("", "Transpose", 1), {"out_t1"}, {"out_t2"});
+    builder.AddNode("c", ir::Node::Type("test", "op1", 1), {"out_t2"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetPerm(graph, "t1", {0, 2, 3, 1});
+    SetPerm(graph, "t2", {0, 3, 1, 2});
+
+    TransposeReshapeOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    EXPECT_EQ(nullptr, topo->GetNode("t1"));
+    EXPECT_EQ(nullptr, topo->GetNode("t2"));
+    EXPECT_EQ(topo->GetEdge("in")->GetId(), topo->GetNode("c")->GetInput(0));
+}
+
+TEST_F(TransposeReshapeOptimizerTest, sink_through_elementwise_ops) {
+    GraphBuilder builder;
+    builder.AddConstant("scale");
+    builder.AddNode("ta", ir::Node::Type("", "Transpose", 1), {"a"}, {"out_ta"});
+    builder.AddNode("tb", ir::Node::Type("", "Transpose", 1), {"b"}, {"out_tb"});
+    builder.AddNode("add", ir::Node::Type("", "Add", 7), {"out_ta", "out_tb"}, {"out_add"});
+    builder.AddNode("relu", ir::Node::Type("", "Relu", 6), {"out_add"}, {"out_relu"});
+    builder.AddNode("mul", ir::Node::Type("", "Mul", 7), {"out_relu", "scale"}, {"out_mul"});
+    builder.AddNode("tc", ir::Node::Type("", "Transpose", 1), {"out_mul"}, {"out_tc"});
+    builder.AddNode("d", ir::Node::Type("test", "op1", 1), {"out_tc"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetPerm(graph, "ta", {0, 2, 3, 1});
+    SetPerm(graph, "tb", {0, 2, 3, 1});
+    SetPerm(graph, "tc", {0, 3, 1, 2});
+    SetShape(graph, "out_ta", {1, 4, 4, 8});
+    SetShape(graph, "out_tb", {1, 4, 4, 8});
+    SetShape(graph, "scale", {1});
+    graph->data->constants[topo->GetEdge("scale")->GetId()].data.Init(sizeof(float));
+
+    TransposeReshapeOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    EXPECT_EQ(nullptr, topo->GetNode("ta"));
+    EXPECT_EQ(nullptr, topo->GetNode("tb"));
+    EXPECT_EQ(nullptr, topo->GetNode("tc"));
+
+    auto add = topo->GetNode("add");
+    EXPECT_EQ(topo->GetEdge("a")->GetId(), add->GetInput(0));
+    EXPECT_EQ(topo->GetEdge("b")->GetId(), add->GetInput(1));
+    EXPECT_EQ(topo->GetNode("mul")->GetOutput(0), topo->GetNode("d")->GetInput(0));
+}
+
+TEST_F(TransposeReshapeOptimizerTest, compose_reshapes) {
+    GraphBuilder builder;
+    builder.AddConstant("s1");
+    builder.AddConstant("s2");
+    builder.AddNode("r1", ir::Node::Type("", "Reshape", 14), {"in", "s1"}, {"out_r1"});
+    builder.AddNode("r2", ir::Node::Type("", "Reshape", 14), {"out_r1", "s2"}, {"out_r2"});
+    builder.AddNode("c", ir::Node::Type("test", "op1", 1), {"out_r2"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetInt64Constant(graph, "s1", {2, -1});
+    SetInt64Constant(graph, "s2", {4, 4, 2});
+    SetShape(graph, "in", {4, 4, 2});
+    SetShape(graph, "out_r1", {2, 16});
+    SetShape(graph, "out_r2", {4, 4, 2});
+
+    TransposeReshapeOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    // r2 becomes an identity after r1 is removed
+    EXPECT_EQ(nullptr, topo->GetNode("r1"));
+    EXPECT_EQ(nullptr, topo->GetNode("r2"));
+    EXPECT_EQ(nullptr, topo->GetEdge("s1"));
+    EXPECT_EQ(nullptr, topo->GetEdge("s2"));
+    EXPECT_EQ(topo->GetEdge("in")->GetId(), topo->GetNode("c")->GetInput(0));
+}
+
+TEST_F(TransposeReshapeOptimizerTest, keep_graph_outputs) {
+    GraphBuilder builder;
+    builder.AddNode("t1", ir::Node::Type("", "Transpose", 1), {"in"}, {"out_t1"});
+    builder.AddNode("t2", ir::Node::Type("", "Transpose", 1), {"out_t1"}, {"out"});
+    builder.Finalize();
+
+    auto graph = builder.GetGraph();
+    auto topo = graph->topo.get();
+    SetPerm(graph, "t1", {1, 0});
+    SetPerm(graph, "t2", {1, 0});
+
+    TransposeReshapeOptimizer optimizer;
+    EXPECT_EQ(RC_SUCCESS, optimizer.Optimize(graph));
+
+    // t2 outputs an identity of `in`, but its output is kept
+    EXPECT_EQ(nullptr, topo->GetNode("t1"));
+    auto t2 = topo->GetNode("t2");
+    ASSERT_NE(nullptr, t2);
+    EXPECT_EQ(topo->GetEdge("in")->GetId(), t2->GetInput(0));
+}
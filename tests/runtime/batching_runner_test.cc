@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/runtime/batching_runner_factory.h"
+#include "ppl/nn/runtime/runtime_pool_factory.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <memory>
+#include <thread>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::common;
+
+class HostTensorForTest final : public Tensor {
+public:
+    const char* GetName() const override {
+        return "host";
+    }
+    TensorShape* GetShape() const override {
+        return &shape_;
+    }
+    RetCode CopyToHost(void* dst) const override {
+        memcpy(dst, data_.data(), data_.size());
+        return RC_SUCCESS;
+    }
+    RetCode CopyToHostAsync(void* dst) const override {
+        return CopyToHost(dst);
+    }
+    RetCode CopyFromHost(const void* src) override {
+        data_.resize(shape_.CalcBytesExcludingPadding());
+        memcpy(data_.data(), src, data_.size());
+        return RC_SUCCESS;
+    }
+    RetCode CopyFromHostAsync(const void* src) override {
+        return CopyFromHost(src);
+    }
+    RetCode ConvertToHost(void* dst, const TensorShape&) const override {
+        return CopyToHost(dst);
+    }
+    RetCode ConvertToHostAsync(void* dst, const TensorShape&) const override {
+        return CopyToHost(dst);
+    }
+    RetCode ConvertFromHost(const void* src, const TensorShape&) override {
+        return CopyFromHost(src);
+    }
+    RetCode ConvertFromHostAsync(const void* src, const TensorShape&) override {
+        return CopyFromHost(src);
+    }
+    DeviceContext* GetDeviceContext() const override {
+        return nullptr;
+    }
+    void SetDeviceContext(DeviceContext*) override {}
+    void FreeBuffer() override {}
+    void SetBufferPtr(void*) override {}
+    void* GetBufferPtr() const override {
+        return const_cast<char*>(data_.data());
+    }
+    RetCode BindHostBuffer(void*, uint64_t) override {
+        return RC_UNSUPPORTED;
+    }
+
+    vector<char>* GetData() {
+        return &data_;
+    }
+
+private:
+    mutable TensorShape shape_;
+    vector<char> data_;
+};
+
+/** output = input * 2 */
+class DoubleRuntimeForTest final : public Runtime {
+public:
+    DoubleRuntimeForTest() {
+        input_.GetShape()->SetDataType(DATATYPE_FLOAT32);
+        input_.GetShape()->SetDataFormat(DATAFORMAT_NDARRAY);
+        output_.GetShape()->SetDataType(DATATYPE_FLOAT32);
+        output_.GetShape()->SetDataFormat(DATAFORMAT_NDARRAY);
+    }
+
+    RetCode Configure(uint32_t, ...) override {
+        return RC_UNSUPPORTED;
+    }
+    uint32_t GetInputCount() const override {
+        return 1;
+    }
+    Tensor* GetInputTensor(uint32_t) const override {
+        return &input_;
+    }
+    RetCode Run() override {
+        auto shape = input_.GetShape();
+        output_.GetShape()->Reshape(shape->GetDims(), shape->GetDimCount());
+
+        auto in = (const float*)input_.GetBufferPtr();
+        vector<float> out(shape->CalcElementsExcludingPadding());
+        for (uint32_t i = 0; i < out.size(); ++i) {
+            out[i] = in[i] * 2;
+        }
+        return output_.CopyFromHost(out.data());
+    }
+    RetCode RunAsync() override {
+        return Run();
+    }
+    RetCode Synchronize() override {
+        return RC_SUCCESS;
+    }
+    uint32_t GetOutputCount() const override {
+        return 1;
+    }
+    Tensor* GetOutputTensor(uint32_t) const override {
+        return &output_;
+    }
+    Tensor* GetTensor(const char*) const override {
+        return nullptr;
+    }
+    uint32_t GetDeviceContextCount() const override {
+        return 0;
+    }
+    DeviceContext* GetDeviceContext(uint32_t) const override {
+        return nullptr;
+    }
+    PartitionRunner* CreatePartitionRunner(const char**, uint32_t, const char**, uint32_t) override {
+        return nullptr;
+    }
+    RetCode GetProfilingStatistics(ProfilingStatistics*) const override {
+        return RC_UNSUPPORTED;
+    }
+    RetCode GetMemoryStatistics(MemoryStatistics*) const override {
+        return RC_UNSUPPORTED;
+    }
+
+private:
+    mutable HostTensorForTest input_;
+    mutable HostTensorForTest output_;
+};
+
+static BatchingRunner* CreateBatchingRunnerForTest(const BatchingRunnerOptions& options) {
+    RuntimePoolOptions pool_options;
+    Runtime* runtime = new DoubleRuntimeForTest();
+    return BatchingRunnerFactory::Create(RuntimePoolFactory::Create(&runtime, pool_options), options);
+}
+
+static RetCode RunRequest(BatchingRunner* runner, const vector<float>& data, vector<BatchingOutput>* outputs) {
+    vector<BatchingInput> inputs(1);
+    inputs[0].data = data.data();
+    inputs[0].dims = {(int64_t)data.size() / 3, 3};
+    return runner->Run(inputs, outputs);
+}
+
+static void CheckOutput(const vector<float>& input, const BatchingOutput& output) {
+    EXPECT_EQ(2, output.dims.size());
+    EXPECT_EQ((int64_t)input.size() / 3, output.dims[0]);
+    EXPECT_EQ(3, output.dims[1]);
+    EXPECT_EQ(input.size() * sizeof(float), output.data.size());
+
+    auto out = (const float*)output.data.data();
+    for (uint32_t i = 0; i < input.size(); ++i) {
+        EXPECT_EQ(input[i] * 2, out[i]);
+    }
+}
+
+TEST(BatchingRunnerTest, single_request) {
+    BatchingRunnerOptions options;
+    options.max_delay_microseconds = 0;
+    unique_ptr<BatchingRunner> runner(CreateBatchingRunnerForTest(options));
+    EXPECT_NE(nullptr, runner.get());
+
+    vector<float> input = {1, 2, 3, 4, 5, 6};
+    vector<BatchingOutput> outputs;
+    EXPECT_EQ(RC_SUCCESS, RunRequest(runner.get(), input, &outputs));
+    EXPECT_EQ(1, outputs.size());
+    CheckOutput(input, outputs[0]);
+
+    vector<BatchingInput> invalid_inputs(2);
+    EXPECT_EQ(RC_INVALID_VALUE, runner->Run(invalid_inputs, &outputs));
+}
+
+TEST(BatchingRunnerTest, multi_threads) {
+    BatchingRunnerOptions options;
+    options.max_batch_size = 4;
+    // batches are run only when they are full. each client waits for its request before sending the next one, so
+    // every batch has exactly one request from each of the `max_batch_size` clients.
+    options.max_delay_microseconds = 60 * 1000 * 1000;
+    unique_ptr<BatchingRunner> runner(CreateBatchingRunnerForTest(options));
+    EXPECT_NE(nullptr, runner.get());
+
+    const uint32_t nr_thread = options.max_batch_size;
+    const uint32_t nr_loop = 20;
+    vector<thread> clients;
+    for (uint32_t i = 0; i < nr_thread; ++i) {
+        clients.emplace_back([&runner, i, nr_loop]() -> void {
+            for (uint32_t j = 0; j < nr_loop; ++j) {
+                vector<float> input = {(float)i, (float)j, (float)(i + j)};
+                vector<BatchingOutput> outputs;
+                EXPECT_EQ(RC_SUCCESS, RunRequest(runner.get(), input, &outputs));
+                CheckOutput(input, outputs[0]);
+            }
+        });
+    }
+    for (auto t = clients.begin(); t != clients.end(); ++t) {
+        t->join();
+    }
+
+    BatchingRunnerStatistics stat;
+    EXPECT_EQ(RC_SUCCESS, runner->GetStatistics(&stat));
+    EXPECT_EQ(nr_thread * nr_loop, stat.request_count);
+    EXPECT_EQ(nr_thread * nr_loop, stat.sample_count);
+    EXPECT_EQ(options.max_batch_size, stat.max_samples_in_batch);
+    EXPECT_EQ(nr_loop, stat.batch_count);
+}
+
+TEST(BatchingRunnerTest, different_dims_are_not_batched) {
+    BatchingRunnerOptions options;
+    options.max_delay_microseconds = 10000;
+    unique_ptr<BatchingRunner> runner(CreateBatchingRunnerForTest(options));
+    EXPECT_NE(nullptr, runner.get());
+
+    vector<float> input1 = {1, 2, 3};
+    vector<float> input2 = {1, 2, 3, 4};
+    thread t([&runner, &input2]() -> void {
+        vector<BatchingInput> inputs(1);
+        inputs[0].data = input2.data();
+        inputs[0].dims = {1, 4};
+        vector<BatchingOutput> outputs;
+        EXPECT_EQ(RC_SUCCESS, runner->Run(inputs, &outputs));
+        EXPECT_EQ(4, outputs[0].dims[1]);
+    });
+
+    vector<BatchingOutput> outputs;
+    EXPECT_EQ(RC_SUCCESS, RunRequest(runner.get(), input1, &outputs));
+    CheckOutput(input1, outputs[0]);
+    t.join();
+
+    BatchingRunnerStatistics stat;
+    EXPECT_EQ(RC_SUCCESS, runner->GetStatistics(&stat));
+    EXPECT_EQ(2, stat.batch_count);
+}
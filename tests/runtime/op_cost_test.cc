@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/runtime/op_cost.h"
+#include "gtest/gtest.h"
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::common;
+
+static TensorShape MakeShape(const vector<int64_t>& dims) {
+    TensorShape shape;
+    shape.SetDataType(DATATYPE_FLOAT32);
+    shape.SetDataFormat(DATAFORMAT_NDARRAY);
+    shape.Reshape(dims);
+    return shape;
+}
+
+TEST(OpCostTest, conv) {
+    auto x = MakeShape({1, 8, 16, 16});
+    auto w = MakeShape({4, 2, 3, 3}); // group = 4
+    auto y = MakeShape({1, 4, 14, 14});
+
+    OpCost cost;
+    EstimateOpCost(ir::Node::Type("", "Conv", 11), {&x, &w, nullptr}, {&y}, &cost);
+    EXPECT_EQ(2 * (1 * 4 * 14 * 14) * (2 * 3 * 3), cost.flops);
+    EXPECT_EQ((x.CalcElementsExcludingPadding() + w.CalcElementsExcludingPadding() + y.CalcElementsExcludingPadding()) *
+                  sizeof(float),
+              cost.bytes);
+}
+
+TEST(OpCostTest, matmul) {
+    auto a = MakeShape({2, 3, 5});
+    auto b = MakeShape({5, 7});
+    auto y = MakeShape({2, 3, 7});
+
+    OpCost cost;
+    EstimateOpCost(ir::Node::Type("", "MatMul", 13), {&a, &b}, {&y}, &cost);
+    EXPECT_EQ(2 * (2 * 3 * 7) * 5, cost.flops);
+}
+
+TEST(OpCostTest, data_movement) {
+    auto x = MakeShape({2, 3});
+    auto y = MakeShape({3, 2});
+
+    OpCost cost;
+    EstimateOpCost(ir::Node::Type("", "Transpose", 13), {&x}, {&y}, &cost);
+    EXPECT_EQ(0, cost.flops);
+    EXPECT_EQ(12 * sizeof(float), cost.bytes);
+}
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/runtime/parallel_scheduler.h"
+#include "ppl/nn/runtime/runtime_aux_info.h"
+#include "tests/engines/tmp_kernel.h"
+#include "tests/ir/graph_builder.h"
+#include "gtest/gtest.h"
+#include <mutex>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::common;
+using namespace ppl::nn::test;
+
+class ParallelSchedulerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        builder_.AddNode("a", ir::Node::Type("test", "op1", 1), {"in1"}, {"out1", "out2"});
+        builder_.AddNode("b", ir::Node::Type("test", "op1", 1), {"out1", "out6", "out9", "out11"}, {"out3"});
+        builder_.AddNode("c", ir::Node::Type("test", "op1", 1), {"out1"}, {"out4"});
+        builder_.AddNode("d", ir::Node::Type("test", "op1", 1), {"out2"}, {"out5"});
+        builder_.AddNode("e", ir::Node::Type("test", "op1", 1), {"out4"}, {"out6", "out7"});
+        builder_.AddNode("f", ir::Node::Type("test", "op1", 1), {"out5"}, {"out8"});
+        builder_.AddNode("g", ir::Node::Type("test", "op1", 1), {"out7", "out8"}, {"out9"});
+        builder_.AddNode("h", ir::Node::Type("test", "op1", 1), {"in2"}, {"out10"});
+        builder_.AddNode("i", ir::Node::Type("test", "op1", 1), {"out9", "out10"}, {"out11"});
+        builder_.Finalize();
+
+        auto topo = builder_.GetGraph()->topo.get();
+        auto status = aux_info_.Init(topo, {});
+        EXPECT_EQ(RC_SUCCESS, status);
+
+        edgeid2object_.resize(topo->GetCurrentEdgeIdBound(), nullptr);
+        nodeid2kernel_.resize(topo->GetCurrentNodeIdBound());
+        for (auto it = topo->CreateNodeIter(); it->IsValid(); it->Forward()) {
+            auto node = it->Get();
+            nodeid2kernel_[node->GetId()].reset(new TmpKernelOne(node));
+        }
+    }
+
+    Scheduler::Options GetOptions() {
+        return Scheduler::Options(builder_.GetGraph()->topo.get(), &aux_info_.sorted_nodes,
+                                  &aux_info_.edge_last_consumer, &edgeid2object_, &nodeid2kernel_);
+    }
+
+protected:
+    GraphBuilder builder_;
+    RuntimeAuxInfo aux_info_;
+    vector<EdgeObject*> edgeid2object_;
+    vector<unique_ptr<KernelImpl>> nodeid2kernel_;
+};
+
+static RetCode AcquireOutputs(KernelExecContext* ctx) {
+    for (uint32_t i = 0; i < ctx->GetOutputCount(); ++i) {
+        if (!ctx->GetOutput<TensorImpl>(i)) {
+            return RC_OUT_OF_MEMORY;
+        }
+    }
+    return RC_SUCCESS;
+}
+
+TEST_F(ParallelSchedulerTest, run) {
+    ParallelScheduler sched(4);
+    EXPECT_EQ(4, sched.GetThreadCount());
+    EXPECT_EQ(RC_SUCCESS, sched.Init(GetOptions()));
+
+    auto topo = builder_.GetGraph()->topo.get();
+
+    for (uint32_t n = 0; n < 10; ++n) {
+        mutex order_mutex;
+        vector<nodeid_t> exec_order;
+
+        auto status = sched.ForEach(
+            [&order_mutex, &exec_order](KernelImpl* kernel, KernelExecContext* ctx) -> RetCode {
+                {
+                    lock_guard<mutex> lck(order_mutex);
+                    exec_order.push_back(kernel->GetNode()->GetId());
+                }
+                return AcquireOutputs(ctx);
+            },
+            nullptr);
+        EXPECT_EQ(RC_SUCCESS, status);
+        EXPECT_EQ(aux_info_.sorted_nodes.size(), exec_order.size());
+
+        vector<uint32_t> nid2pos(topo->GetCurrentNodeIdBound());
+        for (uint32_t i = 0; i < exec_order.size(); ++i) {
+            nid2pos[exec_order[i]] = i;
+        }
+        for (auto x = exec_order.begin(); x != exec_order.end(); ++x) {
+            auto prevs = topo->FindPredecessors(*x);
+            for (auto p = prevs.begin(); p != prevs.end(); ++p) {
+                EXPECT_LT(nid2pos[*p], nid2pos[*x]);
+            }
+        }
+
+        // edges that are not outputs should be released by their last consumers
+        for (uint32_t i = 0; i < edgeid2object_.size(); ++i) {
+            if (aux_info_.edge_last_consumer[i] != INVALID_NODEID) {
+                EXPECT_EQ(nullptr, edgeid2object_[i]);
+            }
+        }
+    }
+}
+
+TEST_F(ParallelSchedulerTest, exec_failed) {
+    ParallelScheduler sched(2);
+    EXPECT_EQ(RC_SUCCESS, sched.Init(GetOptions()));
+
+    auto topo = builder_.GetGraph()->topo.get();
+    auto failed_node = topo->GetNode(aux_info_.sorted_nodes[0]);
+
+    auto status = sched.ForEach(
+        [failed_node](KernelImpl* kernel, KernelExecContext* ctx) -> RetCode {
+            auto rc = AcquireOutputs(ctx);
+            if (rc != RC_SUCCESS) {
+                return rc;
+            }
+            return (kernel->GetNode() == failed_node) ? RC_INVALID_VALUE : RC_SUCCESS;
+        },
+        nullptr);
+    EXPECT_EQ(RC_INVALID_VALUE, status);
+}
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/runtime/runtime_pool_factory.h"
+#include "ppl/nn/runtime/runtime_impl.h"
+#include "gtest/gtest.h"
+#include <memory>
+#include <thread>
+using namespace std;
+using namespace ppl::nn;
+using namespace ppl::common;
+
+static RuntimePool* CreateRuntimePoolForTest(const RuntimePoolOptions& options) {
+    vector<Runtime*> runtimes(options.runtime_num);
+    for (uint32_t i = 0; i < options.runtime_num; ++i) {
+        runtimes[i] = new RuntimeImpl();
+    }
+    return RuntimePoolFactory::Create(runtimes.data(), options);
+}
+
+TEST(RuntimePoolTest, acquire_and_release) {
+    RuntimePoolOptions options;
+    options.runtime_num = 2;
+    unique_ptr<RuntimePool> pool(CreateRuntimePoolForTest(options));
+    EXPECT_NE(nullptr, pool.get());
+    EXPECT_EQ(2, pool->GetRuntimeCount());
+
+    auto rt1 = pool->Acquire();
+    auto rt2 = pool->TryAcquire();
+    EXPECT_NE(nullptr, rt1);
+    EXPECT_NE(nullptr, rt2);
+    EXPECT_NE(rt1, rt2);
+    EXPECT_EQ(nullptr, pool->TryAcquire());
+
+    RuntimeImpl other;
+    EXPECT_EQ(RC_NOT_FOUND, pool->Release(&other));
+
+    EXPECT_EQ(RC_SUCCESS, pool->Release(rt2));
+    EXPECT_EQ(RC_INVALID_VALUE, pool->Release(rt2));
+    EXPECT_EQ(rt2, pool->Acquire());
+    EXPECT_EQ(RC_SUCCESS, pool->Release(rt2));
+    EXPECT_EQ(RC_SUCCESS, pool->Release(rt1));
+
+    RuntimePoolStatistics stat;
+    EXPECT_EQ(RC_SUCCESS, pool->GetStatistics(&stat));
+    EXPECT_EQ(2, stat.runtime_num);
+    EXPECT_EQ(2, stat.idle_runtime_num);
+    EXPECT_EQ(0, stat.queue_depth);
+    EXPECT_EQ(3, stat.acquire_count);
+}
+
+TEST(RuntimePoolTest, multi_threads) {
+    RuntimePoolOptions options;
+    options.runtime_num = 2;
+    unique_ptr<RuntimePool> pool(CreateRuntimePoolForTest(options));
+    EXPECT_NE(nullptr, pool.get());
+
+    const uint32_t nr_thread = 8;
+    const uint32_t nr_loop = 100;
+    vector<thread> workers;
+    for (uint32_t i = 0; i < nr_thread; ++i) {
+        workers.emplace_back([&pool, nr_loop]() -> void {
+            for (uint32_t j = 0; j < nr_loop; ++j) {
+                auto rt = pool->Acquire();
+                EXPECT_NE(nullptr, rt);
+                this_thread::yield();
+                EXPECT_EQ(RC_SUCCESS, pool->Release(rt));
+            }
+        });
+    }
+    for (auto t = workers.begin(); t != workers.end(); ++t) {
+        t->join();
+    }
+
+    RuntimePoolStatistics stat;
+    EXPECT_EQ(RC_SUCCESS, pool->GetStatistics(&stat));
+    EXPECT_EQ(2, stat.idle_runtime_num);
+    EXPECT_EQ(0, stat.queue_depth);
+    EXPECT_EQ(nr_thread * nr_loop, stat.acquire_count);
+    EXPECT_GE(nr_thread - 2, stat.max_queue_depth);
+}
+
+TEST(RuntimePoolTest, invalid_options) {
+    RuntimePoolOptions options;
+    options.runtime_num = 2;
+    options.cpu_sets.resize(1);
+    unique_ptr<RuntimePool> pool(CreateRuntimePoolForTest(options));
+    EXPECT_EQ(nullptr, pool.get());
+}
+
+TEST(RuntimePoolTest, bind_cpus) {
+    RuntimePoolOptions options;
+    options.runtime_num = 1;
+    options.cpu_sets.push_back(vector<uint32_t>(1, 0));
+    unique_ptr<RuntimePool> pool(CreateRuntimePoolForTest(options));
+    EXPECT_NE(nullptr, pool.get());
+
+    // runtimes without devices cannot bind threads of kernels, but the acquiring thread is still bound
+    auto rt = pool->Acquire();
+    EXPECT_NE(nullptr, rt);
+    EXPECT_EQ(RC_UNSUPPORTED, rt->Configure(RUNTIME_CONF_BIND_CPUS, options.cpu_sets[0].data(), (uint32_t)1));
+    EXPECT_EQ(RC_SUCCESS, pool->Release(rt));
+}
@@ -19,6 +19,7 @@
 #include "ppl/nn/utils/generic_cpu_device.h"
 #include "tests/ir/graph_builder.h"
 #include "gtest/gtest.h"
+#include <cstring>
 #include <vector>
 using namespace std;
 using namespace ppl::nn;
@@ -100,3 +101,53 @@ TEST_F(TensorImplTest, SetAndGetBufferPtr) {
     EXPECT_EQ(RC_SUCCESS, tensor.CopyToHost(buf2.data()));
     EXPECT_EQ(buf, buf2);
 }
+
+TEST_F(TensorImplTest, BindHostBuffer) {
+    auto tensor = ConstructFp32TensorWithCpuDevice();
+    auto shape = tensor.GetShape();
+    const uint64_t bytes = shape->CalcBytesIncludingPadding();
+
+    BufferDesc buf;
+    EXPECT_EQ(RC_SUCCESS, cpu_device_.Realloc(bytes + 64, &buf));
+    EXPECT_EQ(RC_UNSUPPORTED, tensor.BindHostBuffer((char*)buf.addr + 1, bytes));
+    EXPECT_EQ(RC_UNSUPPORTED, tensor.BindHostBuffer(buf.addr, bytes - 1));
+
+    EXPECT_EQ(RC_SUCCESS, tensor.BindHostBuffer(buf.addr, bytes));
+    EXPECT_TRUE(tensor.IsHostBufferBound());
+    EXPECT_EQ(RC_SUCCESS, tensor.ReallocBuffer());
+    EXPECT_EQ(buf.addr, tensor.GetBufferPtr());
+
+    // falls back to an internal buffer if the bound buffer is too small
+    shape->Reshape({1, 3, shape->GetDim(2) + 1, shape->GetDim(3)});
+    EXPECT_EQ(RC_SUCCESS, tensor.ReallocBuffer());
+    EXPECT_FALSE(tensor.IsHostBufferBound());
+    EXPECT_TRUE(tensor.IsBufferOwner());
+    EXPECT_NE(buf.addr, tensor.GetBufferPtr());
+
+    tensor.FreeBuffer();
+    cpu_device_.Free(&buf);
+}
+
+TEST_F(TensorImplTest, TransferBufferToHostBuffer) {
+    auto src = ConstructFp32TensorWithCpuDevice();
+    EXPECT_EQ(RC_SUCCESS, src.ReallocBuffer());
+    const uint64_t bytes = src.GetShape()->CalcBytesIncludingPadding();
+    memset(src.GetBufferPtr(), 1, bytes);
+
+    auto dst = ConstructFp32TensorWithCpuDevice();
+    *dst.GetShape() = *src.GetShape();
+
+    BufferDesc buf;
+    EXPECT_EQ(RC_SUCCESS, cpu_device_.Realloc(bytes, &buf));
+    EXPECT_EQ(RC_SUCCESS, dst.BindHostBuffer(buf.addr, bytes));
+
+    // data is copied to the bound buffer and `src` keeps its buffer
+    dst.TransferBufferFrom(&src);
+    EXPECT_EQ(buf.addr, dst.GetBufferPtr());
+    EXPECT_NE(nullptr, src.GetBufferPtr());
+    EXPECT_EQ(0, memcmp(buf.addr, src.GetBufferPtr(), bytes));
+
+    src.FreeBuffer();
+    dst.FreeBuffer();
+    cpu_device_.Free(&buf);
+}
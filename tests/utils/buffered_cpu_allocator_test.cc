@@ -17,6 +17,8 @@
 
 #include "ppl/nn/utils/buffered_cpu_allocator.h"
 #include "gtest/gtest.h"
+#include <cstring>
+using namespace ppl::nn;
 using namespace ppl::nn::utils;
 using namespace ppl::common;
 
@@ -28,3 +30,29 @@ TEST(BufferedCpuAllocatorTest, all) {
     auto size = ar.Extend(TEST_PAGE_SIZE);
     EXPECT_LT(0, size);
 }
+
+TEST(BufferedCpuAllocatorTest, huge_page) {
+    const uint32_t policies[] = {HUGE_PAGE_TRANSPARENT, HUGE_PAGE_HUGETLB};
+    for (auto policy : policies) {
+        BufferedCpuAllocator ar;
+        EXPECT_EQ(RC_SUCCESS, ar.Init(UINT64_MAX, policy));
+        EXPECT_EQ(0, ar.GetReservedBase() % HUGE_PAGE_SIZE);
+
+        // falls back to normal pages if huge pages are not available
+        auto size = ar.Extend(TEST_PAGE_SIZE);
+        EXPECT_EQ(HUGE_PAGE_SIZE, size);
+        memset((void*)ar.GetReservedBase(), 0, size);
+        EXPECT_GE(ar.GetAllocatedSize(), ar.GetHugePageBytes());
+    }
+}
+
+TEST(BufferedCpuAllocatorTest, exceed_reserved_range) {
+    const uint32_t policies[] = {HUGE_PAGE_NONE, HUGE_PAGE_TRANSPARENT, HUGE_PAGE_HUGETLB};
+    for (auto policy : policies) {
+        BufferedCpuAllocator ar;
+        EXPECT_EQ(RC_SUCCESS, ar.Init(HUGE_PAGE_SIZE, policy));
+        EXPECT_EQ(HUGE_PAGE_SIZE, ar.Extend(HUGE_PAGE_SIZE));
+        EXPECT_EQ(0, ar.Extend(TEST_PAGE_SIZE));
+        EXPECT_EQ(HUGE_PAGE_SIZE, ar.GetAllocatedSize());
+    }
+}
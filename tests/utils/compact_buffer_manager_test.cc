@@ -17,6 +17,7 @@
 
 #include "ppl/nn/utils/compact_buffer_manager.h"
 #include "gtest/gtest.h"
+#include <cstring>
 using namespace std;
 using namespace ppl::nn;
 using namespace ppl::common;
@@ -56,3 +57,41 @@ TEST(CompactBufferManagerTest, alloc_and_free) {
     mgr.Free(&buffer);
     EXPECT_EQ(block_size, mgr.GetBufferedBytes());
 }
+
+TEST(CompactBufferManagerTest, trim) {
+    const uint64_t bytes_needed = 1024 * 1024;
+    const uint64_t alignment = 128;
+
+    utils::BufferedCpuAllocator ar;
+    EXPECT_EQ(RC_SUCCESS, ar.Init());
+    utils::CompactBufferManager mgr(&ar, alignment);
+
+    BufferDesc a, b;
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(bytes_needed, &a));
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(bytes_needed, &b));
+    memset(a.addr, 1, bytes_needed);
+    memset(b.addr, 1, bytes_needed);
+    auto a_addr = (char*)a.addr;
+    mgr.Free(&a);
+    EXPECT_EQ(bytes_needed, mgr.GetUsedBytes());
+    EXPECT_LE(bytes_needed, mgr.GetLargestFreeBlockBytes());
+
+    // only the range of `a` is released
+    const uint64_t buffered_bytes = mgr.GetBufferedBytes();
+    const uint64_t released_bytes = mgr.Trim(0);
+    EXPECT_LE(bytes_needed / 2, released_bytes);
+    EXPECT_EQ(buffered_bytes - released_bytes, mgr.GetBufferedBytes());
+    EXPECT_EQ(0, mgr.Trim(0));
+    EXPECT_GE(ar.GetAllocatedSize() - bytes_needed, bytes_needed);
+    EXPECT_EQ(0, a_addr[bytes_needed / 2]);
+    EXPECT_EQ(1, ((char*)b.addr)[0]);
+    EXPECT_EQ(1, ((char*)b.addr)[bytes_needed - 1]);
+
+    // the address space is kept and released pages are counted again once they are used
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(bytes_needed, &a));
+    EXPECT_EQ(a_addr, a.addr);
+    EXPECT_EQ(buffered_bytes, mgr.GetBufferedBytes());
+
+    mgr.Free(&a);
+    mgr.Free(&b);
+}
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "ppl/nn/utils/min_cut_solver.h"
+#include "gtest/gtest.h"
+using namespace std;
+using namespace ppl::nn;
+
+TEST(MinCutSolverTest, unary_only) {
+    utils::MinCutSolver solver(3);
+    solver.AddUnary(0, 1, 5);
+    solver.AddUnary(1, 7, 2);
+    solver.AddUnary(2, 3, 3);
+
+    vector<uint8_t> labels;
+    solver.Solve(&labels);
+    EXPECT_EQ(0, labels[0]);
+    EXPECT_EQ(1, labels[1]);
+    EXPECT_EQ(1 + 2 + 3, solver.Evaluate(labels));
+}
+
+// x prefers 0, y prefers 1, and they cost 6 if labeled differently
+TEST(MinCutSolverTest, chain) {
+    utils::MinCutSolver solver(2);
+    solver.AddUnary(0, 0, 10);
+    solver.AddUnary(1, 4, 0);
+    solver.AddPairwise(0, 1, 0, 6, 6, 0);
+
+    vector<uint8_t> labels;
+    solver.Solve(&labels);
+    EXPECT_EQ(0, labels[0]);
+    EXPECT_EQ(0, labels[1]);
+    EXPECT_EQ(4, solver.Evaluate(labels));
+}
+
+TEST(MinCutSolverTest, brute_force) {
+    const uint32_t n = 6;
+    utils::MinCutSolver solver(n);
+    uint64_t seed = 12345;
+    auto next = [&seed]() -> uint64_t {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return (seed >> 33) % 20;
+    };
+    for (uint32_t i = 0; i < n; ++i) {
+        solver.AddUnary(i, next(), next());
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = i + 1; j < n; ++j) {
+            auto e00 = next(), e11 = next();
+            auto e01 = next() + e00 + e11, e10 = next(); // submodular
+            solver.AddPairwise(i, j, e00, e01, e10, e11);
+        }
+    }
+
+    uint64_t min_cost = UINT64_MAX;
+    vector<uint8_t> labels(n);
+    for (uint32_t mask = 0; mask < (1u << n); ++mask) {
+        for (uint32_t i = 0; i < n; ++i) {
+            labels[i] = (mask >> i) & 1;
+        }
+        min_cost = std::min(min_cost, solver.Evaluate(labels));
+    }
+
+    solver.Solve(&labels);
+    EXPECT_EQ(min_cost, solver.Evaluate(labels));
+}
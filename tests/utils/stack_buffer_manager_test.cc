@@ -36,3 +36,35 @@ TEST(StackBufferManagerTest, all_and_free) {
 
     EXPECT_LE(bytes_needed, mgr.GetBufferedBytes());
 }
+
+TEST(StackBufferManagerTest, trim) {
+    const uint64_t alignment = 128;
+
+    GenericCpuAllocator ar(alignment);
+    utils::StackBufferManager mgr(&ar);
+
+    BufferDesc small, medium, large;
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(1000, &small));
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(2000, &medium));
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(3000, &large));
+    EXPECT_EQ(6000, mgr.GetUsedBytes());
+    mgr.Free(&medium);
+    mgr.Free(&large);
+    EXPECT_EQ(1000, mgr.GetUsedBytes());
+    EXPECT_EQ(3000, mgr.GetLargestFreeBlockBytes());
+
+    // the largest free buffer is released first and buffers in use are kept
+    EXPECT_EQ(3000, mgr.Trim(3000));
+    EXPECT_EQ(3000, mgr.GetBufferedBytes());
+    EXPECT_EQ(2000, mgr.Trim(0));
+    EXPECT_EQ(1000, mgr.GetBufferedBytes());
+
+    // released buffers are allocated again on demand
+    EXPECT_EQ(RC_SUCCESS, mgr.Realloc(2500, &large));
+    EXPECT_NE(nullptr, large.addr);
+    EXPECT_EQ(3500, mgr.GetUsedBytes());
+    EXPECT_EQ(3500, mgr.GetBufferedBytes());
+
+    mgr.Free(&small);
+    mgr.Free(&large);
+}
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/nn/utils/static_plan_buffer_manager.h"
+#include "ppl/nn/utils/stack_buffer_manager.h"
+#include "ppl/common/generic_cpu_allocator.h"
+#include "gtest/gtest.h"
+using namespace ppl::nn;
+using namespace ppl::common;
+
+/** @brief counts calls of `mgr` */
+class CountingBufferManager final : public utils::BufferManager {
+public:
+    CountingBufferManager(utils::BufferManager* mgr) : utils::BufferManager("CountingBufferManager"), mgr_(mgr) {}
+    RetCode Realloc(uint64_t bytes, BufferDesc* buffer) override {
+        ++realloc_count;
+        return mgr_->Realloc(bytes, buffer);
+    }
+    void Free(BufferDesc* buffer) override {
+        ++free_count;
+        mgr_->Free(buffer);
+    }
+    uint64_t GetBufferedBytes() const override {
+        return mgr_->GetBufferedBytes();
+    }
+    uint64_t GetUsedBytes() const override {
+        return mgr_->GetUsedBytes();
+    }
+    uint64_t Trim(uint64_t keep_bytes) override {
+        return mgr_->Trim(keep_bytes);
+    }
+
+public:
+    uint32_t realloc_count = 0;
+    uint32_t free_count = 0;
+
+private:
+    std::unique_ptr<utils::BufferManager> mgr_;
+};
+
+class StaticPlanBufferManagerTest : public testing::Test {
+protected:
+    StaticPlanBufferManagerTest()
+        : arena_allocator_(alignment)
+        , fallback_(new CountingBufferManager(new utils::StackBufferManager(&arena_allocator_)))
+        , mgr_(&arena_allocator_, fallback_, alignment) {}
+
+    // in -> a -> b -> out, `a` is freed after `b` is allocated
+    void Run(uint64_t bytes, BufferDesc* in, BufferDesc* out, BufferDesc* a, BufferDesc* b) {
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(bytes, in));
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(bytes, a));
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(bytes * 2, b));
+        mgr_.Free(a);
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(bytes, out));
+        mgr_.Free(b);
+        mgr_.EndOfRun();
+    }
+
+protected:
+    static constexpr uint64_t alignment = 64;
+    GenericCpuAllocator arena_allocator_;
+    CountingBufferManager* fallback_; // owned by `mgr_`
+    utils::StaticPlanBufferManager mgr_;
+};
+
+constexpr uint64_t StaticPlanBufferManagerTest::alignment;
+
+TEST_F(StaticPlanBufferManagerTest, replay) {
+    BufferDesc in, out, a, b;
+    Run(128, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+    EXPECT_EQ(128 * 2 + 128 + 256, mgr_.GetArenaSize());
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(128, &in));
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(128, &a));
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(256, &b));
+        EXPECT_NE(a.addr, b.addr);
+        EXPECT_FALSE((char*)a.addr < (char*)b.addr + 256 && (char*)b.addr < (char*)a.addr + 128);
+        mgr_.Free(&a);
+        EXPECT_EQ(RC_SUCCESS, mgr_.Realloc(128, &out));
+        mgr_.Free(&b);
+        mgr_.EndOfRun();
+        EXPECT_TRUE(mgr_.HasPlan());
+    }
+
+    mgr_.Free(&in);
+    mgr_.Free(&out);
+}
+
+TEST_F(StaticPlanBufferManagerTest, shape_changed) {
+    BufferDesc in, out, a, b;
+    Run(128, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+
+    // falls back to dynamic allocation and records again
+    Run(512, &in, &out, &a, &b);
+    EXPECT_FALSE(mgr_.HasPlan());
+
+    Run(512, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+    EXPECT_EQ(512 * 2 + 512 + 1024, mgr_.GetArenaSize());
+
+    mgr_.Free(&in);
+    mgr_.Free(&out);
+}
+
+TEST_F(StaticPlanBufferManagerTest, trim) {
+    BufferDesc in, out, a, b;
+    Run(512, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+    EXPECT_EQ(512 * 2 + 512 + 1024, mgr_.GetArenaSize());
+    mgr_.Free(&in);
+    mgr_.Free(&out);
+
+    // the arena is not in use between runs and a smaller one is made from the next run
+    EXPECT_LE(512 * 2 + 512 + 1024, mgr_.Trim(0));
+    EXPECT_FALSE(mgr_.HasPlan());
+    EXPECT_EQ(0, mgr_.GetUsedBytes());
+
+    Run(128, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+    EXPECT_EQ(128 * 2 + 128 + 256, mgr_.GetArenaSize());
+    EXPECT_EQ(128 * 2, mgr_.GetUsedBytes());
+
+    mgr_.Free(&in);
+    mgr_.Free(&out);
+}
+
+TEST_F(StaticPlanBufferManagerTest, no_allocation_in_steady_state) {
+    BufferDesc in, out, a, b;
+    Run(128, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+
+    // the first replayed run moves inputs and outputs from `fallback` into the arena
+    Run(128, &in, &out, &a, &b);
+    EXPECT_TRUE(mgr_.HasPlan());
+
+    const uint64_t arena_size = mgr_.GetArenaSize();
+    const uint32_t realloc_count = fallback_->realloc_count;
+    const uint32_t free_count = fallback_->free_count;
+    for (int i = 0; i < 10; ++i) {
+        const void* in_addr = in.addr;
+        const void* out_addr = out.addr;
+        Run(128, &in, &out, &a, &b);
+        EXPECT_TRUE(mgr_.HasPlan());
+        EXPECT_EQ(in_addr, in.addr);
+        EXPECT_EQ(out_addr, out.addr);
+    }
+    EXPECT_EQ(realloc_count, fallback_->realloc_count);
+    EXPECT_EQ(free_count, fallback_->free_count);
+    EXPECT_EQ(arena_size, mgr_.GetArenaSize());
+
+    mgr_.Free(&in);
+    mgr_.Free(&out);
+}
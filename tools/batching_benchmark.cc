@@ -0,0 +1,293 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+/*
+  measures latency and throughput of many small requests served by a BatchingRunner. use `--max-batch-size 1` to
+  get the baseline that runs requests one by one.
+*/
+
+#include <string>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include "ppl/nn/runtime/batching_runner_factory.h"
+#include "ppl/nn/runtime/runtime_pool_factory.h"
+#include "ppl/nn/engines/engine.h"
+#include "ppl/nn/common/logger.h"
+using namespace ppl::nn;
+using namespace ppl::common;
+
+#ifdef PPLNN_ENABLE_ONNX_MODEL
+#include "ppl/nn/models/onnx/runtime_builder_factory.h"
+#endif
+
+#ifdef PPLNN_USE_X86
+#include "ppl/nn/engines/x86/engine_factory.h"
+#include "ppl/nn/engines/x86/threading.h"
+#endif
+
+#include "simple_flags.h"
+
+Define_bool_opt("--help", g_flag_help, false, "show these help information");
+Define_string_opt("--onnx-model", g_flag_onnx_model, "", "onnx model file");
+Define_string_opt("--in-shapes", g_flag_input_shapes, "",
+                  "shapes of inputs of a request. dims are separated by underline, inputs are separated by comma. "
+                  "dim 0 is the number of samples of a request. example: 1_3_224_224,1_10");
+
+Define_uint32_opt("--runtime-num", g_flag_runtime_num, 1, "number of runtimes, each of which runs a batch at a time");
+Define_uint32_opt("--max-batch-size", g_flag_max_batch_size, 8, "max number of samples in a batch");
+Define_uint32_opt("--max-delay-us", g_flag_max_delay_us, 1000,
+                  "max microseconds that the first request of a batch waits for other requests");
+Define_uint32_opt("--client-num", g_flag_client_num, 8, "number of threads sending requests");
+Define_uint32_opt("--requests-per-client", g_flag_requests_per_client, 100, "number of requests sent by a client");
+Define_int32_opt("--num-threads", g_flag_num_threads, 0, "override the environment variable OMP_NUM_THREADS");
+
+/* -------------------------------------------------------------------------- */
+
+static bool ParseInputShapes(const string& shapes_str, vector<vector<int64_t>>* input_shapes) {
+    vector<int64_t> dims;
+    string dim_str;
+    for (auto c = shapes_str.begin();; ++c) {
+        if (c == shapes_str.end() || *c == ',' || *c == '_') {
+            if (dim_str.empty()) {
+                LOG(ERROR) << "illegal dim format.";
+                return false;
+            }
+            dims.push_back(atol(dim_str.c_str()));
+            dim_str.clear();
+
+            if (c == shapes_str.end() || *c == ',') {
+                input_shapes->push_back(dims);
+                dims.clear();
+            }
+            if (c == shapes_str.end()) {
+                break;
+            }
+        } else {
+            dim_str.push_back(*c);
+        }
+    }
+    return true;
+}
+
+static RuntimePool* CreateRuntimePool(Engine* engine) {
+#ifdef PPLNN_ENABLE_ONNX_MODEL
+    auto builder = unique_ptr<onnx::RuntimeBuilder>(onnx::RuntimeBuilderFactory::Create());
+    if (!builder) {
+        LOG(ERROR) << "create RuntimeBuilder failed.";
+        return nullptr;
+    }
+
+    auto status = builder->LoadModel(g_flag_onnx_model.c_str());
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "create OnnxRuntimeBuilder failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    onnx::RuntimeBuilder::Resources resources;
+    resources.engines = &engine;
+    resources.engine_num = 1;
+    status = builder->SetResources(resources);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "onnx RuntimeBuilder SetResources failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    status = builder->Preprocess();
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "onnx preprocess failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    RuntimePoolOptions options;
+    options.runtime_num = g_flag_runtime_num;
+    return RuntimePoolFactory::Create(builder.get(), options);
+#else
+    LOG(ERROR) << "this version does not support onnx models.";
+    return nullptr;
+#endif
+}
+
+/** fills inputs of a request with random data */
+static bool GenerateInputs(RuntimePool* pool, const vector<vector<int64_t>>& input_shapes,
+                           vector<vector<char>>* input_data) {
+    auto runtime = pool->TryAcquire();
+    if (runtime->GetInputCount() != input_shapes.size()) {
+        LOG(ERROR) << "number of shapes [" << input_shapes.size() << "] != number of inputs ["
+                   << runtime->GetInputCount() << "]";
+        pool->Release(runtime);
+        return false;
+    }
+
+    std::default_random_engine eng;
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    input_data->resize(input_shapes.size());
+    for (uint32_t i = 0; i < input_shapes.size(); ++i) {
+        TensorShape shape = *runtime->GetInputTensor(i)->GetShape();
+        shape.Reshape(input_shapes[i]);
+        shape.SetDataFormat(DATAFORMAT_NDARRAY);
+
+        auto& data = input_data->at(i);
+        data.resize(shape.CalcBytesExcludingPadding(), 0);
+        if (shape.GetDataType() == DATATYPE_FLOAT32) {
+            auto fdata = (float*)data.data();
+            for (uint64_t j = 0; j < shape.CalcElementsExcludingPadding(); ++j) {
+                fdata[j] = dis(eng);
+            }
+        }
+    }
+
+    pool->Release(runtime);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    simple_flags::parse_args(argc, argv);
+    if (!simple_flags::get_unknown_flags().empty()) {
+        LOG(ERROR) << "unknown option(s). use `--help` to show available options.";
+        return -1;
+    }
+    if (g_flag_help) {
+        simple_flags::print_args_info();
+        return 0;
+    }
+
+    if (g_flag_onnx_model.empty()) {
+        LOG(ERROR) << "please specify a model.";
+        return -1;
+    }
+
+    vector<vector<int64_t>> input_shapes;
+    if (!ParseInputShapes(g_flag_input_shapes, &input_shapes)) {
+        LOG(ERROR) << "ParseInputShapes failed.";
+        return -1;
+    }
+
+#ifdef PPLNN_USE_X86
+    if (g_flag_num_threads) {
+        x86::SetGlobalOmpNumThreads(g_flag_num_threads);
+    }
+    x86::EngineOptions engine_options;
+    unique_ptr<Engine> engine(x86::EngineFactory::Create(engine_options));
+#else
+    unique_ptr<Engine> engine;
+#endif
+    if (!engine) {
+        LOG(ERROR) << "create x86 engine failed.";
+        return -1;
+    }
+
+    auto pool = CreateRuntimePool(engine.get());
+    if (!pool) {
+        LOG(ERROR) << "create RuntimePool failed.";
+        return -1;
+    }
+
+    vector<vector<char>> input_data;
+    if (!GenerateInputs(pool, input_shapes, &input_data)) {
+        delete pool;
+        return -1;
+    }
+    vector<BatchingInput> inputs(input_shapes.size());
+    for (uint32_t i = 0; i < input_shapes.size(); ++i) {
+        inputs[i].data = input_data[i].data();
+        inputs[i].dims = input_shapes[i];
+    }
+
+    BatchingRunnerOptions options;
+    options.max_batch_size = g_flag_max_batch_size;
+    options.max_delay_microseconds = g_flag_max_delay_us;
+    unique_ptr<BatchingRunner> runner(BatchingRunnerFactory::Create(pool, options));
+    if (!runner) {
+        LOG(ERROR) << "create BatchingRunner failed.";
+        return -1;
+    }
+
+    // warmup
+    vector<BatchingOutput> outputs;
+    auto status = runner->Run(inputs, &outputs);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "run request failed: " << GetRetCodeStr(status);
+        return -1;
+    }
+
+    vector<vector<double>> latencies(g_flag_client_num);
+    vector<thread> clients;
+    clients.reserve(g_flag_client_num);
+
+    auto begin_ts = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < g_flag_client_num; ++i) {
+        clients.emplace_back([&runner, &inputs, &latencies, i]() -> void {
+            vector<BatchingOutput> outputs;
+            auto& latency = latencies[i];
+            latency.reserve(g_flag_requests_per_client);
+            for (uint32_t j = 0; j < g_flag_requests_per_client; ++j) {
+                auto req_begin_ts = std::chrono::steady_clock::now();
+                auto status = runner->Run(inputs, &outputs);
+                if (status != RC_SUCCESS) {
+                    LOG(ERROR) << "run request failed: " << GetRetCodeStr(status);
+                    return;
+                }
+                auto req_end_ts = std::chrono::steady_clock::now();
+                latency.push_back(
+                    std::chrono::duration_cast<std::chrono::microseconds>(req_end_ts - req_begin_ts).count() / 1000.0);
+            }
+        });
+    }
+    for (auto t = clients.begin(); t != clients.end(); ++t) {
+        t->join();
+    }
+    auto end_ts = std::chrono::steady_clock::now();
+
+    vector<double> all_latencies;
+    for (auto l = latencies.begin(); l != latencies.end(); ++l) {
+        all_latencies.insert(all_latencies.end(), l->begin(), l->end());
+    }
+    if (all_latencies.empty()) {
+        LOG(ERROR) << "no request is finished.";
+        return -1;
+    }
+    std::sort(all_latencies.begin(), all_latencies.end());
+
+    double total_latency = 0;
+    for (auto l = all_latencies.begin(); l != all_latencies.end(); ++l) {
+        total_latency += *l;
+    }
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::microseconds>(end_ts - begin_ts).count() / 1000.0;
+
+    BatchingRunnerStatistics stat;
+    runner->GetStatistics(&stat);
+
+    const uint64_t nr_req = all_latencies.size();
+    cout << "requests: " << nr_req << ", elapsed: " << elapsed_ms << " ms" << endl;
+    cout << "throughput: " << nr_req * 1000.0 / elapsed_ms << " requests/s" << endl;
+    cout << "latency(ms): avg " << total_latency / nr_req << ", p50 " << all_latencies[nr_req / 2] << ", p99 "
+         << all_latencies[std::min(nr_req - 1, nr_req * 99 / 100)] << ", max " << all_latencies.back() << endl;
+    cout << "batches: " << stat.batch_count << ", avg batch size: " << (double)stat.sample_count / stat.batch_count
+         << ", max batch size: " << stat.max_samples_in_batch
+         << ", avg wait(ms): " << stat.total_wait_microseconds / 1000.0 / stat.request_count << endl;
+
+    return 0;
+}
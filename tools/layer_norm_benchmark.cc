@@ -0,0 +1,279 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+/*
+  runs the ReduceMean -> Sub -> Pow -> ReduceMean -> Add -> Sqrt -> Div -> Mul -> Add chain that exporters emit for
+  LayerNorm on the x86 engine twice: once with graph fusion disabled, so that every node runs as its own x86 kernel,
+  and once with graph fusion enabled, so that the chain is replaced by pmx.LayerNorm.
+*/
+
+#include <cmath>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include "ppl/nn/models/onnx/runtime_builder_factory.h"
+#include "ppl/nn/engines/x86/engine_factory.h"
+#include "ppl/nn/engines/x86/threading.h"
+#include "ppl/nn/common/logger.h"
+#include "onnx.pb.h"
+using namespace ppl::nn;
+using namespace ppl::common;
+
+#include "simple_flags.h"
+
+Define_bool_opt("--help", g_flag_help, false, "show these help information");
+Define_uint32_opt("--rows", g_flag_rows, 4096, "number of rows to be normalized, e.g. batch * sequence length");
+Define_uint32_opt("--cols", g_flag_cols, 768, "number of elements in a row, e.g. hidden size");
+Define_uint32_opt("--warmup", g_flag_warmup, 10, "warmup iterations");
+Define_uint32_opt("--loops", g_flag_loops, 100, "benchmark iterations");
+Define_int32_opt("--num-threads", g_flag_num_threads, 0, "override the environment variable OMP_NUM_THREADS");
+
+/* -------------------------------------------------------------------------- */
+
+static void AddFloatInitializer(::onnx::GraphProto* pb_graph, const string& name, const vector<int64_t>& dims,
+                                const vector<float>& data) {
+    auto pb_tensor = pb_graph->add_initializer();
+    pb_tensor->set_name(name);
+    pb_tensor->set_data_type(::onnx::TensorProto_DataType_FLOAT);
+    for (auto d : dims) {
+        pb_tensor->add_dims(d);
+    }
+    pb_tensor->set_raw_data(data.data(), data.size() * sizeof(float));
+}
+
+static void AddValueInfo(::onnx::ValueInfoProto* pb_info, const string& name, const vector<int64_t>& dims) {
+    pb_info->set_name(name);
+    auto pb_tensor_type = pb_info->mutable_type()->mutable_tensor_type();
+    pb_tensor_type->set_elem_type(::onnx::TensorProto_DataType_FLOAT);
+    for (auto d : dims) {
+        pb_tensor_type->mutable_shape()->add_dim()->set_dim_value(d);
+    }
+}
+
+static void AddNode(::onnx::GraphProto* pb_graph, const string& type, const vector<string>& inputs,
+                    const string& output) {
+    auto pb_node = pb_graph->add_node();
+    pb_node->set_name(output);
+    pb_node->set_op_type(type);
+    for (auto& i : inputs) {
+        pb_node->add_input(i);
+    }
+    pb_node->add_output(output);
+    if (type == "ReduceMean") {
+        auto pb_attr = pb_node->add_attribute();
+        pb_attr->set_name("axes");
+        pb_attr->set_type(::onnx::AttributeProto_AttributeType_INTS);
+        pb_attr->add_ints(-1);
+    }
+}
+
+/** @brief builds an opset-13 model that computes LayerNorm of `x` over the last dim without LayerNormalization */
+static bool BuildModel(int64_t rows, int64_t cols, float eps, const vector<float>& scale, const vector<float>& shift,
+                       string* content) {
+    ::onnx::ModelProto pb_model;
+    pb_model.set_ir_version(::onnx::IR_VERSION);
+    pb_model.set_producer_name("layer_norm_benchmark");
+    auto pb_opset = pb_model.add_opset_import();
+    pb_opset->set_domain("");
+    pb_opset->set_version(13);
+
+    auto pb_graph = pb_model.mutable_graph();
+    pb_graph->set_name("layer_norm");
+    AddValueInfo(pb_graph->add_input(), "x", {rows, cols});
+    AddValueInfo(pb_graph->add_output(), "y", {rows, cols});
+
+    AddFloatInitializer(pb_graph, "two", {}, {2.0f});
+    AddFloatInitializer(pb_graph, "eps", {}, {eps});
+    AddFloatInitializer(pb_graph, "scale", {cols}, scale);
+    AddFloatInitializer(pb_graph, "shift", {cols}, shift);
+
+    AddNode(pb_graph, "ReduceMean", {"x"}, "mean");
+    AddNode(pb_graph, "Sub", {"x", "mean"}, "diff");
+    AddNode(pb_graph, "Pow", {"diff", "two"}, "square");
+    AddNode(pb_graph, "ReduceMean", {"square"}, "var");
+    AddNode(pb_graph, "Add", {"var", "eps"}, "var_eps");
+    AddNode(pb_graph, "Sqrt", {"var_eps"}, "std_dev");
+    AddNode(pb_graph, "Div", {"diff", "std_dev"}, "norm");
+    AddNode(pb_graph, "Mul", {"norm", "scale"}, "scaled");
+    AddNode(pb_graph, "Add", {"scaled", "shift"}, "y");
+
+    return pb_model.SerializeToString(content);
+}
+
+static Runtime* CreateRuntime(const string& model, Engine* engine) {
+    auto builder = unique_ptr<ppl::nn::onnx::RuntimeBuilder>(ppl::nn::onnx::RuntimeBuilderFactory::Create());
+    if (!builder) {
+        LOG(ERROR) << "create RuntimeBuilder failed.";
+        return nullptr;
+    }
+
+    auto status = builder->LoadModel(model.data(), model.size());
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "load model failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    ppl::nn::onnx::RuntimeBuilder::Resources resources;
+    resources.engines = &engine;
+    resources.engine_num = 1;
+    status = builder->SetResources(resources);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "onnx RuntimeBuilder SetResources failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    status = builder->Preprocess();
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "onnx preprocess failed: " << GetRetCodeStr(status);
+        return nullptr;
+    }
+
+    return builder->CreateRuntime();
+}
+
+/** @brief runs `runtime` with input `x`, stores the result in `y` and returns milliseconds per iteration */
+static double Benchmark(Runtime* runtime, const vector<float>& x, vector<float>* y) {
+    auto input = runtime->GetInputTensor(0);
+    TensorShape src_desc = *input->GetShape();
+    src_desc.SetDataFormat(DATAFORMAT_NDARRAY);
+    auto status = input->ConvertFromHost(x.data(), src_desc);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "set input data failed: " << GetRetCodeStr(status);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < g_flag_warmup; ++i) {
+        runtime->Run();
+    }
+
+    auto begin_ts = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < g_flag_loops; ++i) {
+        status = runtime->Run();
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "Run() failed: " << GetRetCodeStr(status);
+            return -1;
+        }
+    }
+    auto end_ts = std::chrono::steady_clock::now();
+
+    auto output = runtime->GetOutputTensor(0);
+    TensorShape dst_desc = *output->GetShape();
+    dst_desc.SetDataFormat(DATAFORMAT_NDARRAY);
+    y->resize(dst_desc.CalcElementsExcludingPadding());
+    status = output->ConvertToHost(y->data(), dst_desc);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "get output data failed: " << GetRetCodeStr(status);
+        return -1;
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end_ts - begin_ts).count() / 1000.0 / g_flag_loops;
+}
+
+static double RunModel(const string& model, bool enable_fusion, const vector<float>& x, vector<float>* y) {
+    x86::EngineOptions options;
+    unique_ptr<Engine> engine(x86::EngineFactory::Create(options));
+    if (!engine) {
+        LOG(ERROR) << "create x86 engine failed.";
+        return -1;
+    }
+
+    auto status = engine->Configure(x86::ENGINE_CONF_GRAPH_FUSION, enable_fusion ? 1 : 0);
+    if (status != RC_SUCCESS) {
+        LOG(ERROR) << "x86_engine Configure ENGINE_CONF_GRAPH_FUSION failed: " << GetRetCodeStr(status);
+        return -1;
+    }
+
+    unique_ptr<Runtime> runtime(CreateRuntime(model, engine.get()));
+    if (!runtime) {
+        LOG(ERROR) << "create runtime failed.";
+        return -1;
+    }
+
+    return Benchmark(runtime.get(), x, y);
+}
+
+int main(int argc, char* argv[]) {
+    simple_flags::parse_args(argc, argv);
+    if (!simple_flags::get_unknown_flags().empty()) {
+        LOG(ERROR) << "unknown option(s). use `--help` to show available options.";
+        return -1;
+    }
+    if (g_flag_help) {
+        simple_flags::print_args_info();
+        return 0;
+    }
+    if (g_flag_rows == 0 || g_flag_cols == 0 || g_flag_loops == 0) {
+        LOG(ERROR) << "`--rows`, `--cols` and `--loops` should be greater than 0.";
+        return -1;
+    }
+
+    if (g_flag_num_threads) {
+        x86::SetGlobalOmpNumThreads(g_flag_num_threads);
+    }
+
+    const int64_t rows = g_flag_rows;
+    const int64_t cols = g_flag_cols;
+    const float eps = 1e-5f;
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-4.0f, 4.0f);
+    vector<float> x(rows * cols), scale(cols), shift(cols);
+    for (auto& v : x) {
+        v = dist(gen) + 1.0f;
+    }
+    for (int64_t j = 0; j < cols; ++j) {
+        scale[j] = dist(gen);
+        shift[j] = dist(gen);
+    }
+
+    string model;
+    if (!BuildModel(rows, cols, eps, scale, shift, &model)) {
+        LOG(ERROR) << "serialize model failed.";
+        return -1;
+    }
+
+    vector<float> unfused_y, fused_y;
+    const double unfused_ms = RunModel(model, false, x, &unfused_y);
+    if (unfused_ms < 0) {
+        LOG(ERROR) << "run model with graph fusion disabled failed.";
+        return -1;
+    }
+    const double fused_ms = RunModel(model, true, x, &fused_y);
+    if (fused_ms < 0) {
+        LOG(ERROR) << "run model with graph fusion enabled failed.";
+        return -1;
+    }
+
+    float max_diff = 0.0f;
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        max_diff = std::max(max_diff, fabsf(fused_y[i] - unfused_y[i]));
+    }
+
+    cout << "shape: [" << rows << ", " << cols << "], max abs diff: " << max_diff << endl;
+    cout << "fusion disabled: " << unfused_ms << " ms/iter" << endl;
+    cout << "fusion enabled: " << fused_ms << " ms/iter" << endl;
+    cout << "speedup: " << unfused_ms / fused_ms << endl;
+
+    return 0;
+}
@@ -69,8 +69,11 @@ Define_string_opt("--save-pmx-model", g_flag_save_pmx_model, "", "deprecated. us
 
 Define_string_opt(
     "--mm-policy", g_flag_mm_policy, "mem",
-    "\"mem\"(default) => less memory usage; \"perf\" => better performance; \"plain\": plain implementation");
+    "\"mem\"(default) => less memory usage; \"perf\" => better performance; \"plain\": plain implementation;"
+    " \"static\": reuse memory plan of the previous run(x86 only)");
 Define_bool_opt("--no-run", g_flag_no_run, false, "do not evaluate the model");
+Define_uint32_opt("--sched-threads", g_flag_sched_threads, 0,
+                  "run independent kernels concurrently with <n> threads. 0(default) => sequential scheduler");
 
 Define_bool_opt("--enable-profiling", g_flag_enable_profiling, false, "enable profiling and print profiling info");
 Define_float_opt("--min-profiling-seconds", g_flag_min_profiling_seconds, 1.0f,
@@ -78,6 +81,11 @@ Define_float_opt("--min-profiling-seconds", g_flag_min_profiling_seconds, 1.0f,
 Define_uint32_opt("--min-profiling-iterations", g_flag_min_profiling_iterations, 1, "declare profiling iteration");
 Define_uint32_opt("--warmup-iterations", g_flag_warmup_iterations, 1, "declare profiling warmup iteration");
 Define_bool_opt("--perf-with-io", g_flag_perf_with_io, false, "profiling with io copy");
+Define_string_opt("--profiling-trace-file", g_flag_profiling_trace_file, "",
+                  "save timeline of kernels to <filename> in chrome trace event format. "
+                  "can be viewed in chrome://tracing or perfetto.");
+Define_bool_opt("--print-edge-memory", g_flag_print_edge_memory, false,
+                "print size and lifetime of each tensor along with memory statistics when profiling");
 
 Define_string_opt("--input", g_flag_input, "", "binary input file containing all tensors' data");
 Define_string_opt("--inputs", g_flag_inputs, "", "binary input files separated by comma");
@@ -329,16 +337,56 @@ Define_bool_opt("--disable-avx512", g_flag_disable_avx512, false, "disable avx51
 Define_bool_opt("--disable-avx-fma3", g_flag_disable_avx_fma3, false, "disable avx, fma3 and avx512 feature");
 Define_bool_opt("--core-binding", g_flag_core_binding, false, "core binding");
 Define_int32_opt("--num-threads", g_flag_num_threads, 0, "override the environment variable OMP_NUM_THREADS");
+Define_uint32_opt("--runtime-num-threads", g_flag_runtime_num_threads, 0,
+                  "number of threads used by runtimes of x86 engine instead of the global setting");
+Define_string_opt("--runtime-cpus", g_flag_runtime_cpus, "",
+                  "cpus that threads of x86 runtimes are bound to, separated by comma, e.g. `0,1,2,3`");
+Define_int32_opt("--x86-numa-node-id", g_flag_x86_numa_node_id, -1,
+                 "bind memory and threads of x86 engine to specified numa node, -1 means not bind");
+Define_string_opt("--x86-huge-page", g_flag_x86_huge_page, "none",
+                  "back constants and buffers of x86 engine with huge pages: none, thp or hugetlb");
+Define_uint32_opt("--x86-auto-trim-runs", g_flag_x86_auto_trim_runs, 0,
+                  "give unused memory of x86 runtimes back after this number of runs below the peak, 0 means off");
+Define_uint64_opt("--x86-constant-cache-bytes", g_flag_x86_constant_cache_bytes, 0,
+                  "load large constants of x86 engine on demand and keep at most this bytes of them, 0 means off");
+Define_uint64_opt("--x86-max-folded-constant-bytes", g_flag_x86_max_folded_constant_bytes, 16 * 1024 * 1024,
+                  "evaluate nodes whose inputs are all constants if their outputs are not larger than this bytes, "
+                  "0 means off");
 
 Define_bool_opt("--disable-graph-fusion", g_flag_disable_graph_fusion, false, "disable graph kernel fusion rules");
 Define_bool_opt("--enable-tensor-debug", g_flag_enable_tensor_debug, false, "dump tensors' data");
 Define_string_opt("--debug-data-dir", g_flag_debug_data_dir, ".", "directory to save dumped tensors' data");
+Define_bool_opt("--enable-reshape-cache", g_flag_enable_reshape_cache, false,
+                "skip Reshape() of kernels if shapes and small data of their inputs are not changed");
+Define_bool_opt("--enable-x86-algo-tuning", g_flag_enable_x86_algo_tuning, false,
+                "measure candidate algorithms of x86 kernels and select the fastest one");
+Define_string_opt("--x86-export-algo-file", g_flag_x86_export_algo_file, "",
+                  "export algorithms selected by x86 engine into the json file");
+Define_string_opt("--x86-import-algo-file", g_flag_x86_import_algo_file, "",
+                  "a json file exported by `--x86-export-algo-file` to skip tuning");
 
 #include "ppl/nn/engines/x86/engine_factory.h"
 #include "ppl/nn/engines/x86/options.h"
+#include "ppl/nn/engines/x86/constant_cache_statistics.h"
 #include "ppl/nn/engines/x86/threading.h"
 #include "ppl/kernel/x86/common/threading_tools.h"
 
+static void X86SaveAlgoInfo(const char* data, uint64_t bytes, void* arg) {
+    auto fname = (const char*)arg;
+    auto fp = fopen(fname, "w");
+    if (!fp) {
+        LOG(ERROR) << "open [" << fname << "] for exporting algo info failed.";
+        return;
+    }
+
+    auto ret = fwrite(data, bytes, 1, fp);
+    if (ret != 1) {
+        LOG(ERROR) << "write algo info to [" << fname << "] failed.";
+    }
+
+    fclose(fp);
+}
+
 static bool RegisterX86Engine(vector<unique_ptr<Engine>>* engines) {
     x86::EngineOptions options;
     if (g_flag_mm_policy == "perf") {
@@ -347,6 +395,8 @@ static bool RegisterX86Engine(vector<unique_ptr<Engine>>* engines) {
         options.mm_policy = x86::MM_COMPACT;
     } else if (g_flag_mm_policy == "plain") {
         options.mm_policy = x86::MM_PLAIN;
+    } else if (g_flag_mm_policy == "static") {
+        options.mm_policy = x86::MM_STATIC_PLAN;
     } else {
         LOG(ERROR) << "unknown --mm-policy option: " << g_flag_mm_policy;
         return false;
@@ -354,6 +404,34 @@ static bool RegisterX86Engine(vector<unique_ptr<Engine>>* engines) {
 
     options.disable_avx512 = g_flag_disable_avx512;
     options.disable_avx_fma3 = g_flag_disable_avx_fma3;
+    options.thread_num = g_flag_runtime_num_threads;
+    if (!g_flag_runtime_cpus.empty()) {
+        bool ok = true;
+        SplitString(g_flag_runtime_cpus.data(), g_flag_runtime_cpus.size(), ",", 1,
+                    [&ok, &options](const char* s, unsigned int l) -> bool {
+                        if (l > 0) {
+                            options.cpu_ids.push_back(atoi(string(s, l).c_str()));
+                            return true;
+                        }
+                        LOG(ERROR) << "illegal cpu id format.";
+                        ok = false;
+                        return false;
+                    });
+        if (!ok) {
+            return false;
+        }
+    }
+    options.numa_node_id = g_flag_x86_numa_node_id;
+    if (g_flag_x86_huge_page == "none") {
+        options.huge_page_policy = x86::HUGE_PAGE_NONE;
+    } else if (g_flag_x86_huge_page == "thp") {
+        options.huge_page_policy = x86::HUGE_PAGE_TRANSPARENT;
+    } else if (g_flag_x86_huge_page == "hugetlb") {
+        options.huge_page_policy = x86::HUGE_PAGE_HUGETLB;
+    } else {
+        LOG(ERROR) << "unknown --x86-huge-page option: " << g_flag_x86_huge_page;
+        return false;
+    }
 
     auto x86_engine = x86::EngineFactory::Create(options);
 
@@ -372,6 +450,60 @@ static bool RegisterX86Engine(vector<unique_ptr<Engine>>* engines) {
         LOG(ERROR) << "x86_engine Configure ENGINE_CONF_DEBUG_DATA_DIR failed: " << GetRetCodeStr(rc);
         return false;
     }
+    rc = x86_engine->Configure(x86::ENGINE_CONF_RESHAPE_CACHE, g_flag_enable_reshape_cache ? 1 : 0);
+    if (RC_SUCCESS != rc) {
+        LOG(ERROR) << "x86_engine Configure ENGINE_CONF_RESHAPE_CACHE failed: " << GetRetCodeStr(rc);
+        return false;
+    }
+    rc = x86_engine->Configure(x86::ENGINE_CONF_ALGO_TUNING, g_flag_enable_x86_algo_tuning ? 1 : 0);
+    if (RC_SUCCESS != rc) {
+        LOG(ERROR) << "x86_engine Configure ENGINE_CONF_ALGO_TUNING failed: " << GetRetCodeStr(rc);
+        return false;
+    }
+
+    if (!g_flag_x86_export_algo_file.empty()) {
+        x86_engine->Configure(x86::ENGINE_CONF_SET_EXPORT_ALGORITHMS_HANDLER, X86SaveAlgoInfo,
+                              g_flag_x86_export_algo_file.c_str());
+    }
+
+    if (!g_flag_x86_import_algo_file.empty()) {
+        Mmap fm;
+        rc = fm.Init(g_flag_x86_import_algo_file.c_str(), Mmap::READ);
+        if (rc != RC_SUCCESS) {
+            LOG(ERROR) << "mapping algo file[" << g_flag_x86_import_algo_file << "] failed.";
+            return false;
+        }
+
+        rc = x86_engine->Configure(x86::ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER, fm.GetData(), fm.GetSize());
+        if (RC_SUCCESS != rc) {
+            LOG(ERROR) << "x86_engine Configure ENGINE_CONF_IMPORT_ALGORITHMS_FROM_BUFFER failed: "
+                       << GetRetCodeStr(rc);
+            return false;
+        }
+    }
+
+#ifdef PPLNN_ENABLE_PMX_MODEL
+    if (!g_flag_export_pmx_model.empty()) {
+        if (g_flag_x86_constant_cache_bytes > 0) {
+            LOG(ERROR) << "--x86-constant-cache-bytes cannot be used with --export-pmx-model.";
+            return false;
+        }
+    }
+#endif
+
+    if (g_flag_x86_constant_cache_bytes > 0) {
+        rc = x86_engine->Configure(x86::ENGINE_CONF_CONSTANT_CACHE_BYTES, g_flag_x86_constant_cache_bytes);
+        if (RC_SUCCESS != rc) {
+            LOG(ERROR) << "x86_engine Configure ENGINE_CONF_CONSTANT_CACHE_BYTES failed: " << GetRetCodeStr(rc);
+            return false;
+        }
+    }
+
+    rc = x86_engine->Configure(x86::ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES, g_flag_x86_max_folded_constant_bytes);
+    if (RC_SUCCESS != rc) {
+        LOG(ERROR) << "x86_engine Configure ENGINE_CONF_MAX_FOLDED_CONSTANT_BYTES failed: " << GetRetCodeStr(rc);
+        return false;
+    }
 
     if (g_flag_num_threads) {
         ppl::nn::x86::SetGlobalOmpNumThreads(g_flag_num_threads);
@@ -387,6 +519,60 @@ static bool RegisterX86Engine(vector<unique_ptr<Engine>>* engines) {
     return true;
 }
 
+static void PrintX86HugePageInfo(const vector<unique_ptr<Engine>>& engines, const Runtime* runtime) {
+    uint64_t constant_bytes = 0;
+    for (auto e = engines.begin(); e != engines.end(); ++e) {
+        uint64_t bytes = 0;
+        if (strcmp((*e)->GetName(), "x86") == 0 &&
+            (*e)->Configure(x86::ENGINE_CONF_GET_HUGE_PAGE_BYTES, &bytes) == RC_SUCCESS) {
+            constant_bytes += bytes;
+        }
+    }
+
+    uint64_t runtime_bytes = 0;
+    for (uint32_t i = 0; i < runtime->GetDeviceContextCount(); ++i) {
+        auto dev_ctx = runtime->GetDeviceContext(i);
+        uint64_t bytes = 0;
+        if (strcmp(dev_ctx->GetType().str, "cpu") == 0 &&
+            dev_ctx->Configure(x86::DEV_CONF_GET_HUGE_PAGE_BYTES, &bytes) == RC_SUCCESS) {
+            runtime_bytes += bytes;
+        }
+    }
+
+    LOG(INFO) << "huge page backed bytes: constants [" << constant_bytes << "], runtime [" << runtime_bytes << "]";
+}
+
+static void PrintX86ConstantCacheInfo(const vector<unique_ptr<Engine>>& engines) {
+    for (auto e = engines.begin(); e != engines.end(); ++e) {
+        x86::ConstantCacheStatistics stat;
+        if (strcmp((*e)->GetName(), "x86") != 0 ||
+            (*e)->Configure(x86::ENGINE_CONF_GET_CONSTANT_CACHE_STATISTICS, &stat) != RC_SUCCESS) {
+            continue;
+        }
+
+        LOG(INFO) << "constant cache: budget [" << stat.budget_bytes << "], used [" << stat.used_bytes << "], peak ["
+                  << stat.peak_used_bytes << "] bytes";
+        for (auto c = stat.constant_info.begin(); c != stat.constant_info.end(); ++c) {
+            LOG(INFO) << "    constant [" << c->name << "], bytes [" << c->bytes << "], hits [" << c->hits
+                      << "], misses [" << c->misses << "], evictions [" << c->evictions << "]";
+        }
+    }
+}
+
+static bool SetX86AutoTrimRuns(Runtime* runtime) {
+    for (uint32_t i = 0; i < runtime->GetDeviceContextCount(); ++i) {
+        auto dev_ctx = runtime->GetDeviceContext(i);
+        if (strcmp(dev_ctx->GetType().str, "cpu") == 0) {
+            auto rc = dev_ctx->Configure(x86::DEV_CONF_SET_AUTO_TRIM_RUNS, g_flag_x86_auto_trim_runs);
+            if (rc != RC_SUCCESS) {
+                LOG(ERROR) << "configure x86::DEV_CONF_SET_AUTO_TRIM_RUNS failed: " << GetRetCodeStr(rc);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 #endif
 
 #ifdef PPLNN_USE_RISCV
@@ -1001,11 +1187,24 @@ static void PrintProfilingStatistics(const ProfilingStatistics& stat, double run
             type_count[ext_type]++;
         }
         sprintf(float_buf_0, "%8.4f", avg_time);
+        sprintf(float_buf_1, "%.3f/%.3f/%.3f/%.3f", (double)x->min_exec_microseconds / 1000,
+                (double)x->p50_exec_microseconds / 1000, (double)x->p99_exec_microseconds / 1000,
+                (double)x->max_exec_microseconds / 1000);
         string temp = x->name;
         temp.insert(temp.length(), temp.length() > 50 ? 0 : 50 - temp.length(), ' ');
         LOG(INFO) << "NAME: [" << temp << "], "
                   << "AVG_TIME: [" << float_buf_0 << "], "
+                  << "MIN/P50/P99/MAX: [" << float_buf_1 << "], "
                   << "EXEC_COUNT: [" << x->exec_count << "]";
+
+        if (x->exec_microseconds > 0) {
+            // estimated throughput. a low FLOPS/BYTE ratio usually means that the kernel is memory-bound.
+            sprintf(float_buf_0, "%8.3f", (double)x->total_flops / x->exec_microseconds / 1000);
+            sprintf(float_buf_1, "%8.3f", (double)x->total_bytes / x->exec_microseconds / 1000);
+            LOG(INFO) << "NAME: [" << temp << "], GFLOPS: [" << float_buf_0 << "], GB/S: [" << float_buf_1
+                      << "], FLOPS/BYTE: [" << (x->total_bytes > 0 ? (double)x->total_flops / x->total_bytes : 0.0)
+                      << "]";
+        }
     }
     LOG(INFO) << "----- OP statistics by OpType -----";
     double tot_kernel_time = 0;
@@ -1034,6 +1233,43 @@ static void PrintProfilingStatistics(const ProfilingStatistics& stat, double run
     sprintf(float_buf_0, "%8.4f%%", (run_dur - tot_kernel_time) / run_dur * 100);
     LOG(INFO) << "SCHED_LOST: [" << float_buf_0 << "]";
 }
+
+static string EscapeJsonString(const string& str) {
+    string ret;
+    for (auto c = str.begin(); c != str.end(); ++c) {
+        if (*c == '"' || *c == '\\') {
+            ret.push_back('\\');
+        }
+        ret.push_back(*c);
+    }
+    return ret;
+}
+
+static bool SaveProfilingTrace(const ProfilingStatistics& stat, const string& filename) {
+    ofstream ofs(filename, ios_base::out | ios_base::binary | ios_base::trunc);
+    if (!ofs.is_open()) {
+        LOG(ERROR) << "open file[" << filename << "] failed.";
+        return false;
+    }
+
+    bool is_first = true;
+    ofs << "{\"traceEvents\":[";
+    for (auto e = stat.trace_events.begin(); e != stat.trace_events.end(); ++e) {
+        if (e->kernel_idx >= stat.prof_info.size()) {
+            continue;
+        }
+        auto& info = stat.prof_info[e->kernel_idx];
+        auto ext_type = (info.domain.empty() ? "" : info.domain + ".") + info.type;
+        ofs << (is_first ? "\n" : ",\n") << "{\"name\":\"" << EscapeJsonString(info.name) << "\",\"cat\":\""
+            << EscapeJsonString(ext_type) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e->thread_idx
+            << ",\"ts\":" << e->begin_microseconds << ",\"dur\":" << e->exec_microseconds << "}";
+        is_first = false;
+    }
+    ofs << "\n]}\n";
+
+    LOG(INFO) << "save [" << stat.trace_events.size() << "] trace events to [" << filename << "]";
+    return true;
+}
 #endif
 
 static bool SetInputs(const vector<string>& input_data, Runtime* runtime) {
@@ -1078,6 +1314,29 @@ static bool GetOutputs(const Runtime* runtime) {
     return true;
 }
 
+static void PrintMemoryStatistics(const MemoryStatistics& stat) {
+    LOG(INFO) << "----- Memory statistics -----";
+    LOG(INFO) << "constants: [" << stat.constant_bytes << "] bytes";
+    for (auto d = stat.device_stat.begin(); d != stat.device_stat.end(); ++d) {
+        const uint64_t free_bytes = d->buffered_bytes - d->used_bytes;
+        const double fragmentation = (free_bytes > 0) ? 1.0 - (double)d->largest_free_block_bytes / free_bytes : 0.0;
+        LOG(INFO) << "DEVICE: [" << d->name << "], PEAK_USED: [" << d->peak_used_bytes << "], MAX_TMP_BUFFER: ["
+                  << d->max_tmp_buffer_bytes << "], BUFFERED/USED: [" << d->buffered_bytes << "/" << d->used_bytes
+                  << "], FRAGMENTATION: [" << fragmentation << "]";
+    }
+
+    if (g_flag_print_edge_memory) {
+        for (auto e = stat.edge_info.begin(); e != stat.edge_info.end(); ++e) {
+            string temp = e->name;
+            temp.insert(temp.length(), temp.length() > 50 ? 0 : 50 - temp.length(), ' ');
+            const string last_step =
+                (e->last_consumer_step == UINT32_MAX) ? string("end") : std::to_string(e->last_consumer_step);
+            LOG(INFO) << "TENSOR: [" << temp << "], BYTES: [" << e->bytes << "], STEPS: [" << e->producer_step
+                      << ", " << last_step << "]";
+        }
+    }
+}
+
 static bool Profiling(const vector<string>& input_data, Runtime* runtime) {
     if (g_flag_warmup_iterations > 0) {
         LOG(INFO) << "Warm up start for " << g_flag_warmup_iterations << " times.";
@@ -1121,10 +1380,24 @@ static bool Profiling(const vector<string>& input_data, Runtime* runtime) {
         LOG(WARNING) << "Get profiling statistics failed: " << GetRetCodeStr(status);
     }
     PrintProfilingStatistics(stat, run_dur, run_count);
+
+    if (!g_flag_profiling_trace_file.empty()) {
+        if (!SaveProfilingTrace(stat, g_flag_profiling_trace_file)) {
+            LOG(WARNING) << "save profiling trace failed.";
+        }
+    }
 #else
     LOG(INFO) << "Average run costs: " << (run_dur / run_count) << " ms.";
 #endif
 
+    MemoryStatistics mem_stat;
+    auto rc = runtime->GetMemoryStatistics(&mem_stat);
+    if (rc == RC_SUCCESS) {
+        PrintMemoryStatistics(mem_stat);
+    } else {
+        LOG(WARNING) << "Get memory statistics failed: " << GetRetCodeStr(rc);
+    }
+
     LOG(INFO) << "Profiling End";
     return true;
 }
@@ -1338,6 +1611,22 @@ int main(int argc, char* argv[]) {
     }
 #endif
 
+    if (g_flag_sched_threads > 0) {
+        auto status = runtime->Configure(RUNTIME_CONF_SET_PARALLEL_SCHEDULER, g_flag_sched_threads);
+        if (status != RC_SUCCESS) {
+            LOG(ERROR) << "set parallel scheduler failed: " << GetRetCodeStr(status);
+            return -1;
+        }
+    }
+
+#ifdef PPLNN_USE_X86
+    if (g_flag_use_x86 && g_flag_x86_auto_trim_runs > 0) {
+        if (!SetX86AutoTrimRuns(runtime.get())) {
+            return -1;
+        }
+    }
+#endif
+
     vector<vector<int64_t>> input_shapes;
     if (!g_flag_input_shapes.empty()) {
         if (!ParseInputShapes(g_flag_input_shapes, &input_shapes)) {
@@ -1424,6 +1713,12 @@ int main(int argc, char* argv[]) {
 
     LOG(INFO) << "Run ok";
 
+#ifdef PPLNN_USE_X86
+    if (g_flag_use_x86 && g_flag_x86_huge_page != "none") {
+        PrintX86HugePageInfo(engines, runtime.get());
+    }
+#endif
+
     if (g_flag_enable_profiling) {
         if (!Profiling(input_data, runtime.get())) {
             LOG(ERROR) << "Profiling() failed.";
@@ -1431,5 +1726,11 @@ int main(int argc, char* argv[]) {
         }
     }
 
+#ifdef PPLNN_USE_X86
+    if (g_flag_use_x86 && g_flag_x86_constant_cache_bytes > 0) {
+        PrintX86ConstantCacheInfo(engines);
+    }
+#endif
+
     return 0;
 }